@@ -0,0 +1,99 @@
+/// Apache License 2.0
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/BulletinA.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Finals2000A.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+
+using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
+using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
+
+// Parse throughput of the data files in the test data directories. The binary sidecar caches are not used.
+
+namespace
+{
+
+File AccessTestFile(const std::string& aPath)
+{
+    return File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/" + aPath));
+}
+
+template <typename Loader>
+void BenchmarkLoad(benchmark::State& aState, const File& aFile, const Loader& aLoader)
+{
+    const std::uintmax_t fileSize = std::filesystem::file_size(std::string(aFile.getPath().toString()));
+
+    for (auto _ : aState)
+    {
+        benchmark::DoNotOptimize(aLoader(aFile));
+    }
+
+    aState.SetBytesProcessed(aState.iterations() * fileSize);
+}
+
+}  // namespace
+
+static void Finals2000A_Load(benchmark::State& aState)
+{
+    BenchmarkLoad(
+        aState,
+        AccessTestFile("Coordinate/Frame/Provider/IERS/finals-2000A/finals2000A.data"),
+        [](const File& aFile) -> Finals2000A
+        {
+            return Finals2000A::Load(aFile);
+        }
+    );
+}
+
+static void BulletinA_Load(benchmark::State& aState)
+{
+    BenchmarkLoad(
+        aState,
+        AccessTestFile("Coordinate/Frame/Provider/IERS/bulletin-A/ser7.dat"),
+        [](const File& aFile) -> BulletinA
+        {
+            return BulletinA::Load(aFile);
+        }
+    );
+}
+
+static void CSSISpaceWeather_Load(benchmark::State& aState)
+{
+    BenchmarkLoad(
+        aState,
+        AccessTestFile("Environment/Atmospheric/Earth/CSSISpaceWeather/SW-Last5Years.test.csv"),
+        [](const File& aFile) -> CSSISpaceWeather
+        {
+            return CSSISpaceWeather::Load(aFile);
+        }
+    );
+}
+
+static void CSSISpaceWeather_LoadLegacy(benchmark::State& aState)
+{
+    BenchmarkLoad(
+        aState,
+        AccessTestFile("Environment/Atmospheric/Earth/NRLMSISE00/SpaceWeather-All-v1.2.txt"),
+        [](const File& aFile) -> CSSISpaceWeather
+        {
+            return CSSISpaceWeather::LoadLegacy(aFile);
+        }
+    );
+}
+
+BENCHMARK(Finals2000A_Load)->Unit(benchmark::kMillisecond);
+BENCHMARK(BulletinA_Load)->Unit(benchmark::kMillisecond);
+BENCHMARK(CSSISpaceWeather_Load)->Unit(benchmark::kMillisecond);
+BENCHMARK(CSSISpaceWeather_LoadLegacy)->Unit(benchmark::kMillisecond);
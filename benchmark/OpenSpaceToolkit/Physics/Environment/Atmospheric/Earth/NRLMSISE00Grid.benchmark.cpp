@@ -0,0 +1,186 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00Grid.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00Grid;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+namespace
+{
+
+// Ground track of a 500 km, 51.6 deg inclination circular orbit, sampled every 10 s over a revolution, within the
+// 03:00 - 06:00 UTC bucket
+
+struct Trajectory
+{
+    Array<LLA> llas;
+    Array<Instant> instants;
+};
+
+Trajectory GenerateLEOTrajectory()
+{
+    const Instant startInstant = Instant::DateTime(DateTime::Parse("2021-01-01 03:00:00"), Scale::UTC);
+
+    const double inclination = 51.6 * M_PI / 180.0;
+    const double orbitalPeriod = 5677.0;            // [s]
+    const double earthRotationRate = 7.2921159e-5;  // [rad/s]
+
+    Trajectory trajectory = {Array<LLA>::Empty(), Array<Instant>::Empty()};
+
+    for (Index index = 0; index < 568; ++index)
+    {
+        const double elapsedTime = 10.0 * index;
+        const double argumentOfLatitude = 2.0 * M_PI * elapsedTime / orbitalPeriod;
+
+        const double latitude = std::asin(std::sin(inclination) * std::sin(argumentOfLatitude));
+        const double longitude =
+            std::atan2(std::cos(inclination) * std::sin(argumentOfLatitude), std::cos(argumentOfLatitude)) -
+            earthRotationRate * elapsedTime;
+
+        trajectory.llas.add(LLA(
+            Angle::Radians(latitude), Angle::Radians(std::remainder(longitude, 2.0 * M_PI)), Length::Kilometers(500.0)
+        ));
+        trajectory.instants.add(startInstant + Duration::Seconds(elapsedTime));
+    }
+
+    return trajectory;
+}
+
+// Constant space weather, so that the benchmark does not depend on data files. Both are built on first use, rather than
+// during static initialization.
+
+const NRLMSISE00& AccessModel()
+{
+    static const NRLMSISE00 nrlmsise = {NRLMSISE00::InputDataType::ConstantFluxAndGeoMag};
+
+    return nrlmsise;
+}
+
+const Trajectory& AccessTrajectory()
+{
+    static const Trajectory trajectory = GenerateLEOTrajectory();
+
+    return trajectory;
+}
+
+}  // namespace
+
+// Direct evaluation of the model along the trajectory
+
+static void NRLMSISE00_GetDensityAt_LEOTrajectory(benchmark::State& aState)
+{
+    const NRLMSISE00& nrlmsise = AccessModel();
+    const Trajectory& trajectory = AccessTrajectory();
+
+    for (auto _ : aState)
+    {
+        for (Index index = 0; index < trajectory.llas.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(nrlmsise.getDensityAt(trajectory.llas[index], trajectory.instants[index]));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * trajectory.llas.getSize());
+}
+
+// Grid with an empty cache: only the nodes around the trajectory are evaluated
+
+static void NRLMSISE00Grid_GetDensityAt_LEOTrajectory_Lazy(benchmark::State& aState)
+{
+    const NRLMSISE00& nrlmsise = AccessModel();
+    const Trajectory& trajectory = AccessTrajectory();
+
+    for (auto _ : aState)
+    {
+        const NRLMSISE00Grid grid = {nrlmsise};
+
+        for (Index index = 0; index < trajectory.llas.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(grid.getDensityAt(trajectory.llas[index], trajectory.instants[index]));
+        }
+
+        aState.counters["EvaluatedNodes"] = static_cast<double>(grid.getEvaluatedNodeCount());
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * trajectory.llas.getSize());
+}
+
+// Grid with an empty cache, with every node of the bucket evaluated up front (as eagerly built buckets were), through
+// computeMaximumRelativeErrorAt, which additionally evaluates the model at the cell centers
+
+static void NRLMSISE00Grid_GetDensityAt_LEOTrajectory_AllNodes(benchmark::State& aState)
+{
+    const NRLMSISE00& nrlmsise = AccessModel();
+    const Trajectory& trajectory = AccessTrajectory();
+
+    for (auto _ : aState)
+    {
+        const NRLMSISE00Grid grid = {nrlmsise};
+
+        benchmark::DoNotOptimize(grid.computeMaximumRelativeErrorAt(trajectory.instants[0]));
+
+        for (Index index = 0; index < trajectory.llas.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(grid.getDensityAt(trajectory.llas[index], trajectory.instants[index]));
+        }
+
+        aState.counters["EvaluatedNodes"] = static_cast<double>(grid.getEvaluatedNodeCount());
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * trajectory.llas.getSize());
+}
+
+// Grid with a warm cache: interpolation only
+
+static void NRLMSISE00Grid_GetDensityAt_LEOTrajectory_Cached(benchmark::State& aState)
+{
+    const NRLMSISE00& nrlmsise = AccessModel();
+    const Trajectory& trajectory = AccessTrajectory();
+
+    const NRLMSISE00Grid grid = {nrlmsise};
+
+    for (Index index = 0; index < trajectory.llas.getSize(); ++index)
+    {
+        grid.getDensityAt(trajectory.llas[index], trajectory.instants[index]);
+    }
+
+    for (auto _ : aState)
+    {
+        for (Index index = 0; index < trajectory.llas.getSize(); ++index)
+        {
+            benchmark::DoNotOptimize(grid.getDensityAt(trajectory.llas[index], trajectory.instants[index]));
+        }
+    }
+
+    aState.SetItemsProcessed(aState.iterations() * trajectory.llas.getSize());
+}
+
+BENCHMARK(NRLMSISE00_GetDensityAt_LEOTrajectory)->Unit(benchmark::kMillisecond);
+BENCHMARK(NRLMSISE00Grid_GetDensityAt_LEOTrajectory_Lazy)->Unit(benchmark::kMillisecond);
+BENCHMARK(NRLMSISE00Grid_GetDensityAt_LEOTrajectory_AllNodes)->Unit(benchmark::kMillisecond);
+BENCHMARK(NRLMSISE00Grid_GetDensityAt_LEOTrajectory_Cached)->Unit(benchmark::kMillisecond);
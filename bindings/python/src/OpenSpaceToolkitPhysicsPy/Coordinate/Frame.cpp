@@ -195,6 +195,24 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame(pybind11::module& aModule
                     Transform: Transformation.
             )doc"
         )
+        .def(
+            "get_transforms_to",
+            &Frame::getTransformsTo,
+            arg("frame"),
+            arg("instants"),
+            R"doc(
+                Get the transformations to another frame at multiple instants.
+
+                The frame tree is walked once and each provider is queried once with all instants.
+
+                Args:
+                    frame (Frame): Frame.
+                    instants (list[Instant]): Instants.
+
+                Returns:
+                    list[Transform]: Transformations, in the same order as the instants.
+            )doc"
+        )
 
         .def_static(
             "undefined",
@@ -22,10 +22,14 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Manager(pybind11::module&
 
             Manages the lifecycle and caching of reference frames. This is a singleton class.
 
+            Cached transforms are spread over independently locked shards, each bounded using CLOCK eviction.
+
             The following environment variable can be defined:
 
             - "OSTK_PHYSICS_FRAME_MANAGER_MAX_TRANSFORM_CACHE_SIZE" will override the default
-              maximum transform cache size (default: 1000)
+              maximum number of cached transforms (default: 16384)
+            - "OSTK_PHYSICS_FRAME_MANAGER_THREAD_LOCAL_TRANSFORM_CACHE_SIZE" will override the default
+              number of entries of the per-thread transform cache, 0 to disable it (default: 64)
         )doc"
     );
 
@@ -118,9 +122,20 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Manager(pybind11::module&
                 This removes all registered frames and clears the transform cache.
             )doc"
         )
+        .def(
+            "clear_cached_transforms",
+            &Manager::clearCachedTransforms,
+            R"doc(
+                Clear all cached transforms, including thread-local caches.
+
+                Should be called whenever data used by frame providers changes (e.g., Earth orientation parameters).
+            )doc"
+        )
         .def(
             "add_cached_transform",
-            &Manager::addCachedTransform,
+            overload_cast<const Shared<const Frame>&, const Shared<const Frame>&, const Instant&, const Transform&>(
+                &Manager::addCachedTransform
+            ),
             arg("from_frame"),
             arg("to_frame"),
             arg("instant"),
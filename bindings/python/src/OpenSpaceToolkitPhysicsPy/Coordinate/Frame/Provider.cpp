@@ -5,6 +5,7 @@
 #include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/Dynamic.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/IAU.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/IERS.cpp>
+#include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/Interpolated.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/Static.cpp>
 
 inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider(pybind11::module& aModule)
@@ -34,6 +35,17 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider(pybind11::module
             )doc"
         )
 
+        .def(
+            "is_time_invariant",
+            &Provider::isTimeInvariant,
+            R"doc(
+                Check if the provider is time invariant
+
+                Returns:
+                    bool: True if the provider returns the same transform at any instant
+            )doc"
+        )
+
         .def(
             "get_transform_at",
             &Provider::getTransformAt,
@@ -57,6 +69,7 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider(pybind11::module
     // Add objects to python "provider" submodules
     OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_Static(provider);
     OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_Dynamic(provider);
+    OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_Interpolated(provider);
     OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS(provider);
     OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IAU(provider);
 
@@ -1,8 +1,10 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/IERS/BulletinA.cpp>
+#include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/IERS/EarthOrientationParameters.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/IERS/Finals2000A.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/IERS/Manager.cpp>
+#include <OpenSpaceToolkitPhysicsPy/Coordinate/Frame/Provider/IERS/Snapshot.cpp>
 
 inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS(pybind11::module& aModule)
 {
@@ -13,4 +15,6 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS(pybind11::m
     OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_Manager(iers);
     OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_BulletinA(iers);
     OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_Finals2000A(iers);
+    OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_Snapshot(iers);
+    OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_EarthOrientationParameters(iers);
 }
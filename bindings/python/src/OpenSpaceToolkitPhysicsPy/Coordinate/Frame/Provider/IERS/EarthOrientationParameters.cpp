@@ -0,0 +1,140 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EarthOrientationParameters.hpp>
+
+inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_EarthOrientationParameters(
+    pybind11::module& aModule
+)
+{
+    using namespace pybind11;
+
+    using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
+
+    class_<EarthOrientationParameters> earthOrientationParameters(
+        aModule,
+        "EarthOrientationParameters",
+        R"doc(
+            Earth orientation parameters at a given instant.
+
+            Polar motion and UT1 - UTC come from a single source. LOD and celestial pole offsets are only published in
+            Finals 2000A, and are undefined when it does not cover the instant.
+
+        )doc"
+    );
+
+    enum_<EarthOrientationParameters::Source>(earthOrientationParameters, "Source")
+
+        .value(
+            "Undefined",
+            EarthOrientationParameters::Source::Undefined,
+            R"doc(
+                No source.
+            )doc"
+        )
+        .value(
+            "BulletinAObservation",
+            EarthOrientationParameters::Source::BulletinAObservation,
+            R"doc(
+                Bulletin A rapid service observations.
+            )doc"
+        )
+        .value(
+            "BulletinAPrediction",
+            EarthOrientationParameters::Source::BulletinAPrediction,
+            R"doc(
+                Bulletin A predictions.
+            )doc"
+        )
+        .value(
+            "Finals2000A",
+            EarthOrientationParameters::Source::Finals2000A,
+            R"doc(
+                Finals 2000A.
+            )doc"
+        )
+
+        ;
+
+    earthOrientationParameters
+
+        .def_readonly(
+            "source",
+            &EarthOrientationParameters::source,
+            R"doc(
+                Source of polar motion and UT1 - UTC.
+            )doc"
+        )
+        .def_readonly(
+            "polar_motion",
+            &EarthOrientationParameters::polarMotion,
+            R"doc(
+                Polar motion [asec].
+            )doc"
+        )
+        .def_readonly(
+            "ut1_minus_utc",
+            &EarthOrientationParameters::ut1MinusUtc,
+            R"doc(
+                UT1 - UTC [sec].
+            )doc"
+        )
+        .def_readonly(
+            "lod",
+            &EarthOrientationParameters::lod,
+            R"doc(
+                Length of day [ms].
+            )doc"
+        )
+        .def_readonly(
+            "dx",
+            &EarthOrientationParameters::dx,
+            R"doc(
+                Celestial pole offset dX wrt IAU2000A Nutation [amsec].
+            )doc"
+        )
+        .def_readonly(
+            "dy",
+            &EarthOrientationParameters::dy,
+            R"doc(
+                Celestial pole offset dY wrt IAU2000A Nutation [amsec].
+            )doc"
+        )
+
+        .def(
+            "is_defined",
+            &EarthOrientationParameters::isDefined,
+            R"doc(
+                Check if a source served polar motion and UT1 - UTC.
+
+                Returns:
+                    bool: True if defined.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &EarthOrientationParameters::Undefined,
+            R"doc(
+                Create undefined Earth orientation parameters.
+
+                Returns:
+                    EarthOrientationParameters: Undefined Earth orientation parameters.
+            )doc"
+        )
+        .def_static(
+            "string_from_source",
+            &EarthOrientationParameters::StringFromSource,
+            arg("source"),
+            R"doc(
+                Get string from source.
+
+                Args:
+                    source (EarthOrientationParameters.Source): Source.
+
+                Returns:
+                    str: String.
+            )doc"
+        )
+
+        ;
+}
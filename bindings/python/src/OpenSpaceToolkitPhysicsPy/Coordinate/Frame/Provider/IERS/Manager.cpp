@@ -8,9 +8,11 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_Manager(pyb
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Shared;
 
     using ostk::physics::coordinate::frame::provider::iers::Manager;
+    using ostk::physics::time::Instant;
     using BaseManager = ostk::physics::Manager;
 
     class_<Manager, BaseManager> manager(
@@ -75,6 +77,19 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_Manager(pyb
                     Finals2000A: Finals 2000A.
             )doc"
         )
+        .def(
+            "get_snapshot",
+            &Manager::getSnapshot,
+            R"doc(
+                Get snapshot of loaded bulletins.
+
+                The snapshot is immutable: hold on to it to get consistent Earth orientation parameters across a batch
+                of computations, even if bulletins are reloaded meanwhile.
+
+                Returns:
+                    Snapshot: Snapshot.
+            )doc"
+        )
         .def(
             "get_polar_motion_at",
             &Manager::getPolarMotionAt,
@@ -118,6 +133,38 @@ inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_Manager(pyb
             )doc"
         )
 
+        .def(
+            "get_eop_at",
+            overload_cast<const Instant&>(&Manager::getEopAt, const_),
+            arg("instant"),
+            R"doc(
+                Get Earth orientation parameters at instant.
+
+                Resolves the source once for polar motion, UT1 - UTC, LOD and celestial pole offsets.
+
+                Args:
+                    instant (Instant): Instant.
+
+                Returns:
+                    EarthOrientationParameters: Earth orientation parameters.
+            )doc"
+        )
+
+        .def(
+            "get_eop_at",
+            overload_cast<const Array<Instant>&>(&Manager::getEopAt, const_),
+            arg("instants"),
+            R"doc(
+                Get Earth orientation parameters at instants, all resolved against the same snapshot.
+
+                Args:
+                    instants (list[Instant]): Instants.
+
+                Returns:
+                    list[EarthOrientationParameters]: Earth orientation parameters.
+            )doc"
+        )
+
         .def(
             "load_bulletin_a",
             &Manager::loadBulletinA,
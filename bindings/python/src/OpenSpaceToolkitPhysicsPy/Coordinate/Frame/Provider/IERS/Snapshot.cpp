@@ -0,0 +1,177 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Snapshot.hpp>
+
+inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_IERS_Snapshot(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+    using ostk::core::type::Shared;
+
+    using ostk::physics::coordinate::frame::provider::iers::Snapshot;
+    using ostk::physics::time::Instant;
+
+    class_<Snapshot, Shared<Snapshot>>(
+        aModule,
+        "Snapshot",
+        R"doc(
+            Immutable set of IERS bulletins.
+
+            Published by the IERS manager, and replaced as a whole whenever a bulletin is loaded.
+            Hold on to it to get consistent Earth orientation parameters across a batch of computations.
+
+        )doc"
+    )
+
+        .def(
+            "is_defined",
+            &Snapshot::isDefined,
+            R"doc(
+                Check if snapshot holds at least one bulletin.
+
+                Returns:
+                    bool: True if defined.
+            )doc"
+        )
+        .def(
+            "has_bulletin_a",
+            &Snapshot::hasBulletinA,
+            R"doc(
+                Check if snapshot holds a Bulletin A.
+
+                Returns:
+                    bool: True if snapshot holds a Bulletin A.
+            )doc"
+        )
+        .def(
+            "has_finals_2000a",
+            &Snapshot::hasFinals2000A,
+            R"doc(
+                Check if snapshot holds a Finals 2000A.
+
+                Returns:
+                    bool: True if snapshot holds a Finals 2000A.
+            )doc"
+        )
+        .def(
+            "is_bulletin_a_resolved",
+            &Snapshot::isBulletinAResolved,
+            R"doc(
+                Check if loading Bulletin A was attempted.
+
+                Returns:
+                    bool: True if snapshot holds a Bulletin A, or if loading one was attempted.
+            )doc"
+        )
+        .def(
+            "is_finals_2000a_resolved",
+            &Snapshot::isFinals2000AResolved,
+            R"doc(
+                Check if loading Finals 2000A was attempted.
+
+                Returns:
+                    bool: True if snapshot holds a Finals 2000A, or if loading one was attempted.
+            )doc"
+        )
+        .def(
+            "is_covered_by_bulletin_a",
+            &Snapshot::isCoveredByBulletinA,
+            arg("instant"),
+            R"doc(
+                Check if Bulletin A covers an instant.
+
+                Args:
+                    instant (Instant): Instant.
+
+                Returns:
+                    bool: True if the Bulletin A observations or predictions contain the instant.
+            )doc"
+        )
+        .def(
+            "get_polar_motion_at",
+            &Snapshot::getPolarMotionAt,
+            arg("instant"),
+            R"doc(
+                Get polar motion at instant.
+
+                Args:
+                    instant (Instant): Instant.
+
+                Returns:
+                    np.ndarray: Polar motion.
+            )doc"
+        )
+        .def(
+            "get_ut1_minus_utc_at",
+            &Snapshot::getUt1MinusUtcAt,
+            arg("instant"),
+            R"doc(
+                Get UT1 - UTC at instant.
+
+                Args:
+                    instant (Instant): Instant.
+
+                Returns:
+                    float: UT1 - UTC [sec].
+            )doc"
+        )
+        .def(
+            "get_lod_at",
+            &Snapshot::getLodAt,
+            arg("instant"),
+            R"doc(
+                Get length of day at instant.
+
+                Args:
+                    instant (Instant): Instant.
+
+                Returns:
+                    float: Length of day [ms].
+            )doc"
+        )
+        .def(
+            "get_eop_at",
+            overload_cast<const Instant&>(&Snapshot::getEopAt, const_),
+            arg("instant"),
+            R"doc(
+                Get Earth orientation parameters at instant.
+
+                Polar motion and UT1 - UTC are resolved from a single source, LOD and celestial pole offsets are read
+                from Finals 2000A.
+
+                Args:
+                    instant (Instant): Instant.
+
+                Returns:
+                    EarthOrientationParameters: Earth orientation parameters.
+            )doc"
+        )
+        .def(
+            "get_eop_at",
+            overload_cast<const Array<Instant>&>(&Snapshot::getEopAt, const_),
+            arg("instants"),
+            R"doc(
+                Get Earth orientation parameters at instants.
+
+                Args:
+                    instants (list[Instant]): Instants.
+
+                Returns:
+                    list[EarthOrientationParameters]: Earth orientation parameters.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &Snapshot::Undefined,
+            R"doc(
+                Create an undefined snapshot, holding no bulletin.
+
+                Returns:
+                    Snapshot: Undefined snapshot.
+            )doc"
+        )
+
+        ;
+}
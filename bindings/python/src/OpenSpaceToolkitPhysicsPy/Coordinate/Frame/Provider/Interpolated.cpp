@@ -0,0 +1,131 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Interpolated.hpp>
+
+inline void OpenSpaceToolkitPhysicsPy_Coordinate_Frame_Provider_Interpolated(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::physics::coordinate::frame::Provider;
+    using ostk::physics::coordinate::frame::provider::Interpolated;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Interval;
+    using ostk::physics::unit::Angle;
+
+    class_<Interpolated, Shared<Interpolated>, Provider>(
+        aModule,
+        "Interpolated",
+        R"doc(
+            Interpolated provider.
+
+            Samples a wrapped provider over an interval on an adaptive grid, and interpolates between samples.
+            Queries outside the interval are forwarded to the wrapped provider.
+
+        )doc"
+    )
+
+        .def(
+            init<const Shared<const Provider>&, const Interval&, const Angle&, const Duration&, const Duration&>(),
+            arg("provider"),
+            arg("interval"),
+            arg("angular_tolerance"),
+            arg_v("maximum_step", Duration::Hours(1.0), "Duration.hours(1.0)"),
+            arg_v("minimum_step", Duration::Seconds(1.0), "Duration.seconds(1.0)"),
+            R"doc(
+                Constructor.
+
+                Args:
+                    provider (Provider): The provider to interpolate.
+                    interval (Interval): The interval over which the provider is sampled.
+                    angular_tolerance (Angle): The maximum orientation error at segment quarter points and midpoint.
+                    maximum_step (Duration): The initial (and largest) sampling step. Defaults to 1 hour.
+                    minimum_step (Duration): The smallest sampling step. Defaults to 1 second.
+
+            )doc"
+        )
+
+        .def(
+            "is_defined",
+            &Interpolated::isDefined,
+            R"doc(
+                Check if the Interpolated provider is defined
+
+                Returns:
+                    bool: True if defined
+            )doc"
+        )
+
+        .def(
+            "get_provider",
+            &Interpolated::accessProvider,
+            R"doc(
+                Get the interpolated provider.
+
+                Returns:
+                    Provider: The interpolated provider.
+            )doc"
+        )
+
+        .def(
+            "get_interval",
+            &Interpolated::getInterval,
+            R"doc(
+                Get the interpolation interval.
+
+                Returns:
+                    Interval: The interpolation interval.
+            )doc"
+        )
+
+        .def(
+            "get_angular_tolerance",
+            &Interpolated::getAngularTolerance,
+            R"doc(
+                Get the angular tolerance.
+
+                Returns:
+                    Angle: The angular tolerance.
+            )doc"
+        )
+
+        .def(
+            "get_maximum_angular_error",
+            &Interpolated::getMaximumAngularError,
+            R"doc(
+                Get the largest orientation error observed at segment probe points while sampling.
+
+                Returns:
+                    Angle: The largest observed orientation error.
+            )doc"
+        )
+
+        .def(
+            "get_node_count",
+            &Interpolated::getNodeCount,
+            R"doc(
+                Get the number of sampling nodes.
+
+                Returns:
+                    int: The number of sampling nodes.
+            )doc"
+        )
+
+        .def(
+            "get_transform_at",
+            &Interpolated::getTransformAt,
+            arg("instant"),
+            R"doc(
+                Get the transform at a given instant.
+
+                Args:
+                    instant (Instant): An instant
+
+                Returns:
+                    Transform: Transform
+            )doc"
+        )
+
+        ;
+}
@@ -1,27 +1,33 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/CSSISpaceWeather.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/Exponential.cpp>
+#include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/HarrisPriester.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/Manager.cpp>
 #include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/NRLMSISE00.cpp>
+#include <OpenSpaceToolkitPhysicsPy/Environment/Atmospheric/Earth/NRLMSISE00Grid.cpp>
 
 inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::module& aModule)
 {
     using namespace pybind11;
 
+    using ostk::core::container::Array;
     using ostk::core::type::Real;
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
     using ostk::physics::environment::atmospheric::Earth;
     using EarthGravityModel = ostk::physics::environment::gravitational::Earth;
 
     using ostk::physics::coordinate::Frame;
     using ostk::physics::coordinate::Position;
+    using ostk::physics::coordinate::PositionArray;
     using ostk::physics::coordinate::spherical::LLA;
     using ostk::physics::environment::object::Celestial;
     using ostk::physics::time::Instant;
@@ -59,6 +65,20 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::mo
                 R"doc(
                     Navy Research Lab Mass Spectrometer and Incoherent Scatter Radar Exosphere 2000.
                 )doc"
+            )
+            .value(
+                "NRLMSISE00Grid",
+                Earth::Type::NRLMSISE00Grid,
+                R"doc(
+                    NRLMSISE00, interpolated from cached density grids for faster evaluation.
+                )doc"
+            )
+            .value(
+                "HarrisPriester",
+                Earth::Type::HarrisPriester,
+                R"doc(
+                    Harris-Priester atmospheric density model with diurnal bulge, valid from 100 to 1000 km.
+                )doc"
             );
 
         enum_<Earth::InputDataType>(earth_class, "InputDataType")
@@ -232,6 +252,88 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::mo
                 )doc"
             )
 
+            .def(
+                "get_densities_at",
+                [](const Earth& anEarth,
+                   const PositionArray::Matrix3Xd& aCoordinateMatrix,
+                   const Shared<const Frame>& aFrameSPtr,
+                   const Instant& anInstant,
+                   const Size& aThreadCount)
+                {
+                    return anEarth.getDensitiesAt(
+                        PositionArray::Meters(aCoordinateMatrix, aFrameSPtr), anInstant, aThreadCount
+                    );
+                },
+                arg("coordinates"),
+                arg("frame"),
+                arg("instant"),
+                arg("thread_count") = 1,
+                R"doc(
+                    Get the atmospheric density values at given positions and instant.
+
+                    The frame transform and the instant dependent model inputs are computed once for all positions.
+
+                    Args:
+                        coordinates (np.ndarray): Position coordinates, as a 3xN matrix [m].
+                        frame (Frame): The frame in which the coordinates are expressed.
+                        instant (Instant): An instant.
+                        thread_count (int): Number of threads evaluating the densities. Defaults to 1 (sequential).
+
+                    Returns:
+                        np.ndarray: Atmospheric density values [kg.m^-3].
+                )doc"
+            )
+
+            .def(
+                "get_densities_at",
+                [](const Earth& anEarth,
+                   const PositionArray::Matrix3Xd& aCoordinateMatrix,
+                   const Shared<const Frame>& aFrameSPtr,
+                   const Array<Instant>& anInstantArray,
+                   const Size& aThreadCount)
+                {
+                    return anEarth.getDensitiesAt(
+                        PositionArray::Meters(aCoordinateMatrix, aFrameSPtr), anInstantArray, aThreadCount
+                    );
+                },
+                arg("coordinates"),
+                arg("frame"),
+                arg("instants"),
+                arg("thread_count") = 1,
+                R"doc(
+                    Get the atmospheric density values at given positions, each position at its associated instant.
+
+                    Args:
+                        coordinates (np.ndarray): Position coordinates, as a 3xN matrix [m].
+                        frame (Frame): The frame in which the coordinates are expressed.
+                        instants (list[Instant]): Instants, either one or one per position.
+                        thread_count (int): Number of threads evaluating the densities. Defaults to 1 (sequential).
+
+                    Returns:
+                        np.ndarray: Atmospheric density values [kg.m^-3].
+                )doc"
+            )
+
+            .def(
+                "get_density_and_gradient_at",
+                &Earth::getDensityAndGradientAt,
+                arg("position"),
+                arg("instant"),
+                R"doc(
+                    Get the atmospheric density value and its gradient with respect to position at a given position
+                    and instant.
+
+                    The gradient is expressed in the frame of the position.
+
+                    Args:
+                        position (Position): A position.
+                        instant (Instant): An instant.
+
+                    Returns:
+                        tuple[float, np.ndarray]: Atmospheric density value [kg.m^-3] and its gradient [kg.m^-4].
+                )doc"
+            )
+
             ;
     }
 
@@ -241,5 +343,7 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth(pybind11::mo
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_CSSISpaceWeather(earth);
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_Manager(earth);
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_Exponential(earth);
+    OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_HarrisPriester(earth);
     OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_NRLMSISE00(earth);
+    OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_NRLMSISE00Grid(earth);
 }
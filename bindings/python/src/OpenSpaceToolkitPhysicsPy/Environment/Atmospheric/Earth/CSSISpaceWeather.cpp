@@ -155,6 +155,24 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_CSSISpaceWea
                     Reading: Last Reading satisfying predicate.
             )doc"
         )
+        .def(
+            "access_last_reading_with_defined",
+            &CSSISpaceWeather::accessLastReadingWithDefined,
+            arg("field"),
+            arg("instant"),
+            R"doc(
+                Access last reading before an Instant where a Field is defined.
+
+                Read in constant time from indices precomputed at load time.
+
+                Args:
+                    field (CSSISpaceWeather.Field): A reading field.
+                    instant (Instant): An instant.
+
+                Returns:
+                    Reading: Last Reading defining field.
+            )doc"
+        )
 
         .def_static(
             "undefined",
@@ -197,6 +215,53 @@ inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_CSSISpaceWea
 
         ;
 
+    enum_<CSSISpaceWeather::Field>(
+        CSSISpaceWeatherClass,
+        "Field",
+        R"doc(
+            Reading fields which can be extrapolated from the last reading defining them.
+
+        )doc"
+    )
+
+        .value(
+            "Kp3Hour",
+            CSSISpaceWeather::Field::Kp3Hour,
+            R"doc(
+                The 8 3-hour Kp indices.
+            )doc"
+        )
+        .value(
+            "Ap3Hour",
+            CSSISpaceWeather::Field::Ap3Hour,
+            R"doc(
+                The 8 3-hour Ap indices.
+            )doc"
+        )
+        .value(
+            "ApDaily",
+            CSSISpaceWeather::Field::ApDaily,
+            R"doc(
+                Daily average Ap index.
+            )doc"
+        )
+        .value(
+            "F107Obs",
+            CSSISpaceWeather::Field::F107Obs,
+            R"doc(
+                Observed F10.7 solar flux.
+            )doc"
+        )
+        .value(
+            "F107ObsCenter81",
+            CSSISpaceWeather::Field::F107ObsCenter81,
+            R"doc(
+                Centered 81-day average of observed F10.7 solar flux.
+            )doc"
+        )
+
+        ;
+
     class_<CSSISpaceWeather::Reading>(
         CSSISpaceWeatherClass,
         "Reading",
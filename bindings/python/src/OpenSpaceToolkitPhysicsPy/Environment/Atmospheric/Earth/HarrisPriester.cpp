@@ -0,0 +1,93 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+
+inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_HarrisPriester(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Integer;
+    using ostk::core::type::Real;
+    using ostk::core::type::Shared;
+
+    using ostk::physics::coordinate::Frame;
+    using ostk::physics::coordinate::spherical::LLA;
+    using ostk::physics::environment::atmospheric::earth::HarrisPriester;
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Instant;
+    using ostk::physics::unit::Length;
+    using EarthGravityModel = ostk::physics::environment::gravitational::Earth;
+
+    class_<HarrisPriester, Shared<HarrisPriester>>(
+        aModule,
+        "HarrisPriester",
+        R"doc(
+            Harris-Priester atmospheric model.
+
+            Blends minimum and maximum density tables for mean solar activity with a cosine power of the angle to the
+            diurnal bulge apex, valid from 100 km to 1000 km.
+
+        )doc"
+    )
+
+        .def(
+            init<const Integer&, const Shared<const Frame>&, const Length&, const Real&, const Shared<Celestial>&>(),
+            arg("cosine_power") = 4,
+            arg_v("earth_frame", Frame::ITRF(), "Frame.ITRF()"),
+            arg_v("earth_radius", EarthGravityModel::WGS84.equatorialRadius_, "WGS84.equatorialRadius_"),
+            arg_v("earth_flattening", EarthGravityModel::WGS84.flattening_, "WGS84.flattening_"),
+            arg("sun_celestial") = nullptr,
+            R"doc(
+                Constructor.
+
+                Args:
+                    cosine_power (int, optional): Cosine power, from 2 (low inclination orbits) to 6 (polar orbits). Defaults to 4.
+                    earth_frame (Frame, optional): Earth frame. Defaults to Frame.ITRF().
+                    earth_radius (Length, optional): Earth radius [m]. Defaults to the WGS84 equatorial radius.
+                    earth_flattening (float, optional): Earth flattening. Defaults to the WGS84 flattening.
+                    sun_celestial (Celestial, optional): Sun celestial object. Defaults to None, using a mean Sun approximation.
+            )doc"
+        )
+
+        .def(
+            "is_defined",
+            &HarrisPriester::isDefined,
+            R"doc(
+                Check if the Harris-Priester atmospheric model is defined.
+
+                Returns:
+                    bool: True if defined.
+            )doc"
+        )
+
+        .def(
+            "get_cosine_power",
+            &HarrisPriester::getCosinePower,
+            R"doc(
+                Get the cosine power.
+
+                Returns:
+                    int: Cosine power.
+            )doc"
+        )
+
+        .def(
+            "get_density_at",
+            &HarrisPriester::getDensityAt,
+            arg("lla"),
+            arg("instant"),
+            R"doc(
+                Get the atmospheric density value at a given position and instant.
+
+                Args:
+                    lla (LLA): A position, expressed as latitude, longitude, altitude [deg, deg, m].
+                    instant (Instant): An instant.
+
+                Returns:
+                    float: Atmospheric density value [kg.m^-3].
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,140 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00Grid.hpp>
+
+inline void OpenSpaceToolkitPhysicsPy_Environment_Atmospheric_Earth_NRLMSISE00Grid(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+    using ostk::core::type::Size;
+
+    using ostk::physics::coordinate::spherical::LLA;
+    using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
+    using ostk::physics::environment::atmospheric::earth::NRLMSISE00Grid;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Length;
+
+    class_<NRLMSISE00Grid, Shared<NRLMSISE00Grid>>(
+        aModule,
+        "NRLMSISE00Grid",
+        R"doc(
+            Gridded NRLMSISE00 atmospheric model.
+
+            Interpolates the logarithm of the NRLMSISE00 density over altitude, latitude, local solar time and time,
+            from grids evaluated lazily per time bucket and kept in a bounded cache.
+
+        )doc"
+    )
+
+        .def(
+            init<
+                const NRLMSISE00&,
+                const Length&,
+                const Length&,
+                const Length&,
+                const Angle&,
+                const Duration&,
+                const Duration&,
+                const Size&>(),
+            arg_v("nrlmsise00_model", NRLMSISE00(), "NRLMSISE00()"),
+            arg_v("minimum_altitude", Length::Kilometers(100.0), "Length.kilometers(100.0)"),
+            arg_v("maximum_altitude", Length::Kilometers(1000.0), "Length.kilometers(1000.0)"),
+            arg_v("altitude_step", Length::Kilometers(5.0), "Length.kilometers(5.0)"),
+            arg_v("latitude_step", Angle::Degrees(10.0), "Angle.degrees(10.0)"),
+            arg_v("local_solar_time_step", Duration::Hours(1.0), "Duration.hours(1.0)"),
+            arg_v("bucket_duration", Duration::Hours(3.0), "Duration.hours(3.0)"),
+            arg("capacity") = 64,
+            R"doc(
+                Constructor.
+
+                Args:
+                    nrlmsise00_model (NRLMSISE00, optional): NRLMSISE00 atmospheric model. Defaults to NRLMSISE00().
+                    minimum_altitude (Length, optional): Minimum gridded altitude. Defaults to 100 km.
+                    maximum_altitude (Length, optional): Maximum gridded altitude. Defaults to 1000 km.
+                    altitude_step (Length, optional): Altitude step. Defaults to 5 km.
+                    latitude_step (Angle, optional): Latitude step. Defaults to 10 deg.
+                    local_solar_time_step (Duration, optional): Local solar time step. Defaults to 1 hour.
+                    bucket_duration (Duration, optional): Bucket duration, dividing a day. Defaults to 3 hours.
+                    capacity (int, optional): Maximum number of cached buckets. Defaults to 64.
+            )doc"
+        )
+
+        .def(
+            "is_defined",
+            &NRLMSISE00Grid::isDefined,
+            R"doc(
+                Check if the gridded NRLMSISE00 atmospheric model is defined.
+
+                Returns:
+                    bool: True if defined.
+            )doc"
+        )
+
+        .def(
+            "get_cached_bucket_count",
+            &NRLMSISE00Grid::getCachedBucketCount,
+            R"doc(
+                Get the number of cached buckets.
+
+                Returns:
+                    int: Number of cached buckets.
+            )doc"
+        )
+
+        .def(
+            "get_evaluated_node_count",
+            &NRLMSISE00Grid::getEvaluatedNodeCount,
+            R"doc(
+                Get the number of evaluated grid nodes, over all cached buckets.
+
+                Returns:
+                    int: Number of evaluated grid nodes.
+            )doc"
+        )
+
+        .def(
+            "get_density_at",
+            &NRLMSISE00Grid::getDensityAt,
+            arg("lla"),
+            arg("instant"),
+            R"doc(
+                Get the atmospheric density value at a given position and instant.
+
+                Args:
+                    lla (LLA): A position, expressed as latitude, longitude, altitude [deg, deg, m].
+                    instant (Instant): An instant.
+
+                Returns:
+                    float: Atmospheric density value [kg.m^-3].
+            )doc"
+        )
+
+        .def(
+            "compute_maximum_relative_error_at",
+            &NRLMSISE00Grid::computeMaximumRelativeErrorAt,
+            arg("instant"),
+            R"doc(
+                Compute the maximum relative interpolation error in the bucket of a given instant.
+
+                Args:
+                    instant (Instant): An instant.
+
+                Returns:
+                    float: Maximum relative error.
+            )doc"
+        )
+
+        .def(
+            "clear_cache",
+            &NRLMSISE00Grid::clearCache,
+            R"doc(
+                Clear the cached buckets.
+            )doc"
+        )
+
+        ;
+}
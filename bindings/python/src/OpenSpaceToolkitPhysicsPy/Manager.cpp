@@ -97,6 +97,43 @@ inline void OpenSpaceToolkitPhysicsPy_Manager(pybind11::module& aModule)
                 Clear the local repository.
             )doc"
         )
+        .def(
+            "is_background_refresh_active",
+            &Manager::isBackgroundRefreshActive,
+            R"doc(
+                Check if background refresh is active.
+
+                Returns:
+                    bool: True if background refresh is active.
+            )doc"
+        )
+        .def(
+            "refresh",
+            &Manager::refresh,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Refresh the manager data, fetching newer remote files if needed.
+            )doc"
+        )
+        .def(
+            "start_background_refresh",
+            &Manager::startBackgroundRefresh,
+            arg("period"),
+            R"doc(
+                Start refreshing the manager data in a background thread.
+
+                Args:
+                    period (Duration): Refresh period.
+            )doc"
+        )
+        .def(
+            "stop_background_refresh",
+            &Manager::stopBackgroundRefresh,
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Stop refreshing the manager data in the background.
+            )doc"
+        )
 
         ;
 }
@@ -16,6 +16,7 @@ from ostk.physics.time import Duration
 from ostk.physics.coordinate.frame.provider.iers import Manager
 from ostk.physics.coordinate.frame.provider.iers import BulletinA
 from ostk.physics.coordinate.frame.provider.iers import Finals2000A
+from ostk.physics.coordinate.frame.provider.iers import EarthOrientationParameters
 
 
 @pytest.fixture
@@ -119,6 +120,23 @@ class TestManager:
             == 0.43790000000000001
         )
 
+    def test_get_eop_at_success(self, manager: Manager):
+        instant = Instant.date_time(datetime(2020, 1, 1, 0, 0, 0), Scale.UTC)
+
+        eop = manager.get_eop_at(instant)
+
+        assert isinstance(eop, EarthOrientationParameters)
+        assert eop.is_defined()
+        assert eop.ut1_minus_utc == manager.get_ut1_minus_utc_at(instant)
+        assert (eop.polar_motion == manager.get_polar_motion_at(instant)).all()
+        assert eop.lod == manager.get_lod_at(instant)
+
+        eops = manager.get_eop_at([instant, instant + Duration.hours(6.0)])
+
+        assert len(eops) == 2
+        assert eops[0].source == eop.source
+        assert eops[0].ut1_minus_utc == eop.ut1_minus_utc
+
     def test_set_mode_success(self, manager: Manager):
         assert manager.get_mode() == Manager.Mode.Automatic
 
@@ -184,3 +184,29 @@ class TestManager:
         # Reverse transform should also be cached (eager caching)
         cached_reverse = manager.access_cached_transform(frame2, frame1, instant)
         assert cached_reverse.is_defined() is True
+
+    def test_clear_cached_transforms_success(
+        self,
+        manager: Manager,
+        static_provider: Static,
+    ):
+        frame1 = Frame.construct("TestFrame1", True, Frame.GCRF(), static_provider)
+        frame2 = Frame.construct("TestFrame2", True, Frame.GCRF(), static_provider)
+        instant = Instant.J2000()
+
+        transform = Transform.passive(
+            instant,
+            [1.0, 2.0, 3.0],
+            [0.0, 0.0, 0.0],
+            Quaternion.unit(),
+            [0.0, 0.0, 0.0],
+        )
+
+        manager.add_cached_transform(frame1, frame2, instant, transform)
+
+        assert manager.access_cached_transform(frame1, frame2, instant).is_defined() is True
+
+        manager.clear_cached_transforms()
+
+        assert manager.access_cached_transform(frame1, frame2, instant).is_defined() is False
+        assert manager.access_cached_transform(frame2, frame1, instant).is_defined() is False
@@ -56,6 +56,12 @@ class TestFrame:
     def test_get_transform_to(self, epoch: Instant, frame: Frame):
         assert frame.get_transform_to(frame=frame, instant=epoch) is not None
 
+    def test_get_transforms_to(self, epoch: Instant):
+        transforms = Frame.ITRF().get_transforms_to(frame=Frame.GCRF(), instants=[epoch, epoch])
+
+        assert len(transforms) == 2
+        assert transforms[0].get_instant() == epoch
+
     def test_undefined(self):
         assert Frame.undefined() is not None
 
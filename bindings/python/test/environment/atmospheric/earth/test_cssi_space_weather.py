@@ -119,6 +119,28 @@ class TestCSSISpaceWeather:
                 Instant.date_time(datetime(2029, 1, 1, 0, 0, 0), Scale.UTC),
             )
 
+    def test_access_last_reading_with_defined_success(
+        self, cssi_space_weather: CSSISpaceWeather
+    ):
+        reading: CSSISpaceWeather.Reading = (
+            cssi_space_weather.access_last_reading_with_defined(
+                CSSISpaceWeather.Field.Ap3Hour,
+                Instant.date_time(datetime(2023, 12, 1, 0, 0, 0), Scale.UTC),
+            )
+        )
+
+        assert reading.date.to_string() == "2023-08-03"
+        assert reading.f107_data_type == "PRD"
+
+    def test_access_last_reading_with_defined_failure(
+        self, cssi_space_weather: CSSISpaceWeather
+    ):
+        with pytest.raises(RuntimeError):
+            cssi_space_weather.access_last_reading_with_defined(
+                CSSISpaceWeather.Field.F107Obs,
+                Instant.date_time(datetime(2000, 1, 1, 0, 0, 0), Scale.UTC),
+            )
+
     def test_undefined_success(self):
         assert CSSISpaceWeather.undefined() is not None
 
@@ -0,0 +1,43 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Scale
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.coordinate.spherical import LLA
+
+from ostk.physics.environment.atmospheric.earth import HarrisPriester
+
+
+@pytest.fixture
+def harris_priester_model() -> HarrisPriester:
+    return HarrisPriester()
+
+
+class TestHarrisPriester:
+    def test_constructor_success(self, harris_priester_model: HarrisPriester):
+        assert isinstance(harris_priester_model, HarrisPriester)
+
+    def test_is_defined_success(self, harris_priester_model: HarrisPriester):
+        assert harris_priester_model.is_defined() is True
+
+    def test_get_cosine_power_success(self, harris_priester_model: HarrisPriester):
+        assert harris_priester_model.get_cosine_power() == 4
+
+    def test_get_density_at_success(self, harris_priester_model: HarrisPriester):
+        instant = Instant.date_time(DateTime.parse("2021-03-20 12:00:00"), Scale.UTC)
+
+        apex_density = harris_priester_model.get_density_at(
+            LLA(Angle.degrees(0.0), Angle.degrees(30.0), Length.kilometers(400.0)),
+            instant,
+        )
+        antapex_density = harris_priester_model.get_density_at(
+            LLA(Angle.degrees(0.0), Angle.degrees(-150.0), Length.kilometers(400.0)),
+            instant,
+        )
+
+        assert apex_density == pytest.approx(7.492e-12, rel=1e-4)
+        assert antapex_density == pytest.approx(2.249e-12, rel=1e-4)
@@ -0,0 +1,59 @@
+# Apache License 2.0
+
+import pytest
+
+from ostk.physics.time import Instant
+from ostk.physics.time import DateTime
+from ostk.physics.time import Duration
+from ostk.physics.time import Scale
+from ostk.physics.unit import Length
+from ostk.physics.unit import Angle
+from ostk.physics.coordinate.spherical import LLA
+
+from ostk.physics.environment.atmospheric.earth import NRLMSISE00
+from ostk.physics.environment.atmospheric.earth import NRLMSISE00Grid
+from ostk.physics.environment.atmospheric.earth import Manager
+
+
+@pytest.fixture
+def nrlmsise00_grid_model(nrlmsise00_model: NRLMSISE00) -> NRLMSISE00Grid:
+    return NRLMSISE00Grid(
+        nrlmsise00_model=nrlmsise00_model,
+        minimum_altitude=Length.kilometers(300.0),
+        maximum_altitude=Length.kilometers(600.0),
+        altitude_step=Length.kilometers(10.0),
+        latitude_step=Angle.degrees(10.0),
+        local_solar_time_step=Duration.hours(1.0),
+        bucket_duration=Duration.hours(3.0),
+        capacity=4,
+    )
+
+
+class TestNRLMSISE00Grid:
+    def test_constructor_success(self, nrlmsise00_grid_model: NRLMSISE00Grid):
+        assert isinstance(nrlmsise00_grid_model, NRLMSISE00Grid)
+
+    def test_is_defined_success(self, nrlmsise00_grid_model: NRLMSISE00Grid):
+        assert nrlmsise00_grid_model.is_defined() is True
+
+    def test_get_density_at_success(
+        self,
+        nrlmsise00_model: NRLMSISE00,
+        nrlmsise00_grid_model: NRLMSISE00Grid,
+        manager_with_cssi_space_weather: Manager,
+    ):
+        lla = LLA(Angle.degrees(0.0), Angle.degrees(0.0), Length.meters(500e3))
+        instant = Instant.date_time(DateTime.parse("2021-01-01 00:00:00"), Scale.UTC)
+
+        density = nrlmsise00_grid_model.get_density_at(lla, instant)
+
+        assert density == pytest.approx(
+            nrlmsise00_model.get_density_at(lla, instant), rel=1e-2
+        )
+        assert nrlmsise00_grid_model.get_cached_bucket_count() == 1
+        assert nrlmsise00_grid_model.get_evaluated_node_count() > 0
+        assert nrlmsise00_grid_model.compute_maximum_relative_error_at(instant) < 1e-2
+
+        nrlmsise00_grid_model.clear_cache()
+
+        assert nrlmsise00_grid_model.get_cached_bucket_count() == 0
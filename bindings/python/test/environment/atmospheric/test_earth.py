@@ -2,6 +2,7 @@
 
 import pathlib
 
+import numpy as np
 import pytest
 
 from ostk.core.filesystem import Path
@@ -229,3 +230,76 @@ class TestEarth:
         )
 
         assert density is not None
+
+    def test_get_densities_at_nrlmsise_success(
+        self,
+        earth_atmospheric_model_nrlmsise: EarthAtmosphericModel,
+        manager_with_cssi_space_weather: Manager,
+    ):
+        positions: list[Position] = [
+            Position.meters(
+                coordinates=LLA(
+                    Angle.degrees(latitude), Angle.degrees(40.0), Length.kilometers(500.0)
+                ).to_cartesian(
+                    ellipsoid_equatorial_radius=EarthGravitationalModel.WGS84.equatorial_radius,
+                    ellipsoid_flattening=EarthGravitationalModel.WGS84.flattening,
+                ),
+                frame=Frame.ITRF(),
+            )
+            for latitude in (-30.0, 0.0, 30.0)
+        ]
+        instant = Instant.date_time(DateTime.parse("2021-01-01 00:00:00"), Scale.UTC)
+
+        coordinates = np.column_stack(
+            [position.get_coordinates() for position in positions]
+        )
+
+        densities = earth_atmospheric_model_nrlmsise.get_densities_at(
+            coordinates=coordinates,
+            frame=Frame.ITRF(),
+            instant=instant,
+        )
+
+        assert densities.shape == (3,)
+
+        for position, density in zip(positions, densities):
+            assert density == pytest.approx(
+                earth_atmospheric_model_nrlmsise.get_density_at(position, instant),
+                rel=1e-9,
+            )
+
+        densities = earth_atmospheric_model_nrlmsise.get_densities_at(
+            coordinates=coordinates,
+            frame=Frame.ITRF(),
+            instants=[instant, instant, instant],
+        )
+
+        assert densities.shape == (3,)
+
+    def test_get_density_and_gradient_at_exponential_success(
+        self, earth_atmospheric_model_exponential: EarthAtmosphericModel
+    ):
+        position = Position.meters(
+            coordinates=LLA(
+                Angle.degrees(30.0), Angle.degrees(40.0), Length.kilometers(500.0)
+            ).to_cartesian(
+                ellipsoid_equatorial_radius=EarthGravitationalModel.WGS84.equatorial_radius,
+                ellipsoid_flattening=EarthGravitationalModel.WGS84.flattening,
+            ),
+            frame=Frame.ITRF(),
+        )
+        instant = Instant.J2000()
+
+        density, gradient = (
+            earth_atmospheric_model_exponential.get_density_and_gradient_at(
+                position=position,
+                instant=instant,
+            )
+        )
+
+        assert density == pytest.approx(
+            earth_atmospheric_model_exponential.get_density_at(position, instant),
+            rel=1e-9,
+        )
+        assert gradient.shape == (3,)
+        assert np.dot(gradient, position.get_coordinates()) < 0.0
@@ -5,6 +5,7 @@
 
 #include <memory>
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
@@ -28,9 +29,11 @@ namespace coordinate
 
 namespace iau = ostk::physics::coordinate::frame::provider::iau;
 
+using ostk::core::container::Array;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
 using ostk::core::type::String;
+using ostk::core::type::Uint64;
 using ostk::core::type::Uint8;
 
 using ostk::mathematics::object::Vector3d;
@@ -55,6 +58,8 @@ class Frame : public std::enable_shared_from_this<Frame>
 
     /// @brief Equality operator
     ///
+    /// Frames are equal if they share the same identifier, i.e. if they originate from the same registration.
+    ///
     /// @code
     ///     Frame::GCRF() == Frame::GCRF(); // True
     /// @endcode
@@ -139,6 +144,17 @@ class Frame : public std::enable_shared_from_this<Frame>
     /// @return Shared pointer to the transform provider
     Shared<const Provider> accessProvider() const;
 
+    /// @brief Get the identifier of the frame
+    ///
+    /// The identifier is process-unique and assigned when the frame is registered.
+    ///
+    /// @code
+    ///     Frame::GCRF()->getId();
+    /// @endcode
+    ///
+    /// @return Frame identifier
+    Uint64 getId() const;
+
     /// @brief Get the name of the frame
     ///
     /// @code
@@ -192,6 +208,20 @@ class Frame : public std::enable_shared_from_this<Frame>
     /// @return Transform from this frame to the target frame
     Transform getTransformTo(const Shared<const Frame>& aFrame, const Instant& anInstant) const;
 
+    /// @brief Get the transforms from this frame to another frame at given instants
+    ///
+    /// The frame tree is walked once, and each provider is queried once with the whole instant array.
+    /// Unlike `getTransformTo`, results are not stored in the frame manager transform cache.
+    ///
+    /// @code
+    ///     Frame::ITRF()->getTransformsTo(Frame::GCRF(), {Instant::J2000(), Instant::Now()});
+    /// @endcode
+    ///
+    /// @param [in] aFrame A shared pointer to the target frame
+    /// @param [in] anInstantArray An array of instants
+    /// @return Transforms from this frame to the target frame, in the same order as the instants
+    Array<Transform> getTransformsTo(const Shared<const Frame>& aFrame, const Array<Instant>& anInstantArray) const;
+
     /// @brief Construct an undefined frame
     ///
     /// @code
@@ -339,11 +369,13 @@ class Frame : public std::enable_shared_from_this<Frame>
    protected:
     /// @brief Constructor
     ///
+    /// @param [in] anId A frame identifier
     /// @param [in] aName A frame name
     /// @param [in] isQuasiInertial True if the frame is quasi-inertial
     /// @param [in] aParentFrame A shared pointer to the parent frame
     /// @param [in] aProvider A shared pointer to the transform provider
     Frame(
+        const Uint64 anId,
         const String& aName,
         bool isQuasiInertial,
         const Shared<const Frame>& aParentFrame,
@@ -357,6 +389,7 @@ class Frame : public std::enable_shared_from_this<Frame>
     Frame& operator=(const Frame& aFrame) = default;
 
    private:
+    Uint64 id_;
     String name_;
     bool quasiInertial_;
     Shared<const Frame> parentFrameSPtr_;
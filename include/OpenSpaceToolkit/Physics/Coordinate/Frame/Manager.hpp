@@ -3,16 +3,25 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Manager__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Manager__
 
+#include <array>
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Utility/AtomicShared.hpp>
 
 namespace ostk
 {
@@ -25,19 +34,78 @@ namespace frame
 
 using ostk::core::container::Array;
 using ostk::core::container::Map;
+using ostk::core::type::Index;
 using ostk::core::type::Shared;
 using ostk::core::type::Size;
 using ostk::core::type::String;
+using ostk::core::type::Uint64;
+using ostk::core::type::Uint8;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::frame::Provider;
 using ostk::physics::coordinate::Transform;
 using ostk::physics::time::Instant;
+using ostk::physics::utilities::AtomicShared;
 
 /// @brief Reference frame manager (thread-safe)
+///
+/// Cached transforms are spread over independently locked shards. Lookups only take a shared lock on a single
+/// shard, and each shard is bounded using CLOCK (second chance) eviction. Shard lookups are not lock-free: entries are
+/// evicted in place, and transforms are not trivially copyable, so an optimistic read could observe a transform being
+/// overwritten.
+///
+/// An optional direct-mapped thread-local cache sits in front of the shared cache, so that repeated lookups on a
+/// given thread do not touch shared state. Thread-local entries are invalidated through a global generation counter,
+/// bumped whenever frames are removed or cached transforms are cleared.
+///
+/// Registered frames, and the transform plans between them, are held in an immutable registry snapshot, swapped
+/// atomically on every change. Frame and transform plan lookups do not take the manager mutex: they load the current
+/// snapshot through AtomicShared, which is not lock-free either, but only holds its lock for a reference count update.
 
 class Manager
 {
    public:
+    /// @brief Transform plan between two frames.
+    ///
+    /// Ordered providers linking an origin frame and a destination frame through their common ancestor.
+    /// The transform from origin to destination is obtained by composing the destination providers, and composing
+    /// the inverse of the composed origin providers.
+
+    struct TransformPlan
+    {
+        Array<Shared<const Provider>> originProviders;       ///< Providers from origin frame up to common ancestor
+        Array<Shared<const Provider>> destinationProviders;  ///< Providers from destination frame up to common ancestor
+
+        /// @brief Get the transform from origin to destination at a given instant.
+        ///
+        /// @param [in] anInstant An instant
+        /// @return The transform from origin to destination
+
+        Transform getTransformAt(const Instant& anInstant) const;
+
+        /// @brief Get the transforms from origin to destination at given instants.
+        ///
+        /// Each provider is queried once with the whole instant array.
+        ///
+        /// @param [in] anInstantArray An array of instants
+        /// @return The transforms from origin to destination, in the same order as the instants
+
+        Array<Transform> getTransformsAt(const Array<Instant>& anInstantArray) const;
+    };
+
+    /// @brief Key identifying a parameterized built-in frame.
+    ///
+    /// Allows such frames to be looked up without formatting their name.
+
+    struct FrameKey
+    {
+        Uint8 kind;       ///< Frame kind, as defined by Frame
+        Instant epoch;    ///< Frame epoch
+        Uint8 parameter;  ///< Additional frame parameter (e.g., IAU theory)
+
+        bool operator==(const FrameKey& aFrameKey) const;
+    };
+
     Manager(const Manager& aManager) = delete;
 
     Manager& operator=(const Manager& aManager) = delete;
@@ -74,8 +142,45 @@ class Manager
 
     Array<String> getAllFrameNames() const;
 
+    /// @brief Access frame with the given key.
+    ///
+    /// @code
+    ///     Shared<const Frame> frameSPtr = Manager::Get().accessFrameWithKey(frameKey);
+    /// @endcode
+    ///
+    /// @param [in] aFrameKey A frame key
+    /// @return Shared pointer to the frame, nullptr if no frame is registered with this key
+
+    Shared<const Frame> accessFrameWithKey(const FrameKey& aFrameKey) const;
+
+    /// @brief Get the frame registry generation.
+    ///
+    /// Bumped whenever frames are removed, so that frame handles held outside of the manager can be revalidated.
+    ///
+    /// @code
+    ///     Uint64 generation = Manager::Get().getFrameRegistryGeneration();
+    /// @endcode
+    ///
+    /// @return The frame registry generation
+
+    Uint64 getFrameRegistryGeneration() const;
+
+    /// @brief Get the transform cache generation, incremented whenever cached transforms are invalidated.
+    ///
+    /// To be read before computing a transform which is then added to the cache.
+    ///
+    /// @code
+    ///     Uint64 generation = Manager::Get().getTransformCacheGeneration();
+    /// @endcode
+    ///
+    /// @return Transform cache generation
+
+    Uint64 getTransformCacheGeneration() const;
+
     /// @brief Access a cached transform between two frames at a given instant.
     ///
+    /// If only the reverse transform is cached, its inverse is returned.
+    ///
     /// @code
     ///     Transform transform = Manager::Get().accessCachedTransform(fromFrameSPtr, toFrameSPtr, instant);
     /// @endcode
@@ -89,6 +194,21 @@ class Manager
         const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
     ) const;
 
+    /// @brief Access the transform plan between two frames.
+    ///
+    /// @code
+    ///     Shared<const Manager::TransformPlan> planSPtr = Manager::Get().accessTransformPlan(fromFrameSPtr,
+    ///     toFrameSPtr);
+    /// @endcode
+    ///
+    /// @param [in] aFromFrameSPtr A shared pointer to the source frame
+    /// @param [in] aToFrameSPtr A shared pointer to the destination frame
+    /// @return Shared pointer to the transform plan, nullptr if not yet computed
+
+    Shared<const TransformPlan> accessTransformPlan(
+        const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr
+    ) const;
+
     /// @brief Add a frame to the manager.
     ///
     /// @code
@@ -99,6 +219,19 @@ class Manager
 
     void addFrame(const Shared<const Frame>& aFrameSPtr);
 
+    /// @brief Associate a key with a registered frame.
+    ///
+    /// Ignored if the frame is not registered (e.g., it was removed in the meantime).
+    ///
+    /// @code
+    ///     Manager::Get().addFrameKey(frameKey, frameSPtr);
+    /// @endcode
+    ///
+    /// @param [in] aFrameKey A frame key
+    /// @param [in] aFrameSPtr A shared pointer to the frame
+
+    void addFrameKey(const FrameKey& aFrameKey, const Shared<const Frame>& aFrameSPtr);
+
     /// @brief Remove a frame with the given name.
     ///
     /// @code
@@ -119,6 +252,8 @@ class Manager
 
     /// @brief Add a transform to the cache.
     ///
+    /// A single entry serves both directions, the reverse transform being computed lazily on access.
+    ///
     /// @code
     ///     Manager::Get().addCachedTransform(fromFrameSPtr, toFrameSPtr, instant, transform);
     /// @endcode
@@ -135,6 +270,58 @@ class Manager
         const Transform& aTransform
     );
 
+    /// @brief Add a transform to the cache, computed at a given transform cache generation.
+    ///
+    /// The transform is dropped if cached transforms were invalidated since that generation.
+    ///
+    /// @code
+    ///     const Uint64 generation = Manager::Get().getTransformCacheGeneration();
+    ///     const Transform transform = ...;
+    ///     Manager::Get().addCachedTransform(fromFrameSPtr, toFrameSPtr, instant, transform, generation);
+    /// @endcode
+    ///
+    /// @param [in] aFromFrameSPtr A shared pointer to the source frame
+    /// @param [in] aToFrameSPtr A shared pointer to the destination frame
+    /// @param [in] anInstant An instant
+    /// @param [in] aTransform A transform
+    /// @param [in] aGeneration The transform cache generation read before computing the transform
+
+    void addCachedTransform(
+        const Shared<const Frame>& aFromFrameSPtr,
+        const Shared<const Frame>& aToFrameSPtr,
+        const Instant& anInstant,
+        const Transform& aTransform,
+        const Uint64 aGeneration
+    );
+
+    /// @brief Clear all cached transforms, including thread-local caches.
+    ///
+    /// Should be called whenever data used by frame providers changes (e.g., Earth orientation parameters).
+    ///
+    /// @code
+    ///     Manager::Get().clearCachedTransforms();
+    /// @endcode
+
+    void clearCachedTransforms();
+
+    /// @brief Add a transform plan between two frames.
+    ///
+    /// The reverse plan (destination to source) is added as well.
+    ///
+    /// @code
+    ///     Manager::Get().addTransformPlan(fromFrameSPtr, toFrameSPtr, planSPtr);
+    /// @endcode
+    ///
+    /// @param [in] aFromFrameSPtr A shared pointer to the source frame
+    /// @param [in] aToFrameSPtr A shared pointer to the destination frame
+    /// @param [in] aTransformPlanSPtr A shared pointer to the transform plan
+
+    void addTransformPlan(
+        const Shared<const Frame>& aFromFrameSPtr,
+        const Shared<const Frame>& aToFrameSPtr,
+        const Shared<const TransformPlan>& aTransformPlanSPtr
+    );
+
     /// @brief Get the manager singleton.
     ///
     /// @code
@@ -146,14 +333,81 @@ class Manager
     static Manager& Get();
 
    private:
+    static constexpr Size TransformCacheShardCount = 16;
+
+    struct FrameKeyHasher
+    {
+        std::size_t operator()(const FrameKey& aFrameKey) const;
+    };
+
+    /// @brief Immutable frame registry snapshot, including the transform plans between registered frames
+
+    struct FrameRegistry
+    {
+        Map<String, Shared<const Frame>> frameMap;
+        std::unordered_map<FrameKey, Shared<const Frame>, FrameKeyHasher> keyedFrameMap;
+        Map<Uint64, Map<Uint64, Shared<const TransformPlan>>> transformPlans;  // Keyed by frame identifiers
+    };
+
+    /// @brief Transform cache key, with frame identifiers sorted so that both directions share the same key
+
+    struct TransformCacheKey
+    {
+        Uint64 firstFrameId;
+        Uint64 secondFrameId;
+        Instant instant;
+
+        bool operator==(const TransformCacheKey& aTransformCacheKey) const;
+    };
+
+    struct TransformCacheKeyHasher
+    {
+        std::size_t operator()(const TransformCacheKey& aTransformCacheKey) const;
+    };
+
+    struct TransformCacheEntry
+    {
+        Transform transform;
+        bool isFromFirstFrame;                 // True if transform is from first frame to second frame
+        mutable std::atomic<bool> referenced;  // CLOCK reference bit, set on every hit
+
+        TransformCacheEntry(const Transform& aTransform, bool fromFirstFrame);
+    };
+
+    typedef std::unordered_map<TransformCacheKey, TransformCacheEntry, TransformCacheKeyHasher> TransformCacheMap;
+
+    struct TransformCacheShard
+    {
+        mutable std::shared_mutex mutex;
+        TransformCacheMap entries;
+        std::vector<TransformCacheMap::value_type*> clock;  // Node pointers are stable across rehashes
+        Index clockHand = 0;
+    };
+
     Size maxTransformCacheSize_;
-    Map<String, Shared<const Frame>> frameMap_;
+    Size transformCacheShardCapacity_;
+    Size threadLocalTransformCacheSize_;
+
+    std::atomic<Uint64> generation_;
+    std::atomic<Uint64> frameRegistryGeneration_;
 
-    Map<const Frame*, Map<const Frame*, Map<Instant, Transform>>> transformCache_;
+    AtomicShared<const FrameRegistry> frameRegistry_;
+
+    mutable std::array<TransformCacheShard, TransformCacheShardCount> transformCacheShards_;
 
     mutable std::mutex mutex_;
 
-    Manager(const Size& aMaxTransformCacheSize);
+    Manager(const Size& aMaxTransformCacheSize, const Size& aThreadLocalTransformCacheSize);
+
+    Shared<const FrameRegistry> accessFrameRegistry() const;
+
+    void clearTransformCacheShards();
+
+    TransformCacheShard& accessTransformCacheShard(const TransformCacheKey& aTransformCacheKey) const;
+
+    static TransformCacheKey TransformCacheKeyFrom(
+        const Uint64 aFromFrameId, const Uint64 aToFrameId, const Instant& anInstant
+    );
 };
 
 }  // namespace frame
@@ -3,6 +3,8 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
@@ -15,6 +17,8 @@ namespace coordinate
 namespace frame
 {
 
+using ostk::core::container::Array;
+
 using ostk::physics::coordinate::Transform;
 using ostk::physics::time::Instant;
 
@@ -39,12 +43,30 @@ class Provider
     /// @return True if the provider is defined
     virtual bool isDefined() const = 0;
 
+    /// @brief Check if the provider is time invariant.
+    ///
+    /// A time invariant provider returns the same translation, velocity, orientation and angular velocity at any
+    /// instant. Transform plans fold chains of time invariant providers into a single precomputed transform.
+    ///
+    /// @return True if the provider is time invariant (defaults to false)
+    virtual bool isTimeInvariant() const;
+
     /// @brief Get the transform at a given instant.
     ///
     /// @param [in] anInstant An instant
     /// @return The transform at the given instant
 
     virtual Transform getTransformAt(const Instant& anInstant) const = 0;
+
+    /// @brief Get the transforms at given instants.
+    ///
+    /// Default implementation calls `getTransformAt` for each instant. Providers able to share work across
+    /// instants (time scale conversions, EOP lookups, ...) should override it.
+    ///
+    /// @param [in] anInstantArray An array of instants
+    /// @return The transforms at the given instants, in the same order
+
+    virtual Array<Transform> getTransformsAt(const Array<Instant>& anInstantArray) const;
 };
 
 }  // namespace frame
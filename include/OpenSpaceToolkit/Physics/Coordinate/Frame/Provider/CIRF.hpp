@@ -3,9 +3,14 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF__
 
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
 namespace ostk
 {
@@ -18,26 +23,45 @@ namespace frame
 namespace provider
 {
 
+using ostk::core::type::Real;
+
+using ostk::mathematics::object::Matrix3d;
+
 using ostk::physics::coordinate::frame::Provider;
 using ostk::physics::coordinate::Transform;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 
 /// @brief Celestial Intermediate Reference Frame (CIRF) provider
 ///
 /// Bias, precession-nutation
 ///
+/// In table mode, the CIP coordinates (X, Y) and the CIO locator s are evaluated from the IAU 2006/2000A series on a
+/// uniform TT grid (half-day spacing), then interpolated with an 8-point Lagrange polynomial. The interpolation error
+/// is below 1e-13 rad (0.02 microarcsecond) on X, Y and s. Grid values are computed lazily, by chunks of 32 days,
+/// and shared read-only across all table mode providers and threads.
+///
 /// @ref
 /// https://www.iers.org/SharedDocs/Publikationen/EN/IERS/Publications/tn/TechnNote36/tn36_174.pdf?__blob=publicationFile&v=1
 
 class CIRF : public Provider
 {
    public:
-    /// @brief Default constructor.
+    enum class Mode
+    {
+        Series,  /// Evaluate the IAU 2006/2000A series at each query
+        Table    /// Interpolate the IAU 2006/2000A series from a precomputed table
+    };
+
+    /// @brief Constructor.
     ///
     /// @code
     ///     CIRF provider;
+    ///     CIRF tableProvider(CIRF::Mode::Table);
     /// @endcode
-    CIRF();
+    ///
+    /// @param [in] aMode A mode (defaults to Series)
+    CIRF(const CIRF::Mode& aMode = CIRF::Mode::Series);
 
     /// @brief Destructor.
     virtual ~CIRF() override;
@@ -60,6 +84,15 @@ class CIRF : public Provider
     /// @return True if the CIRF provider is defined
     virtual bool isDefined() const override;
 
+    /// @brief Get the mode.
+    ///
+    /// @code
+    ///     CIRF::Mode mode = provider.getMode();
+    /// @endcode
+    ///
+    /// @return The mode
+    CIRF::Mode getMode() const;
+
     /// @brief Get the transform at a given instant.
     ///
     /// @code
@@ -69,6 +102,43 @@ class CIRF : public Provider
     /// @param [in] anInstant An instant
     /// @return The transform from GCRF to CIRF at the given instant
     virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+    /// @brief Get the transforms at given instants.
+    ///
+    /// Each instant is converted to TT once. In table mode, interpolation chunks are shared across instants.
+    ///
+    /// @code
+    ///     Array<Transform> transforms = provider.getTransformsAt(instants);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants
+    /// @return The transforms from GCRF to CIRF at the given instants, in the same order
+    virtual Array<Transform> getTransformsAt(const Array<Instant>& anInstantArray) const override;
+
+    /// @brief Precompute the table over a given interval.
+    ///
+    /// Optional: table chunks are otherwise computed on first use.
+    ///
+    /// @code
+    ///     CIRF::PrecomputeTable(Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Days(365.0)));
+    /// @endcode
+    ///
+    /// @param [in] anInterval An interval
+    static void PrecomputeTable(const Interval& anInterval);
+
+    /// @brief Compute the GCRF to CIRF direction cosine matrix, from a modified julian date in TT.
+    ///
+    /// @code
+    ///     Matrix3d dcm_CIRF_GCRF = CIRF::ComputeMatrix(instant.getModifiedJulianDate(Scale::TT), CIRF::Mode::Series);
+    /// @endcode
+    ///
+    /// @param [in] aModifiedJulianDate A modified julian date (TT)
+    /// @param [in] aMode A mode
+    /// @return The GCRF to CIRF direction cosine matrix
+    static Matrix3d ComputeMatrix(const Real& aModifiedJulianDate, const CIRF::Mode& aMode);
+
+   private:
+    CIRF::Mode mode_;
 };
 
 }  // namespace provider
@@ -0,0 +1,109 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientation__
+#define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientation__
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/CIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+
+using ostk::physics::coordinate::frame::Provider;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Instant;
+
+/// @brief Earth orientation (GCRF to ITRF) provider
+///
+/// Equivalent to the composition of the ITRF, TIRF and CIRF providers, evaluated in a single pass: time arguments
+/// and Earth orientation parameters are obtained once per instant, and the combined rotation matrix and angular
+/// velocity are formed directly, without intermediate transforms.
+///
+/// Substituted automatically for the CIRF / TIRF / ITRF provider chain when building frame transforms.
+
+class EarthOrientation : public Provider
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code
+    ///     EarthOrientation provider;
+    ///     EarthOrientation tableProvider(CIRF::Mode::Table);
+    /// @endcode
+    ///
+    /// @param [in] aCirfMode A CIRF mode, used for the bias-precession-nutation part (defaults to Series)
+    EarthOrientation(const CIRF::Mode& aCirfMode = CIRF::Mode::Series);
+
+    /// @brief Destructor.
+    virtual ~EarthOrientation() override;
+
+    /// @brief Clone the EarthOrientation provider.
+    ///
+    /// @code
+    ///     EarthOrientation* clonePtr = provider.clone();
+    /// @endcode
+    ///
+    /// @return A pointer to the cloned EarthOrientation provider
+    virtual EarthOrientation* clone() const override;
+
+    /// @brief Check if the EarthOrientation provider is defined.
+    ///
+    /// @code
+    ///     provider.isDefined(); // True
+    /// @endcode
+    ///
+    /// @return True if the EarthOrientation provider is defined
+    virtual bool isDefined() const override;
+
+    /// @brief Get the CIRF mode.
+    ///
+    /// @code
+    ///     CIRF::Mode mode = provider.getCirfMode();
+    /// @endcode
+    ///
+    /// @return The CIRF mode
+    CIRF::Mode getCirfMode() const;
+
+    /// @brief Get the transform at a given instant.
+    ///
+    /// @code
+    ///     Transform transform = provider.getTransformAt(Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return The transform from GCRF to ITRF at the given instant
+    virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+    /// @brief Get the transforms at given instants.
+    ///
+    /// Earth orientation parameters are resolved with a single IERS lookup for all instants.
+    ///
+    /// @code
+    ///     Array<Transform> transforms = provider.getTransformsAt(instants);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants
+    /// @return The transforms from GCRF to ITRF at the given instants, in the same order
+    virtual Array<Transform> getTransformsAt(const Array<Instant>& anInstantArray) const override;
+
+   private:
+    CIRF::Mode cirfMode_;
+};
+
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
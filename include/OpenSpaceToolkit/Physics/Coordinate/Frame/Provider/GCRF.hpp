@@ -57,6 +57,15 @@ class GCRF : public Provider
     /// @return True if the GCRF provider is defined
     virtual bool isDefined() const override;
 
+    /// @brief Check if the GCRF provider is time invariant.
+    ///
+    /// @code
+    ///     provider.isTimeInvariant(); // True
+    /// @endcode
+    ///
+    /// @return True
+    virtual bool isTimeInvariant() const override;
+
     /// @brief Get the transform at a given instant.
     ///
     /// @code
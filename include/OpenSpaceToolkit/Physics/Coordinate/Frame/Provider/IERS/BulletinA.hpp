@@ -3,6 +3,7 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_BulletinA__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_BulletinA__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
@@ -28,6 +29,7 @@ namespace iers
 
 namespace filesystem = ostk::core::filesystem;
 
+using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::filesystem::File;
 using ostk::core::type::Integer;
@@ -252,6 +254,18 @@ class BulletinA
     /// @return Bulletin A object
     static BulletinA Load(const filesystem::File& aFile);
 
+    /// @brief Load Bulletin A from file, through its binary cache
+    ///
+    /// The cache is a sidecar next to the file, rebuilt whenever the file changes.
+    ///
+    /// @code
+    ///     BulletinA bulletinA = BulletinA::LoadCached(file);
+    /// @endcode
+    ///
+    /// @param [in] aFile A file
+    /// @return Bulletin A object
+    static BulletinA LoadCached(const filesystem::File& aFile);
+
    private:
     Date releaseDate_;
     Instant lastModifiedTimestamp_;
@@ -260,12 +274,14 @@ class BulletinA
     Instant taiMinusUtcEpoch_;
 
     Interval observationInterval_;
-    Map<Integer, BulletinA::Observation> observations_;
+    Array<BulletinA::Observation> observations_;  ///< Sorted by MJD
 
     Interval predictionInterval_;
-    Map<Integer, BulletinA::Prediction> predictions_;
+    Array<BulletinA::Prediction> predictions_;  ///< Sorted by MJD
 
     BulletinA();
+
+    void setIntervals();
 };
 
 }  // namespace iers
@@ -0,0 +1,86 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EarthOrientationParameters__
+#define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EarthOrientationParameters__
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+namespace iers
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::String;
+
+using ostk::mathematics::object::Vector2d;
+
+/// @brief Earth orientation parameters at a given instant
+///
+/// Polar motion and UT1 - UTC come from a single source (see Source). LOD and celestial pole offsets are only
+/// published in Finals 2000A, and are undefined when it does not cover the instant.
+struct EarthOrientationParameters
+{
+    enum class Source
+    {
+        Undefined,             ///< No source
+        BulletinAObservation,  ///< Bulletin A rapid service observations
+        BulletinAPrediction,   ///< Bulletin A predictions
+        Finals2000A            ///< Finals 2000A
+    };
+
+    Source source;         ///< Source of polar motion and UT1 - UTC
+    Vector2d polarMotion;  ///< [asec] Polar motion (x, y)
+    Real ut1MinusUtc;      ///< [s] UT1 - UTC
+    Real lod;              ///< [ms] Length of day
+    Real dx;               ///< [amsec] Celestial pole offset dX wrt IAU2000A Nutation
+    Real dy;               ///< [amsec] Celestial pole offset dY wrt IAU2000A Nutation
+
+    /// @brief Check if Earth orientation parameters are defined
+    ///
+    /// @code
+    ///     earthOrientationParameters.isDefined();
+    /// @endcode
+    ///
+    /// @return True if a source served polar motion and UT1 - UTC
+    bool isDefined() const;
+
+    /// @brief Undefined factory function
+    ///
+    /// @code
+    ///     EarthOrientationParameters earthOrientationParameters = EarthOrientationParameters::Undefined();
+    /// @endcode
+    ///
+    /// @return Undefined Earth orientation parameters
+    static EarthOrientationParameters Undefined();
+
+    /// @brief Get string from source
+    ///
+    /// @code
+    ///     EarthOrientationParameters::StringFromSource(EarthOrientationParameters::Source::Finals2000A);
+    /// @endcode
+    ///
+    /// @param [in] aSource A source
+    /// @return String
+    static String StringFromSource(const EarthOrientationParameters::Source& aSource);
+};
+
+}  // namespace iers
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
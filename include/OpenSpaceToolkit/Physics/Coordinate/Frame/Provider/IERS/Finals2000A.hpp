@@ -3,14 +3,19 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Finals2000A__
 #define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Finals2000A__
 
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EarthOrientationParameters.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Date.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -31,14 +36,17 @@ namespace iers
 
 namespace filesystem = ostk::core::filesystem;
 
+using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::container::Pair;
 using ostk::core::filesystem::File;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 
 using ostk::mathematics::object::Vector2d;
 
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
 using ostk::physics::time::Date;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
@@ -49,6 +57,8 @@ using ostk::physics::time::Interval;
 /// This file (updated weekly) is the complete Earth orientation data set, since 1 January
 /// 1992 with 1 year of predictions. The nutation series in dX and dY uses the IAU 2000A Nutation Theory.
 ///
+/// Rows are stored contiguously, sorted by MJD, and indexed directly when daily (as in published files). Polar motion,
+/// UT1-UTC, LOD and celestial pole offsets are also stored as separate columns, for fast interpolation.
 /// @ref https://www.iers.org/IERS/EN/DataProducts/EarthOrientationData/eop.html -> finals.data (IAU2000)
 class Finals2000A
 {
@@ -156,6 +166,18 @@ class Finals2000A
     /// @return LOD
     Real getLodAt(const Instant& anInstant) const;
 
+    /// @brief Get Earth orientation parameters at Instant
+    ///
+    /// All parameters are interpolated within the same bracket of rows.
+    ///
+    /// @code
+    ///     EarthOrientationParameters earthOrientationParameters = finals2000A.getEopAt(anInstant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An Instant
+    /// @return Earth orientation parameters (undefined if Instant is not bracketed by rows)
+    EarthOrientationParameters getEopAt(const Instant& anInstant) const;
+
     /// @brief Get Data reading at instant
     ///
     /// @code
@@ -185,14 +207,38 @@ class Finals2000A
     /// @return Finals2000A object
     static Finals2000A Load(const filesystem::File& aFile);
 
+    /// @brief Load Finals2000A from file, through its binary cache
+    ///
+    /// The cache is a sidecar next to the file, rebuilt whenever the file changes.
+    ///
+    /// @code
+    ///     Finals2000A finals2000A = Finals2000A::LoadCached(file);
+    /// @endcode
+    ///
+    /// @param [in] aFile A file
+    /// @return Finals2000A object
+    static Finals2000A LoadCached(const filesystem::File& aFile);
+
    private:
     Instant lastModifiedTimestamp_;
     Interval span_;
-    Map<Real, Finals2000A::Data> data_;
+    Array<Finals2000A::Data> data_;
+    bool isDaily_;
+
+    // Columns (NaN when undefined)
+    std::vector<double> mjd_;
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> ut1MinusUtc_;
+    std::vector<double> lod_;
+    std::vector<double> dx_;
+    std::vector<double> dy_;
 
     Finals2000A();
 
-    Pair<const Finals2000A::Data*, const Finals2000A::Data*> accessDataRange(const Instant& anInstant) const;
+    Index lowerBoundIndexOf(const double aModifiedJulianDate) const;
+
+    bool accessBracket(const double aModifiedJulianDate, Index& aPreviousIndex, double& aRatio) const;
 };
 
 }  // namespace iers
@@ -9,14 +9,18 @@
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/BulletinA.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EarthOrientationParameters.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Finals2000A.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Snapshot.hpp>
 #include <OpenSpaceToolkit/Physics/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Utility/AtomicShared.hpp>
 
 #define OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_LOCAL_REPOSITORY \
     "./.open-space-toolkit/physics/data/coordinate/frame/provider/iers"
@@ -38,13 +42,17 @@ using ostk::core::container::Array;
 using ostk::core::filesystem::Directory;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
 
 using ostk::mathematics::object::Vector2d;
 
 using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
 using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
+using ostk::physics::coordinate::frame::provider::iers::Snapshot;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::utilities::AtomicShared;
 using BaseManager = ostk::physics::Manager;
 
 /// @brief IERS bulletins manager (thread-safe)
@@ -56,10 +64,18 @@ using BaseManager = ostk::physics::Manager;
 /// - "OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_LOCAL_REPOSITORY_LOCK_TIMEOUT"
 /// will override "DefaultLocalRepositoryLockTimeout"
 ///
+/// Loaded bulletins are published as an immutable snapshot, swapped atomically when a bulletin is loaded: Earth
+/// orientation queries do not take the manager mutex once both bulletins are available (loading the snapshot still
+/// takes the short internal lock of `AtomicShared`). Background refresh (see `startBackgroundRefresh`) keeps bulletins
+/// up to date without fetching on the querying thread.
+///
 /// @ref https://www.iers.org/IERS/EN/DataProducts/EarthOrientationData/eop.html
 class Manager : public BaseManager
 {
    public:
+    /// @brief Destructor (stops background refresh)
+    ~Manager() override;
+
     /// @brief Get Bulletin A directory
     ///
     /// @code
@@ -96,8 +112,23 @@ class Manager : public BaseManager
     /// @return Finals 2000A
     Finals2000A getFinals2000A() const;
 
+    /// @brief Get snapshot of loaded bulletins
+    ///
+    /// Loads bulletins first if needed, attempting each at most once until the next reset. The returned snapshot is
+    /// immutable: pin it to get consistent Earth orientation parameters across a batch of computations, even if
+    /// bulletins are reloaded meanwhile.
+    ///
+    /// @code
+    ///     Shared<const Snapshot> snapshotSPtr = Manager::Get().getSnapshot();
+    /// @endcode
+    ///
+    /// @return Shared pointer to snapshot
+    Shared<const Snapshot> getSnapshot() const;
+
     /// @brief Get polar motion at instant
     ///
+    /// Finals 2000A is only loaded if Bulletin A does not cover the instant.
+    ///
     /// @code
     ///     Vector2d polarMotion = Manager::Get().getPolarMotionAt(anInstant);
     /// @endcode
@@ -108,6 +139,8 @@ class Manager : public BaseManager
 
     /// @brief Get UT1 - UTC at instant
     ///
+    /// Finals 2000A is only loaded if Bulletin A does not cover the instant.
+    ///
     /// @code
     ///     Real ut1MinusUtc = Manager::Get().getUt1MinusUtcAt(anInstant);
     /// @endcode
@@ -126,6 +159,30 @@ class Manager : public BaseManager
     /// @return [ms] Length of day
     Real getLodAt(const Instant& anInstant) const;
 
+    /// @brief Get Earth orientation parameters at instant
+    ///
+    /// Resolves the source once for polar motion, UT1 - UTC, LOD and celestial pole offsets.
+    ///
+    /// @code
+    ///     EarthOrientationParameters earthOrientationParameters = Manager::Get().getEopAt(anInstant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return Earth orientation parameters
+    EarthOrientationParameters getEopAt(const Instant& anInstant) const;
+
+    /// @brief Get Earth orientation parameters at instants
+    ///
+    /// All instants are resolved against the same snapshot.
+    ///
+    /// @code
+    ///     Array<EarthOrientationParameters> earthOrientationParameters = Manager::Get().getEopAt(instants);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants
+    /// @return Array of Earth orientation parameters
+    Array<EarthOrientationParameters> getEopAt(const Array<Instant>& anInstantArray) const;
+
     /// @brief Load Bulletin A
     ///
     /// @code
@@ -189,24 +246,51 @@ class Manager : public BaseManager
     /// @return Reference to manager
     static Manager& Get();
 
-   private:
-    mutable BulletinA bulletinA_;
-    mutable Finals2000A finals2000A_;
-
+   protected:
+    /// @brief Default constructor
+    ///
+    /// @code
+    ///     Manager manager;
+    /// @endcode
     Manager();
 
+    /// @brief Fetch the latest Bulletin A from the remote into the local repository
+    ///
+    /// @code
+    ///     File bulletinAFile = manager.fetchLatestBulletinA_();
+    /// @endcode
+    ///
+    /// @return The fetched Bulletin A file
+    virtual File fetchLatestBulletinA_() const;
+
+    /// @brief Fetch the latest Finals 2000A from the remote into the local repository
+    ///
+    /// @code
+    ///     File finals2000AFile = manager.fetchLatestFinals2000A_();
+    /// @endcode
+    ///
+    /// @return The fetched Finals 2000A file
+    virtual File fetchLatestFinals2000A_() const;
+
+   private:
+    mutable AtomicShared<const Snapshot> snapshot_;  ///< Replaced under mutex_, read without it
+
     virtual void setup_() override;
 
+    virtual void refresh_() override;
+
     // const private methods that modify mutable members
     // none of these are mutex-protected, but are called exclusively by methods that are
     void loadBulletinA_(const BulletinA& aBulletinA) const;
     void loadFinals2000A_(const Finals2000A& aFinals2000A) const;
 
-    const BulletinA* accessBulletinA_() const;
-    const Finals2000A* accessFinals2000A_() const;
+    Shared<const BulletinA> accessBulletinA_() const;
+    Shared<const Finals2000A> accessFinals2000A_() const;
+
+    Shared<const Snapshot> getSnapshotAt_(const Instant& anInstant) const;
 
-    File fetchLatestBulletinA_() const;
-    File fetchLatestFinals2000A_() const;
+    void resolveBulletinA_() const;
+    void resolveFinals2000A_() const;
 };
 
 }  // namespace iers
@@ -0,0 +1,233 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot__
+#define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/BulletinA.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EarthOrientationParameters.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Finals2000A.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+namespace iers
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector2d;
+
+using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
+using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
+using ostk::physics::time::Instant;
+
+/// @brief Immutable set of IERS bulletins
+///
+/// Published by the IERS manager, and replaced as a whole whenever a bulletin is loaded. Readers query it without
+/// locking, and can hold on to it to get consistent Earth orientation parameters across a batch of computations.
+///
+/// Bulletin A rapid service observations are used first, then Bulletin A predictions, then Finals 2000A.
+///
+/// @ref https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
+class Snapshot
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     Snapshot snapshot = {std::make_shared<const BulletinA>(bulletinA), nullptr};
+    /// @endcode
+    ///
+    /// @param [in] aBulletinASPtr A shared pointer to a Bulletin A (can be null)
+    /// @param [in] aFinals2000ASPtr A shared pointer to a Finals 2000A (can be null)
+    Snapshot(const Shared<const BulletinA>& aBulletinASPtr, const Shared<const Finals2000A>& aFinals2000ASPtr);
+
+    /// @brief Constructor, recording which bulletins loading was attempted for
+    ///
+    /// A bulletin is resolved once loading it was attempted, whether or not it could be found: the IERS manager
+    /// does not try to load it again for queries against this snapshot.
+    ///
+    /// @code
+    ///     Snapshot snapshot = {std::make_shared<const BulletinA>(bulletinA), nullptr, true, true};
+    /// @endcode
+    ///
+    /// @param [in] aBulletinASPtr A shared pointer to a Bulletin A (can be null)
+    /// @param [in] aFinals2000ASPtr A shared pointer to a Finals 2000A (can be null)
+    /// @param [in] isBulletinAResolved True if loading Bulletin A was attempted
+    /// @param [in] isFinals2000AResolved True if loading Finals 2000A was attempted
+    Snapshot(
+        const Shared<const BulletinA>& aBulletinASPtr,
+        const Shared<const Finals2000A>& aFinals2000ASPtr,
+        const bool isBulletinAResolved,
+        const bool isFinals2000AResolved
+    );
+
+    /// @brief Check if snapshot is defined
+    ///
+    /// @code
+    ///     snapshot.isDefined();
+    /// @endcode
+    ///
+    /// @return True if snapshot holds at least one bulletin
+    bool isDefined() const;
+
+    /// @brief Check if snapshot holds a Bulletin A
+    ///
+    /// @code
+    ///     snapshot.hasBulletinA();
+    /// @endcode
+    ///
+    /// @return True if snapshot holds a Bulletin A
+    bool hasBulletinA() const;
+
+    /// @brief Check if snapshot holds a Finals 2000A
+    ///
+    /// @code
+    ///     snapshot.hasFinals2000A();
+    /// @endcode
+    ///
+    /// @return True if snapshot holds a Finals 2000A
+    bool hasFinals2000A() const;
+
+    /// @brief Check if loading Bulletin A was attempted
+    ///
+    /// @code
+    ///     snapshot.isBulletinAResolved();
+    /// @endcode
+    ///
+    /// @return True if snapshot holds a Bulletin A, or if loading one was attempted
+    bool isBulletinAResolved() const;
+
+    /// @brief Check if loading Finals 2000A was attempted
+    ///
+    /// @code
+    ///     snapshot.isFinals2000AResolved();
+    /// @endcode
+    ///
+    /// @return True if snapshot holds a Finals 2000A, or if loading one was attempted
+    bool isFinals2000AResolved() const;
+
+    /// @brief Check if Bulletin A covers an instant
+    ///
+    /// Polar motion and UT1 - UTC at a covered instant are read from Bulletin A, without Finals 2000A.
+    ///
+    /// @code
+    ///     snapshot.isCoveredByBulletinA(Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return True if the Bulletin A observations or predictions contain the instant
+    bool isCoveredByBulletinA(const Instant& anInstant) const;
+
+    /// @brief Access Bulletin A
+    ///
+    /// @code
+    ///     Shared<const BulletinA> bulletinASPtr = snapshot.accessBulletinA();
+    /// @endcode
+    ///
+    /// @return Shared pointer to Bulletin A (null if not held)
+    const Shared<const BulletinA>& accessBulletinA() const;
+
+    /// @brief Access Finals 2000A
+    ///
+    /// @code
+    ///     Shared<const Finals2000A> finals2000ASPtr = snapshot.accessFinals2000A();
+    /// @endcode
+    ///
+    /// @return Shared pointer to Finals 2000A (null if not held)
+    const Shared<const Finals2000A>& accessFinals2000A() const;
+
+    /// @brief Get polar motion at instant
+    ///
+    /// @code
+    ///     Vector2d polarMotion = snapshot.getPolarMotionAt(Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return [asec] Polar motion
+    Vector2d getPolarMotionAt(const Instant& anInstant) const;
+
+    /// @brief Get UT1 - UTC at instant
+    ///
+    /// @code
+    ///     Real ut1MinusUtc = snapshot.getUt1MinusUtcAt(Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return [sec] UT1 - UTC
+    Real getUt1MinusUtcAt(const Instant& anInstant) const;
+
+    /// @brief Get length of day at instant
+    ///
+    /// @code
+    ///     Real lod = snapshot.getLodAt(Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return [ms] Length of day
+    Real getLodAt(const Instant& anInstant) const;
+
+    /// @brief Get Earth orientation parameters at instant
+    ///
+    /// Polar motion and UT1 - UTC are resolved from a single source, LOD and celestial pole offsets are read from
+    /// Finals 2000A. Each bulletin is interpolated once.
+    ///
+    /// @code
+    ///     EarthOrientationParameters earthOrientationParameters = snapshot.getEopAt(Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return Earth orientation parameters
+    EarthOrientationParameters getEopAt(const Instant& anInstant) const;
+
+    /// @brief Get Earth orientation parameters at instants
+    ///
+    /// @code
+    ///     Array<EarthOrientationParameters> earthOrientationParameters = snapshot.getEopAt(instants);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants
+    /// @return Array of Earth orientation parameters
+    Array<EarthOrientationParameters> getEopAt(const Array<Instant>& anInstantArray) const;
+
+    /// @brief Undefined factory function
+    ///
+    /// @code
+    ///     Snapshot snapshot = Snapshot::Undefined();
+    /// @endcode
+    ///
+    /// @return Undefined snapshot, holding no bulletin
+    static Snapshot Undefined();
+
+   private:
+    Shared<const BulletinA> bulletinASPtr_;
+    Shared<const Finals2000A> finals2000ASPtr_;
+    bool isBulletinAResolved_;
+    bool isFinals2000AResolved_;
+};
+
+}  // namespace iers
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
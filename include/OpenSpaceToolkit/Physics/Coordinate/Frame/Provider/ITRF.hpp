@@ -66,6 +66,18 @@ class ITRF : public Provider
     /// @param [in] anInstant An instant
     /// @return The transform from TIRF to ITRF at the given instant
     virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+    /// @brief Get the transforms at given instants.
+    ///
+    /// Polar motion is resolved with a single IERS lookup for all instants.
+    ///
+    /// @code
+    ///     Array<Transform> transforms = provider.getTransformsAt(instants);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants
+    /// @return The transforms from TIRF to ITRF at the given instants, in the same order
+    virtual Array<Transform> getTransformsAt(const Array<Instant>& anInstantArray) const override;
 };
 
 }  // namespace provider
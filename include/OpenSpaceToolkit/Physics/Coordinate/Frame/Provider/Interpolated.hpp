@@ -0,0 +1,190 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_Interpolated__
+#define __OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_Interpolated__
+
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::Vector4d;
+
+using ostk::physics::coordinate::frame::Provider;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::unit::Angle;
+
+/// @brief Interpolated provider
+///
+/// Wraps another provider, sampling it once over an interval on an adaptive grid, and serving queries within that
+/// interval by interpolation:
+///     - orientation: cubic Hermite interpolation of the quaternion, followed by normalization,
+///     - translation and velocity: cubic Hermite interpolation of the translation, using the velocity as derivative,
+///     - angular velocity: linear interpolation.
+///
+/// Segments are bisected until the orientation error at their quarter points and midpoint, checked against the wrapped
+/// provider, is below the angular tolerance, or until they reach the minimum step. Queries outside the interval are
+/// forwarded to the wrapped provider.
+///
+/// Useful to speed up expensive providers (CIRF, TOD, TEME, SPICE based dynamic frames) on dense time grids.
+
+class Interpolated : public Provider
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code
+    ///     Interpolated provider(std::make_shared<CIRF>(), interval, Angle::Arcseconds(1e-6));
+    /// @endcode
+    ///
+    /// @param [in] aProviderSPtr A shared pointer to the provider to interpolate
+    /// @param [in] anInterval The interval over which the provider is sampled
+    /// @param [in] anAngularTolerance The maximum orientation error at segment probe points
+    /// @param [in] aMaximumStep The initial (and largest) sampling step
+    /// @param [in] aMinimumStep The smallest sampling step, below which segments are no longer bisected
+    Interpolated(
+        const Shared<const Provider>& aProviderSPtr,
+        const Interval& anInterval,
+        const Angle& anAngularTolerance,
+        const Duration& aMaximumStep = Duration::Hours(1.0),
+        const Duration& aMinimumStep = Duration::Seconds(1.0)
+    );
+
+    /// @brief Destructor.
+    virtual ~Interpolated() override;
+
+    /// @brief Clone the Interpolated provider.
+    ///
+    /// @code
+    ///     Interpolated* clonePtr = provider.clone();
+    /// @endcode
+    ///
+    /// @return A pointer to the cloned Interpolated provider
+    virtual Interpolated* clone() const override;
+
+    /// @brief Check if the Interpolated provider is defined.
+    ///
+    /// @code
+    ///     provider.isDefined(); // True
+    /// @endcode
+    ///
+    /// @return True if the Interpolated provider is defined
+    virtual bool isDefined() const override;
+
+    /// @brief Access the interpolated provider.
+    ///
+    /// @code
+    ///     Shared<const Provider> providerSPtr = provider.accessProvider();
+    /// @endcode
+    ///
+    /// @return A shared pointer to the interpolated provider
+    const Shared<const Provider>& accessProvider() const;
+
+    /// @brief Get the interpolation interval.
+    ///
+    /// @code
+    ///     Interval interval = provider.getInterval();
+    /// @endcode
+    ///
+    /// @return The interpolation interval
+    Interval getInterval() const;
+
+    /// @brief Get the angular tolerance.
+    ///
+    /// @code
+    ///     Angle tolerance = provider.getAngularTolerance();
+    /// @endcode
+    ///
+    /// @return The angular tolerance
+    Angle getAngularTolerance() const;
+
+    /// @brief Get the largest orientation error observed at segment probe points while sampling.
+    ///
+    /// This is below the angular tolerance, unless segments were limited by the minimum step.
+    ///
+    /// @code
+    ///     Angle error = provider.getMaximumAngularError();
+    /// @endcode
+    ///
+    /// @return The largest observed orientation error
+    Angle getMaximumAngularError() const;
+
+    /// @brief Get the number of sampling nodes.
+    ///
+    /// @code
+    ///     Size nodeCount = provider.getNodeCount();
+    /// @endcode
+    ///
+    /// @return The number of sampling nodes
+    Size getNodeCount() const;
+
+    /// @brief Get the transform at a given instant.
+    ///
+    /// @code
+    ///     Transform transform = provider.getTransformAt(Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return The interpolated transform, or the wrapped provider transform outside the interval
+    virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+   private:
+    struct Node
+    {
+        double time;                     ///< Seconds since interval start
+        Vector4d orientation;            ///< Quaternion (x, y, z, s), sign-aligned with the previous node
+        Vector3d translation;            ///< Translation
+        Vector3d velocity;               ///< Velocity
+        Vector3d angularVelocity;        ///< Angular velocity
+        Vector4d orientationDerivative;  ///< Finite difference estimate of the quaternion time derivative
+    };
+
+    Shared<const Provider> providerSPtr_;
+    Interval interval_;
+    Angle angularTolerance_;
+    Angle maximumAngularError_;
+    std::vector<Node> nodes_;
+
+    void sample(const Duration& aMaximumStep, const Duration& aMinimumStep);
+
+    Node nodeAt(const double aTime) const;
+
+    Transform interpolateAt(const Instant& anInstant, const double aTime) const;
+
+    static void ComputeOrientationDerivatives(std::vector<Node>& aNodeArray);
+};
+
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
@@ -62,6 +62,15 @@ class J2000 : public Provider
     /// @return True if the J2000 provider is defined
     virtual bool isDefined() const override;
 
+    /// @brief Check if the J2000 provider is time invariant.
+    ///
+    /// @code
+    ///     provider.isTimeInvariant(); // True
+    /// @endcode
+    ///
+    /// @return True
+    virtual bool isTimeInvariant() const override;
+
     /// @brief Get the IAU theory.
     ///
     /// @code
@@ -92,6 +101,7 @@ class J2000 : public Provider
 
    private:
     iau::Theory theory_;
+    Quaternion q_J2000_GCRF_;
 };
 
 }  // namespace provider
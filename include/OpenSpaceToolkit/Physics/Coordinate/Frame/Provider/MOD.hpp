@@ -68,6 +68,15 @@ class MOD : public Provider
     /// @return True if the MOD provider is defined
     virtual bool isDefined() const override;
 
+    /// @brief Check if the MOD provider is time invariant.
+    ///
+    /// @code
+    ///     provider.isTimeInvariant(); // True
+    /// @endcode
+    ///
+    /// @return True
+    virtual bool isTimeInvariant() const override;
+
     /// @brief Get the epoch.
     ///
     /// @code
@@ -89,6 +98,7 @@ class MOD : public Provider
 
    private:
     Instant epoch_;
+    Quaternion q_MOD_GCRF_;
 };
 
 }  // namespace provider
@@ -68,6 +68,18 @@ class TIRF : public Provider
     /// @param [in] anInstant An instant
     /// @return The transform from CIRF to TIRF at the given instant
     virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+    /// @brief Get the transforms at given instants.
+    ///
+    /// Earth orientation parameters are resolved with a single IERS lookup for all instants.
+    ///
+    /// @code
+    ///     Array<Transform> transforms = provider.getTransformsAt(instants);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants
+    /// @return The transforms from CIRF to TIRF at the given instants, in the same order
+    virtual Array<Transform> getTransformsAt(const Array<Instant>& anInstantArray) const override;
 };
 
 }  // namespace provider
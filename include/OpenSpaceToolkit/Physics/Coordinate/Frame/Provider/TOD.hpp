@@ -66,6 +66,15 @@ class TOD : public Provider
     /// @return True if the TOD provider is defined
     virtual bool isDefined() const override;
 
+    /// @brief Check if the TOD provider is time invariant.
+    ///
+    /// @code
+    ///     provider.isTimeInvariant(); // True
+    /// @endcode
+    ///
+    /// @return True
+    virtual bool isTimeInvariant() const override;
+
     /// @brief Get the epoch.
     ///
     /// @code
@@ -97,6 +106,7 @@ class TOD : public Provider
    private:
     Instant epoch_;
     iau::Theory theory_;
+    Quaternion q_TOD_GCRF_;
 };
 
 }  // namespace provider
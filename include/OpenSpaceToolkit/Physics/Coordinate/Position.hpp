@@ -3,6 +3,7 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Position__
 #define __OpenSpaceToolkit_Physics_Coordinate_Position__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
@@ -30,6 +31,7 @@ namespace coordinate
 
 #define DEFAULT_PRECISION Integer::Undefined()
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
 using ostk::core::type::Shared;
 using ostk::core::type::String;
@@ -249,6 +251,24 @@ class Position
         const spherical::LLA& aLLA, const Shared<const environment::object::Celestial>& aCelestialSPtr = nullptr
     );
 
+    /// @brief Convert positions to a different frame, each at its associated instant
+    ///
+    /// All positions must be expressed in the same frame. Frame transforms are computed in a single batch.
+    ///
+    /// @code
+    ///     Array<Position> positions = Position::InFrame(positionsInGcrf, Frame::ITRF(), instants);
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray An array of positions
+    /// @param [in] aFrameSPtr A shared pointer to the target frame
+    /// @param [in] anInstantArray An array of instants, one per position
+    /// @return Positions in the specified frame
+    static Array<Position> InFrame(
+        const Array<Position>& aPositionArray,
+        const Shared<const Frame>& aFrameSPtr,
+        const Array<Instant>& anInstantArray
+    );
+
    private:
     Vector3d coordinates_;
     Position::Unit unit_;
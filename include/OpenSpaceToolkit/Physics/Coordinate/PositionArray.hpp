@@ -0,0 +1,331 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_PositionArray__
+#define __OpenSpaceToolkit_Physics_Coordinate_PositionArray__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Position;
+using ostk::physics::time::Instant;
+
+class Frame;
+
+/// @brief Position array
+///
+/// Structure-of-arrays container for positions expressed in a single frame and a single unit. Coordinates are
+/// stored column-wise in a contiguous 3xN matrix, either owned by the array or viewed from an external buffer.
+/// Views do not own their coordinates: the viewed buffer must outlive the view and any of its copies.
+
+class PositionArray
+{
+   public:
+    typedef Position::Unit Unit;
+
+    typedef Eigen::Matrix<double, 3, Eigen::Dynamic> Matrix3Xd;
+    typedef Eigen::Map<const Matrix3Xd> ConstMatrix3XdMap;
+
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     PositionArray positionArray(coordinates, PositionArray::Unit::Meter, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, one position per column
+    /// @param [in] aUnit A unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    PositionArray(
+        const Matrix3Xd& aCoordinateMatrix, const PositionArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Constructor, taking ownership of the coordinate matrix
+    ///
+    /// @code
+    ///     PositionArray positionArray(std::move(coordinates), PositionArray::Unit::Meter, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, one position per column
+    /// @param [in] aUnit A unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    PositionArray(
+        Matrix3Xd&& aCoordinateMatrix, const PositionArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Equality operator
+    ///
+    /// @code
+    ///     positionArray == otherPositionArray; // True
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray A position array
+    /// @return True if position arrays are equal
+    bool operator==(const PositionArray& aPositionArray) const;
+
+    /// @brief Inequality operator
+    ///
+    /// @code
+    ///     positionArray != otherPositionArray; // False
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray A position array
+    /// @return True if position arrays are not equal
+    bool operator!=(const PositionArray& aPositionArray) const;
+
+    /// @brief Subscript operator
+    ///
+    /// @code
+    ///     Position position = positionArray[0];
+    /// @endcode
+    ///
+    /// @param [in] anIndex An index
+    /// @return Position at index
+    Position operator[](const Index& anIndex) const;
+
+    /// @brief Output stream operator
+    ///
+    /// @code
+    ///     std::cout << positionArray;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream
+    /// @param [in] aPositionArray A position array
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const PositionArray& aPositionArray);
+
+    /// @brief Check if position array is defined
+    ///
+    /// Coordinates are not scanned: a defined array may hold undefined (NaN) coordinates.
+    ///
+    /// @code
+    ///     PositionArray::Undefined().isDefined(); // False
+    /// @endcode
+    ///
+    /// @return True if position array is defined
+    bool isDefined() const;
+
+    /// @brief Check if position array is empty
+    ///
+    /// @code
+    ///     positionArray.isEmpty();
+    /// @endcode
+    ///
+    /// @return True if position array is empty
+    bool isEmpty() const;
+
+    /// @brief Check if position array is a view into an external buffer
+    ///
+    /// @code
+    ///     PositionArray::View(coordinates, PositionArray::Unit::Meter, Frame::GCRF()).isView(); // True
+    /// @endcode
+    ///
+    /// @return True if position array is a view
+    bool isView() const;
+
+    /// @brief Get number of positions
+    ///
+    /// @code
+    ///     positionArray.getSize();
+    /// @endcode
+    ///
+    /// @return Number of positions
+    Size getSize() const;
+
+    /// @brief Access coordinates
+    ///
+    /// @code
+    ///     positionArray.accessCoordinates();
+    /// @endcode
+    ///
+    /// @return Read-only map over the 3xN coordinate matrix
+    ConstMatrix3XdMap accessCoordinates() const;
+
+    /// @brief Access frame
+    ///
+    /// @code
+    ///     positionArray.accessFrame();
+    /// @endcode
+    ///
+    /// @return Shared pointer to frame
+    Shared<const Frame> accessFrame() const;
+
+    /// @brief Get coordinates
+    ///
+    /// @code
+    ///     positionArray.getCoordinates();
+    /// @endcode
+    ///
+    /// @return 3xN coordinate matrix
+    Matrix3Xd getCoordinates() const;
+
+    /// @brief Get unit
+    ///
+    /// @code
+    ///     positionArray.getUnit();
+    /// @endcode
+    ///
+    /// @return Unit
+    PositionArray::Unit getUnit() const;
+
+    /// @brief Get positions
+    ///
+    /// @code
+    ///     Array<Position> positions = positionArray.getPositions();
+    /// @endcode
+    ///
+    /// @return Array of positions
+    Array<Position> getPositions() const;
+
+    /// @brief Convert position array to a different unit
+    ///
+    /// @code
+    ///     positionArray.inUnit(PositionArray::Unit::Meter);
+    /// @endcode
+    ///
+    /// @param [in] aUnit A unit
+    /// @return Position array in the specified unit
+    PositionArray inUnit(const PositionArray::Unit& aUnit) const;
+
+    /// @brief Convert position array to meters
+    ///
+    /// @code
+    ///     positionArray.inMeters();
+    /// @endcode
+    ///
+    /// @return Position array in meters
+    PositionArray inMeters() const;
+
+    /// @brief Convert position array to a different frame at a given instant
+    ///
+    /// A single transform is computed and applied to all positions.
+    ///
+    /// @code
+    ///     positionArray.inFrame(Frame::ITRF(), Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @param [in] anInstant An instant
+    /// @return Position array in the specified frame
+    PositionArray inFrame(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const;
+
+    /// @brief Convert position array to a different frame, each position at its associated instant
+    ///
+    /// Transforms are computed in a single batch. A single instant is applied to all positions.
+    ///
+    /// @code
+    ///     positionArray.inFrame(Frame::ITRF(), instants);
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @param [in] anInstantArray An array of instants, one per position
+    /// @return Position array in the specified frame
+    PositionArray inFrame(const Shared<const Frame>& aFrameSPtr, const Array<Instant>& anInstantArray) const;
+
+    /// @brief Constructs an undefined position array
+    ///
+    /// @code
+    ///     PositionArray positionArray = PositionArray::Undefined();
+    /// @endcode
+    ///
+    /// @return Undefined position array
+    static PositionArray Undefined();
+
+    /// @brief Constructs a position array in meters
+    ///
+    /// @code
+    ///     PositionArray positionArray = PositionArray::Meters(coordinates, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, one position per column
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @return Position array in meters
+    static PositionArray Meters(const Matrix3Xd& aCoordinateMatrix, const Shared<const Frame>& aFrameSPtr);
+
+    /// @brief Constructs a position array from positions
+    ///
+    /// All positions must be expressed in the same frame. Positions are converted to the unit of the first one.
+    ///
+    /// @code
+    ///     PositionArray positionArray = PositionArray::FromPositions(positions);
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray An array of positions
+    /// @return Position array
+    static PositionArray FromPositions(const Array<Position>& aPositionArray);
+
+    /// @brief Constructs a position array viewing an external 3xN coordinate matrix, without copy
+    ///
+    /// @code
+    ///     PositionArray positionArray = PositionArray::View(coordinates, PositionArray::Unit::Meter, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, which must outlive the view
+    /// @param [in] aUnit A unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @return Position array view
+    static PositionArray View(
+        const Matrix3Xd& aCoordinateMatrix, const PositionArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Viewing a temporary coordinate matrix is not allowed, as it would not outlive the view
+    static PositionArray View(
+        Matrix3Xd&& aCoordinateMatrix, const PositionArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    ) = delete;
+
+    /// @brief Constructs a position array viewing an external column-major coordinate buffer, without copy
+    ///
+    /// @code
+    ///     PositionArray positionArray = PositionArray::View(data, size, PositionArray::Unit::Meter, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateBuffer A buffer of 3 * aSize coordinates (x0, y0, z0, x1, ...), which must outlive the
+    /// view
+    /// @param [in] aSize A number of positions
+    /// @param [in] aUnit A unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @return Position array view
+    static PositionArray View(
+        const double* aCoordinateBuffer,
+        const Size& aSize,
+        const PositionArray::Unit& aUnit,
+        const Shared<const Frame>& aFrameSPtr
+    );
+
+   private:
+    Matrix3Xd coordinates_;
+    const double* viewBufferPtr_;
+    Size viewSize_;
+    PositionArray::Unit unit_;
+    Shared<const Frame> frameSPtr_;
+
+    PositionArray(
+        const double* aCoordinateBuffer,
+        const Size& aSize,
+        const PositionArray::Unit& aUnit,
+        const Shared<const Frame>& aFrameSPtr
+    );
+};
+
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
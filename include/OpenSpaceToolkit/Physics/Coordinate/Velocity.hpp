@@ -3,6 +3,7 @@
 #ifndef __OpenSpaceToolkit_Physics_Coordinate_Velocity__
 #define __OpenSpaceToolkit_Physics_Coordinate_Velocity__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
@@ -22,6 +23,7 @@ namespace coordinate
 
 #define DEFAULT_PRECISION Integer::Undefined()
 
+using ostk::core::container::Array;
 using ostk::core::type::Integer;
 using ostk::core::type::Shared;
 using ostk::core::type::String;
@@ -186,6 +188,27 @@ class Velocity
     /// @return Velocity in meters per second
     static Velocity MetersPerSecond(const Vector3d& aCoordinateSet, const Shared<const Frame>& aFrameSPtr);
 
+    /// @brief Convert velocities to a different frame, each at its associated instant
+    ///
+    /// All velocities must be expressed in the same frame, as must all positions. Frame transforms are computed in
+    /// a single batch.
+    ///
+    /// @code
+    ///     Array<Velocity> velocities = Velocity::InFrame(velocitiesInGcrf, positionsInGcrf, Frame::ITRF(), instants);
+    /// @endcode
+    ///
+    /// @param [in] aVelocityArray An array of velocities
+    /// @param [in] aPositionArray An array of associated positions, one per velocity
+    /// @param [in] aFrameSPtr A shared pointer to the target frame
+    /// @param [in] anInstantArray An array of instants, one per velocity
+    /// @return Velocities in the specified frame
+    static Array<Velocity> InFrame(
+        const Array<Velocity>& aVelocityArray,
+        const Array<Position>& aPositionArray,
+        const Shared<const Frame>& aFrameSPtr,
+        const Array<Instant>& anInstantArray
+    );
+
     /// @brief Get the string representation of a velocity unit
     ///
     /// @code
@@ -202,6 +225,8 @@ class Velocity
     Shared<const Frame> frameSPtr_;  // [TBR] With Transform instead, as Frame is a function of time...
 
     static Derived::Unit DerivedUnitFromVelocityUnit(const Velocity::Unit& aUnit);
+
+    friend class VelocityArray;
 };
 
 }  // namespace coordinate
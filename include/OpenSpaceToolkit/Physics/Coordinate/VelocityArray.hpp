@@ -0,0 +1,332 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Coordinate_VelocityArray__
+#define __OpenSpaceToolkit_Physics_Coordinate_VelocityArray__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::PositionArray;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Instant;
+
+class Frame;
+
+/// @brief Velocity array
+///
+/// Structure-of-arrays counterpart of Velocity, see PositionArray for storage and view semantics.
+
+class VelocityArray
+{
+   public:
+    typedef Velocity::Unit Unit;
+
+    typedef PositionArray::Matrix3Xd Matrix3Xd;
+    typedef PositionArray::ConstMatrix3XdMap ConstMatrix3XdMap;
+
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     VelocityArray velocityArray(coordinates, VelocityArray::Unit::MeterPerSecond, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, one velocity per column
+    /// @param [in] aUnit A velocity unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    VelocityArray(
+        const Matrix3Xd& aCoordinateMatrix, const VelocityArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Constructor, taking ownership of the coordinate matrix
+    ///
+    /// @code
+    ///     VelocityArray velocityArray(std::move(coordinates), VelocityArray::Unit::MeterPerSecond, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, one velocity per column
+    /// @param [in] aUnit A velocity unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    VelocityArray(
+        Matrix3Xd&& aCoordinateMatrix, const VelocityArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Equality operator
+    ///
+    /// @code
+    ///     velocityArray == otherVelocityArray; // True
+    /// @endcode
+    ///
+    /// @param [in] aVelocityArray A velocity array
+    /// @return True if velocity arrays are equal
+    bool operator==(const VelocityArray& aVelocityArray) const;
+
+    /// @brief Inequality operator
+    ///
+    /// @code
+    ///     velocityArray != otherVelocityArray; // False
+    /// @endcode
+    ///
+    /// @param [in] aVelocityArray A velocity array
+    /// @return True if velocity arrays are not equal
+    bool operator!=(const VelocityArray& aVelocityArray) const;
+
+    /// @brief Subscript operator
+    ///
+    /// @code
+    ///     Velocity velocity = velocityArray[0];
+    /// @endcode
+    ///
+    /// @param [in] anIndex An index
+    /// @return Velocity at index
+    Velocity operator[](const Index& anIndex) const;
+
+    /// @brief Output stream operator
+    ///
+    /// @code
+    ///     std::cout << velocityArray;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream
+    /// @param [in] aVelocityArray A velocity array
+    /// @return A reference to output stream
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const VelocityArray& aVelocityArray);
+
+    /// @brief Check if velocity array is defined
+    ///
+    /// Coordinates are not scanned: a defined array may hold undefined (NaN) coordinates.
+    ///
+    /// @code
+    ///     VelocityArray::Undefined().isDefined(); // False
+    /// @endcode
+    ///
+    /// @return True if velocity array is defined
+    bool isDefined() const;
+
+    /// @brief Check if velocity array is empty
+    ///
+    /// @code
+    ///     velocityArray.isEmpty();
+    /// @endcode
+    ///
+    /// @return True if velocity array is empty
+    bool isEmpty() const;
+
+    /// @brief Check if velocity array is a view into an external buffer
+    ///
+    /// @code
+    ///     VelocityArray::View(coordinates, VelocityArray::Unit::MeterPerSecond, Frame::GCRF()).isView(); // True
+    /// @endcode
+    ///
+    /// @return True if velocity array is a view
+    bool isView() const;
+
+    /// @brief Get number of velocities
+    ///
+    /// @code
+    ///     velocityArray.getSize();
+    /// @endcode
+    ///
+    /// @return Number of velocities
+    Size getSize() const;
+
+    /// @brief Access coordinates
+    ///
+    /// @code
+    ///     velocityArray.accessCoordinates();
+    /// @endcode
+    ///
+    /// @return Read-only map over the 3xN coordinate matrix
+    ConstMatrix3XdMap accessCoordinates() const;
+
+    /// @brief Access frame
+    ///
+    /// @code
+    ///     velocityArray.accessFrame();
+    /// @endcode
+    ///
+    /// @return Shared pointer to frame
+    Shared<const Frame> accessFrame() const;
+
+    /// @brief Get coordinates
+    ///
+    /// @code
+    ///     velocityArray.getCoordinates();
+    /// @endcode
+    ///
+    /// @return 3xN coordinate matrix
+    Matrix3Xd getCoordinates() const;
+
+    /// @brief Get unit
+    ///
+    /// @code
+    ///     velocityArray.getUnit();
+    /// @endcode
+    ///
+    /// @return Velocity unit
+    VelocityArray::Unit getUnit() const;
+
+    /// @brief Get velocities
+    ///
+    /// @code
+    ///     Array<Velocity> velocities = velocityArray.getVelocities();
+    /// @endcode
+    ///
+    /// @return Array of velocities
+    Array<Velocity> getVelocities() const;
+
+    /// @brief Convert velocity array to a different unit
+    ///
+    /// @code
+    ///     velocityArray.inUnit(VelocityArray::Unit::MeterPerSecond);
+    /// @endcode
+    ///
+    /// @param [in] aUnit A velocity unit
+    /// @return Velocity array in the specified unit
+    VelocityArray inUnit(const VelocityArray::Unit& aUnit) const;
+
+    /// @brief Convert velocity array to a different frame at a given instant
+    ///
+    /// A single transform is computed and applied to all velocities.
+    ///
+    /// @code
+    ///     velocityArray.inFrame(positionArray, Frame::ITRF(), Instant::J2000());
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray The associated positions, one per velocity
+    /// @param [in] aFrameSPtr A shared pointer to the target frame
+    /// @param [in] anInstant An instant
+    /// @return Velocity array in the specified frame
+    VelocityArray inFrame(
+        const PositionArray& aPositionArray, const Shared<const Frame>& aFrameSPtr, const Instant& anInstant
+    ) const;
+
+    /// @brief Convert velocity array to a different frame, each velocity at its associated instant
+    ///
+    /// Transforms are computed in a single batch. A single instant is applied to all velocities.
+    ///
+    /// @code
+    ///     velocityArray.inFrame(positionArray, Frame::ITRF(), instants);
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray The associated positions, one per velocity
+    /// @param [in] aFrameSPtr A shared pointer to the target frame
+    /// @param [in] anInstantArray An array of instants, one per velocity
+    /// @return Velocity array in the specified frame
+    VelocityArray inFrame(
+        const PositionArray& aPositionArray,
+        const Shared<const Frame>& aFrameSPtr,
+        const Array<Instant>& anInstantArray
+    ) const;
+
+    /// @brief Construct an undefined velocity array
+    ///
+    /// @code
+    ///     VelocityArray velocityArray = VelocityArray::Undefined();
+    /// @endcode
+    ///
+    /// @return Undefined velocity array
+    static VelocityArray Undefined();
+
+    /// @brief Construct a velocity array in meters per second
+    ///
+    /// @code
+    ///     VelocityArray velocityArray = VelocityArray::MetersPerSecond(coordinates, Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, one velocity per column
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @return Velocity array in meters per second
+    static VelocityArray MetersPerSecond(const Matrix3Xd& aCoordinateMatrix, const Shared<const Frame>& aFrameSPtr);
+
+    /// @brief Construct a velocity array from velocities
+    ///
+    /// All velocities must be expressed in the same frame. Velocities are converted to the unit of the first one.
+    ///
+    /// @code
+    ///     VelocityArray velocityArray = VelocityArray::FromVelocities(velocities);
+    /// @endcode
+    ///
+    /// @param [in] aVelocityArray An array of velocities
+    /// @return Velocity array
+    static VelocityArray FromVelocities(const Array<Velocity>& aVelocityArray);
+
+    /// @brief Construct a velocity array viewing an external 3xN coordinate matrix, without copy
+    ///
+    /// @code
+    ///     VelocityArray velocityArray = VelocityArray::View(coordinates, VelocityArray::Unit::MeterPerSecond,
+    ///     Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateMatrix A 3xN coordinate matrix, which must outlive the view
+    /// @param [in] aUnit A velocity unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @return Velocity array view
+    static VelocityArray View(
+        const Matrix3Xd& aCoordinateMatrix, const VelocityArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    );
+
+    /// @brief Viewing a temporary coordinate matrix is not allowed, as it would not outlive the view
+    static VelocityArray View(
+        Matrix3Xd&& aCoordinateMatrix, const VelocityArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+    ) = delete;
+
+    /// @brief Construct a velocity array viewing an external column-major coordinate buffer, without copy
+    ///
+    /// @code
+    ///     VelocityArray velocityArray = VelocityArray::View(data, size, VelocityArray::Unit::MeterPerSecond,
+    ///     Frame::GCRF());
+    /// @endcode
+    ///
+    /// @param [in] aCoordinateBuffer A buffer of 3 * aSize coordinates (x0, y0, z0, x1, ...), which must outlive the
+    /// view
+    /// @param [in] aSize A number of velocities
+    /// @param [in] aUnit A velocity unit
+    /// @param [in] aFrameSPtr A shared pointer to a frame
+    /// @return Velocity array view
+    static VelocityArray View(
+        const double* aCoordinateBuffer,
+        const Size& aSize,
+        const VelocityArray::Unit& aUnit,
+        const Shared<const Frame>& aFrameSPtr
+    );
+
+   private:
+    Matrix3Xd coordinates_;
+    const double* viewBufferPtr_;
+    Size viewSize_;
+    VelocityArray::Unit unit_;
+    Shared<const Frame> frameSPtr_;
+
+    VelocityArray(
+        const double* aCoordinateBuffer,
+        const Size& aSize,
+        const VelocityArray::Unit& aUnit,
+        const Shared<const Frame>& aFrameSPtr
+    );
+};
+
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
+
+#endif
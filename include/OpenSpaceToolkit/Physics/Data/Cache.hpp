@@ -0,0 +1,178 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Data_Cache__
+#define __OpenSpaceToolkit_Physics_Data_Cache__
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Date.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace data
+{
+namespace cache
+{
+
+using ostk::core::filesystem::File;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+using ostk::core::type::Uint32;
+
+using ostk::physics::time::Date;
+
+/// @brief Binary cache payload writer
+///
+/// Values are written in native byte order, undefined reals as NaN.
+class Writer
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     cache::Writer writer;
+    /// @endcode
+    Writer();
+
+    void writeSize(const Size& aSize);
+
+    void writeInteger(const Integer& anInteger);
+
+    void writeReal(const Real& aReal);
+
+    void writeCharacter(const char aCharacter);
+
+    void writeString(const String& aString);
+
+    void writeDate(const Date& aDate);
+
+    /// @brief Write a column of values as a single block
+    ///
+    /// @param [in] aColumn A column
+    void writeColumn(const std::vector<double>& aColumn);
+
+    /// @brief Access written bytes
+    ///
+    /// @return Written bytes
+    const std::string& accessBuffer() const;
+
+   private:
+    std::string buffer_;
+
+    void write(const void* aValuePtr, const std::size_t aByteCount);
+};
+
+/// @brief Binary cache payload reader
+///
+/// Reads values in the order they were written. Throws if the payload is too short.
+class Reader
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     cache::Reader reader = {payload};
+    /// @endcode
+    ///
+    /// @param [in] aBuffer A payload
+    Reader(const std::string_view& aBuffer);
+
+    /// @brief Check if the whole payload has been read
+    ///
+    /// @return True if the whole payload has been read
+    bool isEnd() const;
+
+    Size readSize();
+
+    Integer readInteger();
+
+    Real readReal();
+
+    char readCharacter();
+
+    String readString();
+
+    Date readDate();
+
+    /// @brief Read a column of values written as a single block
+    ///
+    /// @param [out] aColumn A column
+    void readColumn(std::vector<double>& aColumn);
+
+   private:
+    std::string_view buffer_;
+    std::size_t position_;
+
+    void read(void* aValuePtr, const std::size_t aByteCount);
+};
+
+/// @brief Get the cache file of a source file
+///
+/// The cache is a sidecar next to the source file.
+///
+/// @code
+///     File cacheFile = cache::GetFile(finals2000AFile); // /path/to/finals2000A.data.cache
+/// @endcode
+///
+/// @param [in] aSourceFile A source file
+/// @return Cache file
+File GetFile(const File& aSourceFile);
+
+/// @brief Load the cache of a source file
+///
+/// The cache is used only if its format and content versions match, if it was built from the source file as it is
+/// now (same modification time and size), and if its checksum is valid. Otherwise, false is returned and the source
+/// file should be parsed.
+///
+/// @code
+///     const bool isLoaded = cache::Load(file, "Finals2000A", 1, [&](cache::Reader& aReader) { ... });
+/// @endcode
+///
+/// @param [in] aSourceFile A source file
+/// @param [in] aContentType A content type
+/// @param [in] aContentVersion A content version, to be incremented whenever the content layout changes
+/// @param [in] aDeserializer A function reading the content
+/// @return True if the cache was loaded
+bool Load(
+    const File& aSourceFile,
+    const String& aContentType,
+    const Uint32& aContentVersion,
+    const std::function<void(Reader&)>& aDeserializer
+);
+
+/// @brief Save the cache of a source file
+///
+/// The cache is written to a temporary file and renamed over the previous cache, so that concurrent readers never see
+/// a partial cache. Failures (e.g., read-only directory) are not errors.
+///
+/// @code
+///     cache::Save(file, "Finals2000A", 1, writer);
+/// @endcode
+///
+/// @param [in] aSourceFile A source file
+/// @param [in] aContentType A content type
+/// @param [in] aContentVersion A content version
+/// @param [in] aWriter A writer holding the content
+/// @return True if the cache was saved
+bool Save(const File& aSourceFile, const String& aContentType, const Uint32& aContentVersion, const Writer& aWriter);
+
+}  // namespace cache
+}  // namespace data
+}  // namespace physics
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,169 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Data_Parser__
+#define __OpenSpaceToolkit_Physics_Data_Parser__
+
+#include <cstddef>
+#include <string_view>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace data
+{
+namespace parser
+{
+
+using ostk::core::filesystem::File;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief Read-only memory mapping of a file
+///
+/// Data files are parsed in place: lines and fields are views into the mapping, and no allocation is made per line
+/// or per field.
+class MappedFile
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     MappedFile mappedFile = {file};
+    /// @endcode
+    ///
+    /// @param [in] aFile A file
+    MappedFile(const File& aFile);
+
+    MappedFile(const MappedFile& aMappedFile) = delete;
+
+    MappedFile& operator=(const MappedFile& aMappedFile) = delete;
+
+    /// @brief Destructor (unmaps the file)
+    ~MappedFile();
+
+    /// @brief Access file content
+    ///
+    /// @code
+    ///     std::string_view content = mappedFile.accessContent();
+    /// @endcode
+    ///
+    /// @return View of the file content, valid during the lifetime of the mapping
+    std::string_view accessContent() const;
+
+   private:
+    const char* data_;
+    std::size_t size_;
+};
+
+/// @brief Forward line reader over a buffer
+///
+/// Handles LF and CRLF line endings. Lines are views into the buffer.
+class LineReader
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     LineReader lineReader = {mappedFile.accessContent()};
+    /// @endcode
+    ///
+    /// @param [in] aBuffer A buffer
+    LineReader(const std::string_view& aBuffer);
+
+    /// @brief Read next line
+    ///
+    /// @code
+    ///     std::string_view line;
+    ///     while (lineReader.readLine(line)) { ... }
+    /// @endcode
+    ///
+    /// @param [out] aLine The next line, without line ending
+    /// @return False once the buffer is exhausted
+    bool readLine(std::string_view& aLine);
+
+   private:
+    std::string_view buffer_;
+    std::size_t position_;
+};
+
+/// @brief Trim leading and trailing whitespace
+///
+/// @param [in] aString A string
+/// @return Trimmed view
+std::string_view trim(const std::string_view& aString);
+
+/// @brief Get a fixed-width column of a line
+///
+/// Columns beyond the end of the line are empty.
+///
+/// @code
+///     std::string_view mjd = parser::fixedColumn(line, 8, 15);
+/// @endcode
+///
+/// @param [in] aLine A line
+/// @param [in] aStartColumnNumber A start column number (1-based, inclusive)
+/// @param [in] anEndColumnNumber An end column number (1-based, inclusive)
+/// @return Trimmed view of the column
+std::string_view fixedColumn(
+    const std::string_view& aLine, const Index& aStartColumnNumber, const Index& anEndColumnNumber
+);
+
+/// @brief Split a line on a delimiter
+///
+/// @code
+///     std::string_view fields[31];
+///     Size fieldCount = parser::splitDelimited(line, ',', fields, 31);
+/// @endcode
+///
+/// @param [in] aLine A line
+/// @param [in] aDelimiter A delimiter
+/// @param [out] aFieldArray Fields (untrimmed), filled up to the capacity
+/// @param [in] aFieldCapacity The capacity of the field array
+/// @return Number of fields in the line (can exceed the capacity)
+Size splitDelimited(
+    const std::string_view& aLine, const char aDelimiter, std::string_view* aFieldArray, const Size aFieldCapacity
+);
+
+/// @brief Split a line on runs of whitespace
+///
+/// @code
+///     std::string_view words[33];
+///     Size wordCount = parser::splitWhitespace(line, words, 33);
+/// @endcode
+///
+/// @param [in] aLine A line
+/// @param [out] aWordArray Words, filled up to the capacity
+/// @param [in] aWordCapacity The capacity of the word array
+/// @return Number of words in the line (can exceed the capacity)
+Size splitWhitespace(const std::string_view& aLine, std::string_view* aWordArray, const Size aWordCapacity);
+
+/// @brief Parse an integer
+///
+/// The whole string (after trimming) must be consumed.
+///
+/// @param [in] aString A string
+/// @param [out] anInteger The parsed integer
+/// @return True if parsed
+bool parseInteger(const std::string_view& aString, int& anInteger);
+
+/// @brief Parse a real number
+///
+/// The whole string (after trimming) must be consumed. Leading "+" and missing leading zeros (".5", "-.5") are
+/// accepted.
+///
+/// @param [in] aString A string
+/// @param [out] aReal The parsed real number
+/// @return True if parsed
+bool parseReal(const std::string_view& aString, double& aReal);
+
+}  // namespace parser
+}  // namespace data
+}  // namespace physics
+}  // namespace ostk
+
+#endif
@@ -3,12 +3,18 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth__
 #define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth__
 
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Model.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
@@ -25,13 +31,20 @@ namespace environment
 namespace atmospheric
 {
 
+using ostk::core::container::Array;
+using ostk::core::container::Pair;
 using ostk::core::filesystem::Directory;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::Unique;
 
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::PositionArray;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::environment::atmospheric::Model;
 using ostk::physics::environment::object::Celestial;
@@ -45,9 +58,11 @@ class Earth : public Model
    public:
     enum class Type
     {
-        Undefined,    ///< Undefined
-        Exponential,  ///< Exponential atmospheric density model, valid up to 1000 km
-        NRLMSISE00,   ///< Navy Research Lab Mass Spectrometer and Incoherent Scatter Radar Exosphere 2000
+        Undefined,       ///< Undefined
+        Exponential,     ///< Exponential atmospheric density model, valid up to 1000 km
+        NRLMSISE00,      ///< Navy Research Lab Mass Spectrometer and Incoherent Scatter Radar Exosphere 2000
+        NRLMSISE00Grid,  ///< NRLMSISE00, interpolated from cached density grids for faster evaluation
+        HarrisPriester,  ///< Harris-Priester atmospheric density model with diurnal bulge, valid from 100 to 1000 km
     };
 
     enum class InputDataType
@@ -195,6 +210,53 @@ class Earth : public Model
     /// @return Atmospheric density value [kg.m^-3]
     Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
 
+    /// @brief Get the atmospheric density value and its gradient at a given position and instant
+    ///
+    /// The frame transform and the model inputs are computed once. The gradient is analytic for the exponential model,
+    /// and obtained by central differences over a single batch density evaluation for the other models.
+    ///
+    /// @code
+    ///     const auto [density, gradient] = earthAtmo.getDensityAndGradientAt(position, instant);
+    /// @endcode
+    ///
+    /// @param [in] aPosition A Position
+    /// @param [in] anInstant An Instant
+    /// @return Atmospheric density value [kg.m^-3] and its gradient with respect to the position, expressed in the
+    /// position frame [kg.m^-4]
+    Pair<Real, Vector3d> getDensityAndGradientAt(const Position& aPosition, const Instant& anInstant) const override;
+
+    /// @brief Get the atmospheric density values at given positions and instant
+    ///
+    /// The frame transform and the instant dependent model inputs are computed once for all positions.
+    ///
+    /// @code
+    ///     VectorXd densities = earthAtmo.getDensitiesAt(positionArray, instant);
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray A position array
+    /// @param [in] anInstant An Instant
+    /// @param [in] aThreadCount A number of threads evaluating the densities. Defaults to 1 (sequential)
+    /// @return Atmospheric density values [kg.m^-3]
+    VectorXd getDensitiesAt(
+        const PositionArray& aPositionArray, const Instant& anInstant, const Size& aThreadCount = 1
+    ) const;
+
+    /// @brief Get the atmospheric density values at given positions, each position at its associated instant
+    ///
+    /// Only the NRLMSISE00 model evaluates positions on several threads, other models ignore the thread count.
+    ///
+    /// @code
+    ///     VectorXd densities = earthAtmo.getDensitiesAt(positionArray, instants);
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray A position array
+    /// @param [in] anInstantArray An array of instants, of size one or of the size of the position array
+    /// @param [in] aThreadCount A number of threads evaluating the densities. Defaults to 1 (sequential)
+    /// @return Atmospheric density values [kg.m^-3]
+    VectorXd getDensitiesAt(
+        const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, const Size& aThreadCount = 1
+    ) const;
+
     static constexpr double defaultF107ConstantValue = 150.0;   // 10⁻²² W⋅m⁻²⋅Hz⁻¹
     static constexpr double defaultF107AConstantValue = 150.0;  // 10⁻²² W⋅m⁻²⋅Hz⁻¹
     static constexpr double defaultKpConstantValue = 3.0;       // dimensionless
@@ -205,6 +267,8 @@ class Earth : public Model
     class Impl;
     class ExponentialImpl;
     class NRLMSISE00Impl;
+    class NRLMSISE00GridImpl;
+    class HarrisPriesterImpl;
 
     Unique<Impl> implUPtr_;
 
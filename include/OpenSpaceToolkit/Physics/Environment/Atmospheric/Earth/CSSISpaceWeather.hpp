@@ -3,11 +3,15 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather__
 #define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather__
 
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 
 #include <OpenSpaceToolkit/Physics/Time/Date.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
@@ -28,8 +32,10 @@ namespace earth
 using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::filesystem::File;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::physics::time::Date;
@@ -93,6 +99,27 @@ class CSSISpaceWeather
         Real F107AdjLast81;    /// Last 81-day arithmetic average of F10.7 (adjusted)
     };
 
+    /// @brief Reading fields which can be extrapolated from the last reading defining them.
+    enum class Field
+    {
+        Kp3Hour,         /// The 8 3-hour Kp indices.
+        Ap3Hour,         /// The 8 3-hour Ap indices.
+        ApDaily,         /// Daily average Ap index.
+        F107Obs,         /// Observed F10.7 solar flux.
+        F107ObsCenter81  /// Centered 81-day average of observed F10.7 solar flux.
+    };
+
+    /// @brief Space weather inputs of the NRLMSISE-00 atmospheric model at an instant.
+    ///
+    /// Undefined values are replaced by the last defined ones, as in `accessLastReadingWhere`.
+    struct NRLMSISE00Input
+    {
+        double ap[7];        /// Daily Ap, 3-hour Ap for the instant and 3, 6 and 9 hours before, and averages of the
+                             /// eight 3-hour Ap from 12 to 33 and from 36 to 57 hours before.
+        double f107;         /// Observed F10.7 solar flux of the previous day.
+        double f107Average;  /// Centered 81-day average of observed F10.7 solar flux.
+    };
+
     /// @brief Output stream operator.
     ///
     /// @code
@@ -220,6 +247,31 @@ class CSSISpaceWeather
         const std::function<bool(const Reading&)>& aPredicate, const Instant& anInstant
     ) const;
 
+    /// @brief Access last reading before anInstant where aField is defined.
+    /// Equivalent to `accessLastReadingWhere` with a predicate checking aField, but read in constant time from indices
+    /// precomputed at load time.
+    ///
+    /// @code
+    ///     const Reading& reading = cssiSpaceWeather.accessLastReadingWithDefined(field, instant);
+    /// @endcode
+    ///
+    /// @param [in] aField A reading field.
+    /// @param [in] anInstant An Instant.
+    /// @return Last Reading defining field.
+    const Reading& accessLastReadingWithDefined(const Field& aField, const Instant& anInstant) const;
+
+    /// @brief Get NRLMSISE-00 inputs at Instant.
+    /// Read from daily tables precomputed at load time, which span from the first observation to the last prediction.
+    ///
+    /// @code
+    ///     CSSISpaceWeather::NRLMSISE00Input input = cssiSpaceWeather.getNRLMSISE00InputAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An Instant.
+    /// @return NRLMSISE-00 inputs.
+
+    NRLMSISE00Input getNRLMSISE00InputAt(const Instant& anInstant) const;
+
     /// @brief Undefined factory function
     ///
     /// @code
@@ -241,6 +293,19 @@ class CSSISpaceWeather
 
     static CSSISpaceWeather Load(const File& aFile);
 
+    /// @brief Load CSSI Space Weather file in csv format, through its binary cache.
+    ///
+    /// The cache is a sidecar next to the file, rebuilt whenever the file changes.
+    ///
+    /// @code
+    ///     CSSISpaceWeather cssiSpaceWeather = CSSISpaceWeather::LoadCached(file);
+    /// @endcode
+    ///
+    /// @param [in] aFile A CSSI Space Weather file.
+    /// @return CSSI Space Weather object.
+
+    static CSSISpaceWeather LoadCached(const File& aFile);
+
     /// @brief Load CSSI Space Weather file in legacy .txt format.
     ///
     /// @code
@@ -257,15 +322,50 @@ class CSSISpaceWeather
     Instant lastModifiedTimestamp_;
 
     Interval observationInterval_;
-    Map<Integer, CSSISpaceWeather::Reading> observations_;
-
     Interval dailyPredictionInterval_;
-    Map<Integer, CSSISpaceWeather::Reading> dailyPredictions_;
-
     Interval monthlyPredictionInterval_;
-    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictions_;
+
+    // Observations, daily predictions and monthly predictions, each in chronological order
+    std::vector<Reading> readings_;
+    Size observationCount_;
+    Size dailyPredictionCount_;
+
+    // Distinct readings resolved day by day like `accessReadingAt` (consecutive days of a monthly prediction share a
+    // reading), in chronological order, as indices into the readings
+    std::vector<Index> timelineReadingIndices_;
+    std::vector<Index> previousTimelineIndices_;     // Undefined index after a missing day
+    std::vector<Index> lastDefinedTimelineIndices_;  // One per field, undefined index when no reading defines it
+
+    // Daily tables, indexed by day since the first reading (NaN when no defined value is available)
+    Integer tableStartMjd_;
+    std::vector<Index> dayTimelineIndices_;  // Undefined index for missing days
+    std::vector<double> ap3Hour_;  // 8 slots per day
+    std::vector<double> apDaily_;
+    std::vector<double> f107_;
+    std::vector<double> f107Center81_;
+
+    // Monthly prediction of each month since the first monthly prediction, as indices into the readings (undefined
+    // index for missing months)
+    Integer monthTableStart_;
+    std::vector<Index> monthReadingIndices_;
 
     CSSISpaceWeather();
+
+    bool isCovering(const Instant& anInstant) const;
+
+    Index findTimelineIndexAt(const Instant& anInstant) const;
+
+    Index getTimelineIndexAt(const Instant& anInstant) const;
+
+    void setReadings(
+        const Map<Integer, Reading>& anObservationMap,
+        const Map<Integer, Reading>& aDailyPredictionMap,
+        const Map<Integer, Reading>& aMonthlyPredictionMap
+    );
+
+    void setIntervals();
+
+    void setDailyTables();
 };
 
 }  // namespace earth
@@ -4,11 +4,14 @@
 #define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Exponential__
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Model.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
@@ -26,11 +29,14 @@ namespace earth
 {
 
 using ostk::core::container::Array;
+using ostk::core::container::Pair;
 using ostk::core::container::Tuple;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::environment::atmospheric::Model;
 using ostk::physics::time::Instant;
@@ -81,6 +87,22 @@ class Exponential
 
     Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
 
+    /// @brief Get the atmospheric density value and its gradient at a given position and instant
+    ///
+    /// The gradient is analytic within a density band: the density only depends on the altitude, whose gradient is the
+    /// local geodetic vertical.
+    ///
+    /// @code
+    ///     const auto [density, gradient] = model.getDensityAndGradientAt(lla, instant);
+    /// @endcode
+    ///
+    /// @param [in] aLLA A position, expressed as latitude, longitude, altitude [deg, deg, m]
+    /// @param [in] anInstant An instant
+    /// @return Atmospheric density value [kg.m^-3] and its gradient with respect to the position, expressed in the
+    /// Earth-fixed frame of the LLA [kg.m^-4]
+
+    Pair<Real, Vector3d> getDensityAndGradientAt(const LLA& aLLA, const Instant& anInstant) const;
+
    private:
     static Tuple<Real, Real, Real> DensityBandValues(const Length& anAltitude);
 };
@@ -0,0 +1,136 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester__
+#define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester__
+
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Gravitational/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace atmospheric
+{
+namespace earth
+{
+
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+/// @brief Harris-Priester atmospheric model
+///
+/// Interpolates exponentially between tabulated minimum (antapex) and maximum (apex) densities for mean solar activity,
+/// valid from 100 km to 1000 km, and blends them with a cosine power of half the angle to the diurnal bulge apex. The
+/// apex lags the Sun by 30 deg in longitude.
+///
+/// When no Sun celestial object is provided, the Sun direction is approximated by the mean Sun in longitude (consistent
+/// with the standard local solar time of the NRLMSISE00 model) and a low precision solar declination, so that no
+/// ephemeris or space weather data is needed.
+///
+/// Ref: Montenbruck O., Gill E., Satellite Orbits, Springer, 2000, section 3.5.2
+
+class HarrisPriester
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     HarrisPriester model;
+    /// @endcode
+    ///
+    /// @param [in] aCosinePower A cosine power, from 2 (low inclination orbits) to 6 (polar orbits). Defaults to 4
+    /// @param [in] anEarthFrameSPtr A shared pointer to the Earth frame. Defaults to Frame::ITRF()
+    /// @param [in] anEarthRadius An Earth radius. Defaults to WGS84 radius
+    /// @param [in] anEarthFlattening An Earth flattening. Defaults to WGS84 flattening
+    /// @param [in] aSunCelestialSPtr A shared pointer to the Sun celestial body. Defaults to nullptr
+
+    HarrisPriester(
+        const Integer& aCosinePower = 4,
+        const Shared<const Frame>& anEarthFrameSPtr = Frame::ITRF(),
+        const Length& anEarthRadius = EarthGravitationalModel::WGS84.equatorialRadius_,
+        const Real& anEarthFlattening = EarthGravitationalModel::WGS84.flattening_,
+        const Shared<Celestial>& aSunCelestialSPtr = nullptr
+    );
+
+    /// @brief Clone the Harris-Priester atmospheric model
+    ///
+    /// @code
+    ///     HarrisPriester* modelPtr = model.clone();
+    /// @endcode
+    ///
+    /// @return Pointer to Harris-Priester atmospheric model
+
+    HarrisPriester* clone() const;
+
+    /// @brief Check if the Harris-Priester atmospheric model is defined
+    ///
+    /// @code
+    ///     model.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the Harris-Priester atmospheric model is defined
+
+    bool isDefined() const;
+
+    /// @brief Get the cosine power
+    ///
+    /// @code
+    ///     Integer cosinePower = model.getCosinePower();
+    /// @endcode
+    ///
+    /// @return Cosine power
+
+    Integer getCosinePower() const;
+
+    /// @brief Get the atmospheric density value at a given position and instant
+    ///
+    /// @code
+    ///     Real density = model.getDensityAt(lla, instant);
+    /// @endcode
+    ///
+    /// @param [in] aLLA A position, expressed as latitude, longitude, altitude [deg, deg, m]
+    /// @param [in] anInstant An instant
+    /// @return Atmospheric density value [kg.m^-3]
+
+    Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
+
+   private:
+    Integer cosinePower_;
+    Shared<const Frame> earthFrameSPtr_;
+    Length earthRadius_;
+    Real earthFlattening_;
+    Shared<Celestial> sunCelestialSPtr_;
+
+    Vector3d computeSunDirectionAt(const Instant& anInstant) const;
+};
+
+}  // namespace earth
+}  // namespace atmospheric
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
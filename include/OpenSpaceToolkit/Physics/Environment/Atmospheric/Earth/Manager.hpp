@@ -9,6 +9,7 @@
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 
 #include <OpenSpaceToolkit/IO/URL.hpp>
 
@@ -18,6 +19,7 @@
 #include <OpenSpaceToolkit/Physics/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Utility/AtomicShared.hpp>
 
 #define OSTK_PHYSICS_ENVIRONMENT_ATMOSPHERIC_EARTH_MANAGER_LOCAL_REPOSITORY \
     "./.open-space-toolkit/physics/data/environment/atmospheric/earth"
@@ -37,6 +39,7 @@ using ostk::core::container::Array;
 using ostk::core::filesystem::Directory;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
 
 using ostk::io::URL;
 
@@ -45,6 +48,7 @@ using ostk::mathematics::object::Vector2d;
 using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::utilities::AtomicShared;
 using BaseManager = ostk::physics::Manager;
 
 /// @brief CSSI space weather manager (thread-safe)
@@ -56,11 +60,20 @@ using BaseManager = ostk::physics::Manager;
 /// "OSTK_PHYSICS_ENVIRONMENT_ATMOSPHERIC_EARTH_MANAGER_LOCAL_REPOSITORY_LOCK_TIMEOUT"
 /// will override "DefaultLocalRepositoryLockTimeout"
 ///
+/// Loaded space weather is published as an immutable snapshot, swapped atomically when space weather is loaded: queries
+/// do not take the manager mutex once space weather is available (loading the snapshot still takes the short internal
+/// lock of `AtomicShared`). Background refresh (see `startBackgroundRefresh`) keeps space weather data up to date
+/// without fetching on the querying thread.
+///
 /// @ref https://ai-solutions.com/_help_Files/cssi_space_weather_file.htm
 
 class Manager : public BaseManager
 {
    public:
+    /// @brief Destructor (stops background refresh)
+
+    ~Manager() override;
+
     /// @brief Get CSSI Space Weather directory
     ///
     /// @code
@@ -147,6 +160,20 @@ class Manager : public BaseManager
 
     Real getF107SolarFlux81DayAvgAt(const Instant& anInstant) const;
 
+    /// @brief Get the NRLMSISE-00 geomagnetic and solar flux inputs at instant.
+    ///
+    /// Read from the tables precomputed when the space weather is loaded, in constant time and without taking the
+    /// manager mutex.
+    ///
+    /// @code
+    ///     CSSISpaceWeather::NRLMSISE00Input input = Manager::Get().getNRLMSISE00InputAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return NRLMSISE-00 inputs
+
+    CSSISpaceWeather::NRLMSISE00Input getNRLMSISE00InputAt(const Instant& anInstant) const;
+
     /// @brief Load CSSI Space Weather
     ///
     /// @code
@@ -188,16 +215,18 @@ class Manager : public BaseManager
     static Manager& Get();
 
    private:
-    CSSISpaceWeather CSSISpaceWeather_;
+    AtomicShared<const CSSISpaceWeather> CSSISpaceWeather_;  ///< Replaced under mutex_, read without it
 
     Manager();
 
-    const CSSISpaceWeather* accessCSSISpaceWeatherAt_(const Instant& anInstant) const;
+    Shared<const CSSISpaceWeather> accessCSSISpaceWeatherAt_(const Instant& anInstant) const;
 
     File getLatestCSSISpaceWeatherFile_() const;
 
     virtual void setup_() override;
 
+    virtual void refresh_() override;
+
     void loadCSSISpaceWeather_(const CSSISpaceWeather& aCSSISpaceWeather);
 
     File fetchLatestCSSISpaceWeather_();
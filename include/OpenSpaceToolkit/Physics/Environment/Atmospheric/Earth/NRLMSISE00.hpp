@@ -5,12 +5,17 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Model.hpp>
@@ -32,13 +37,20 @@ namespace earth
 
 using ostk::core::container::Array;
 using ostk::core::container::Tuple;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
+using ostk::core::type::Uint64;
 using ostk::core::type::Unique;
 
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::PositionArray;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::environment::atmospheric::Model;
 using ostk::physics::environment::object::Celestial;
@@ -48,6 +60,13 @@ using EarthAtmosphericModel = ostk::physics::environment::atmospheric::Earth;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
 /// @brief NRLMSISE00 atmospheric model
+///
+/// Density can be evaluated concurrently from multiple threads: the NRLMSISE-00 C library is built with its working
+/// state thread-local, so that each thread evaluates the model with its own state.
+///
+/// When a Sun celestial body is provided, its position in the Earth frame is memoized by each thread for the last few
+/// instants, so that repeated evaluations at the same instant (batch points, finite difference perturbations) share one
+/// ephemeris query without any locking.
 
 class NRLMSISE00
 {
@@ -136,6 +155,46 @@ class NRLMSISE00
 
     Real getKpConstantValue() const;
 
+    /// @brief Get the Earth frame used to construct the NRLMSISE00 atmospheric model
+    ///
+    /// @code
+    ///     Shared<const Frame> earthFrameSPtr = model.getEarthFrame();
+    /// @endcode
+    ///
+    /// @return Shared pointer to the Earth frame
+
+    Shared<const Frame> getEarthFrame() const;
+
+    /// @brief Get the Earth radius used to construct the NRLMSISE00 atmospheric model
+    ///
+    /// @code
+    ///     Length earthRadius = model.getEarthRadius();
+    /// @endcode
+    ///
+    /// @return Earth radius
+
+    Length getEarthRadius() const;
+
+    /// @brief Get the Earth flattening used to construct the NRLMSISE00 atmospheric model
+    ///
+    /// @code
+    ///     Real earthFlattening = model.getEarthFlattening();
+    /// @endcode
+    ///
+    /// @return Earth flattening
+
+    Real getEarthFlattening() const;
+
+    /// @brief Get the Sun celestial body used to construct the NRLMSISE00 atmospheric model
+    ///
+    /// @code
+    ///     Shared<Celestial> sunCelestialSPtr = model.getSunCelestial();
+    /// @endcode
+    ///
+    /// @return Shared pointer to the Sun celestial body, or nullptr if not provided
+
+    Shared<Celestial> getSunCelestial() const;
+
     /// @brief Get the atmospheric density value at a given position and instant.
     ///
     /// @code
@@ -148,6 +207,48 @@ class NRLMSISE00
 
     Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
 
+    /// @brief Get the atmospheric density values at given positions and instant.
+    ///
+    /// Positions are transformed to the Earth frame at once, and the instant dependent inputs (time of year, space
+    /// weather and Sun position) are computed a single time for all positions.
+    ///
+    /// @code
+    ///     VectorXd densities = model.getDensitiesAt(positionArray, instant);
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray A position array
+    /// @param [in] anInstant An instant
+    /// @param [in] aThreadCount A number of threads evaluating the densities. Defaults to 1 (sequential)
+    /// @return Atmospheric density values [kg.m^-3]
+
+    VectorXd getDensitiesAt(
+        const PositionArray& aPositionArray, const Instant& anInstant, const Size& aThreadCount = 1
+    ) const;
+
+    /// @brief Get the atmospheric density values at given positions, each position at its associated instant.
+    ///
+    /// The instant dependent inputs are only recomputed when the instant changes between consecutive positions. A
+    /// single instant is applied to all positions.
+    ///
+    /// Positions are evaluated sequentially, on the calling thread, unless a thread count greater than one is given:
+    /// the batch is then split into contiguous ranges of positions, one per thread, and threads are started for the
+    /// duration of the call. The densities are the same as those of a sequential evaluation. Callers that already
+    /// evaluate densities from a thread pool should keep the default.
+    ///
+    /// @code
+    ///     VectorXd densities = model.getDensitiesAt(positionArray, instants);
+    ///     VectorXd densities = model.getDensitiesAt(positionArray, instants, 8);
+    /// @endcode
+    ///
+    /// @param [in] aPositionArray A position array
+    /// @param [in] anInstantArray An array of instants, of size one or of the size of the position array
+    /// @param [in] aThreadCount A number of threads evaluating the densities. Defaults to 1 (sequential)
+    /// @return Atmospheric density values [kg.m^-3]
+
+    VectorXd getDensitiesAt(
+        const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, const Size& aThreadCount = 1
+    ) const;
+
    protected:
     // redefine input structs from NRLMSISE-00.h to avoid including it in this header
 
@@ -233,6 +334,18 @@ class NRLMSISE00
     Length earthRadius_;
     Real earthFlattening_;
     Shared<Celestial> sunCelestialSPtr_;
+
+    Uint64 sunPositionMemoId_;  ///< Tags the Sun positions memoized for this model, shared with its copies
+
+    Vector3d computeSunPositionAt(const Instant& anInstant) const;
+
+    void computeDensities(
+        const PositionArray::ConstMatrix3XdMap& aCoordinateMatrix,
+        const Array<Instant>& anInstantArray,
+        const Index aBeginIndex,
+        const Index anEndIndex,
+        VectorXd& aDensityVector
+    ) const;
 };
 
 }  // namespace earth
@@ -0,0 +1,286 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid__
+#define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid__
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+#include <OpenSpaceToolkit/Physics/Utility/AtomicShared.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace atmospheric
+{
+namespace earth
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using ostk::physics::utilities::AtomicShared;
+
+/// @brief Gridded NRLMSISE00 atmospheric model
+///
+/// Approximates the NRLMSISE00 model by interpolating the logarithm of the density, linearly over altitude and time,
+/// and cubically over latitude and local solar time. Each time bucket holds two grids, evaluated with the NRLMSISE00
+/// model at a quarter and at three quarters of the bucket, and is kept in a bounded cache evicting the least recently
+/// used buckets. Buckets are aligned on 2000-01-01 00:00:00 UTC, so that the default 3 hour buckets follow the 3 hour
+/// Ap cadence. Local solar time is periodic: stencils around midnight span both ends of the day.
+///
+/// Cached buckets are published as an immutable map, and queries in a cached bucket do not take the cache mutex. As
+/// they do not reorder the recency list either, eviction gives buckets used since they were last considered a second
+/// chance, which approximates least recently used eviction.
+///
+/// Grid nodes are evaluated lazily, when a query first needs them, and are then kept with the bucket: a trajectory only
+/// pays for the cells it crosses. Queries outside of the gridded altitude range are forwarded to the NRLMSISE00 model.
+
+class NRLMSISE00Grid
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @code
+    ///     NRLMSISE00Grid model(NRLMSISE00(NRLMSISE00::InputDataType::CSSISpaceWeatherFile));
+    /// @endcode
+    ///
+    /// @param [in] aNRLMSISE00Model An NRLMSISE00 atmospheric model
+    /// @param [in] aMinimumAltitude A minimum gridded altitude. Defaults to 100 km
+    /// @param [in] aMaximumAltitude A maximum gridded altitude. Defaults to 1000 km
+    /// @param [in] anAltitudeStep An altitude step. Defaults to 5 km
+    /// @param [in] aLatitudeStep A latitude step. Defaults to 10 deg
+    /// @param [in] aLocalSolarTimeStep A local solar time step. Defaults to 1 hour
+    /// @param [in] aBucketDuration A bucket duration, dividing a day. Defaults to 3 hours
+    /// @param [in] aCapacity A maximum number of cached buckets. Defaults to 64
+
+    NRLMSISE00Grid(
+        const NRLMSISE00& aNRLMSISE00Model = NRLMSISE00(),
+        const Length& aMinimumAltitude = Length::Kilometers(100.0),
+        const Length& aMaximumAltitude = Length::Kilometers(1000.0),
+        const Length& anAltitudeStep = Length::Kilometers(5.0),
+        const Angle& aLatitudeStep = Angle::Degrees(10.0),
+        const Duration& aLocalSolarTimeStep = Duration::Hours(1.0),
+        const Duration& aBucketDuration = Duration::Hours(3.0),
+        const Size& aCapacity = 64
+    );
+
+    /// @brief Copy constructor
+    ///
+    /// @param [in] aNRLMSISE00Grid A gridded NRLMSISE00 atmospheric model
+
+    NRLMSISE00Grid(const NRLMSISE00Grid& aNRLMSISE00Grid);
+
+    /// @brief Copy assignment operator
+    ///
+    /// @param [in] aNRLMSISE00Grid A gridded NRLMSISE00 atmospheric model
+    /// @return Reference to gridded NRLMSISE00 atmospheric model
+
+    NRLMSISE00Grid& operator=(const NRLMSISE00Grid& aNRLMSISE00Grid);
+
+    /// @brief Clone the gridded NRLMSISE00 atmospheric model
+    ///
+    /// @code
+    ///     NRLMSISE00Grid* modelPtr = model.clone();
+    /// @endcode
+    ///
+    /// @return Pointer to gridded NRLMSISE00 atmospheric model
+
+    NRLMSISE00Grid* clone() const;
+
+    /// @brief Check if the gridded NRLMSISE00 atmospheric model is defined
+    ///
+    /// @code
+    ///     model.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the gridded NRLMSISE00 atmospheric model is defined
+
+    bool isDefined() const;
+
+    /// @brief Get the wrapped NRLMSISE00 atmospheric model
+    ///
+    /// @code
+    ///     const NRLMSISE00& nrlmsise = model.accessNRLMSISE00Model();
+    /// @endcode
+    ///
+    /// @return Reference to NRLMSISE00 atmospheric model
+
+    const NRLMSISE00& accessNRLMSISE00Model() const;
+
+    /// @brief Get the number of cached buckets
+    ///
+    /// @code
+    ///     Size bucketCount = model.getCachedBucketCount();
+    /// @endcode
+    ///
+    /// @return Number of cached buckets
+
+    Size getCachedBucketCount() const;
+
+    /// @brief Get the number of evaluated grid nodes, over all cached buckets
+    ///
+    /// @code
+    ///     Size nodeCount = model.getEvaluatedNodeCount();
+    /// @endcode
+    ///
+    /// @return Number of evaluated grid nodes
+
+    Size getEvaluatedNodeCount() const;
+
+    /// @brief Get the atmospheric density value at a given position and instant
+    ///
+    /// @code
+    ///     Real density = model.getDensityAt(lla, instant);
+    /// @endcode
+    ///
+    /// @param [in] aLLA A position, expressed as latitude, longitude, altitude [deg, deg, m]
+    /// @param [in] anInstant An instant
+    /// @return Atmospheric density value [kg.m^-3]
+
+    Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const;
+
+    /// @brief Compute the maximum relative interpolation error in the bucket of a given instant
+    ///
+    /// The interpolated densities are compared with the NRLMSISE00 model at the center of every grid cell, at the
+    /// middle of the bucket. All the grid nodes of the bucket are evaluated.
+    ///
+    /// @code
+    ///     Real error = model.computeMaximumRelativeErrorAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant
+    /// @return Maximum relative error
+
+    Real computeMaximumRelativeErrorAt(const Instant& anInstant) const;
+
+    /// @brief Clear the cached buckets
+    ///
+    /// @code
+    ///     model.clearCache();
+    /// @endcode
+
+    void clearCache();
+
+   private:
+    struct Bucket
+    {
+        Instant startInstant;
+        double sunLongitudeAtStart;  // [deg]
+        double sunLongitudeRate;     // [deg/s]
+
+        // Log densities of the nodes of both grids, NaN until evaluated. Concurrent queries may evaluate a node more
+        // than once, always to the same value.
+        mutable std::vector<std::atomic<double>> logDensities;
+    };
+
+    // Interpolation nodes and weights along one grid dimension
+
+    struct Stencil
+    {
+        Size firstIndex;
+        Size nodeCount;
+        std::array<double, 4> weights;
+    };
+
+    struct CacheEntry
+    {
+        CacheEntry(const Shared<const Bucket>& aBucketSPtr)
+            : bucketSPtr(aBucketSPtr),
+              isRecentlyUsed(false)
+        {
+        }
+
+        Shared<const Bucket> bucketSPtr;
+        mutable std::atomic<bool> isRecentlyUsed;  // Set by queries, cleared when the entry is given a second chance
+    };
+
+    using CacheMap = std::unordered_map<std::int64_t, Shared<const CacheEntry>>;
+
+    NRLMSISE00 NRLMSISE00Model_;
+
+    double minimumAltitude_;     // [km]
+    double altitudeStep_;        // [km]
+    double latitudeStep_;        // [deg]
+    double localSolarTimeStep_;  // [h]
+    double bucketDuration_;      // [s]
+    Size altitudeCount_;
+    Size latitudeCount_;
+    Size localSolarTimeCount_;
+    Size capacity_;
+
+    mutable std::mutex mutex_;
+    mutable AtomicShared<const CacheMap> cache_;     ///< Replaced under mutex_, read without it
+    mutable std::list<std::int64_t> bucketIndices_;  ///< Cached bucket indices, oldest first. Guarded by mutex_.
+
+    Shared<const Bucket> accessBucketAt(const Instant& anInstant) const;
+
+    Shared<const Bucket> buildBucket(const std::int64_t& aBucketIndex) const;
+
+    double computeSunLongitudeAt(const Instant& anInstant) const;
+
+    void evaluateNodes(
+        const Bucket& aBucket,
+        const Stencil& anAltitudeStencil,
+        const Stencil& aLatitudeStencil,
+        const Stencil& aLocalSolarTimeStencil
+    ) const;
+
+    double interpolateLogDensity(
+        const Bucket& aBucket,
+        const double& anAltitude,
+        const double& aLatitude,
+        const double& aLocalSolarTime,
+        const double& anElapsedTime
+    ) const;
+
+    Size getIndex(
+        const Size& aTimeIndex,
+        const Size& anAltitudeIndex,
+        const Size& aLatitudeIndex,
+        const Size& aLocalSolarTimeIndex
+    ) const;
+
+    void copyCache(const NRLMSISE00Grid& aNRLMSISE00Grid);
+
+    static Stencil Locate(
+        const double& aValue,
+        const double& aMinimum,
+        const double& aStep,
+        const Size& aCount,
+        const Size& aNodeCount,
+        const bool& isPeriodic = false
+    );
+};
+
+}  // namespace earth
+}  // namespace atmospheric
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
+
+#endif
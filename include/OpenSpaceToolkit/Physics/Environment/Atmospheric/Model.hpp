@@ -3,8 +3,11 @@
 #ifndef __OpenSpaceToolkit_Physics_Environment_Atmospheric_Model__
 #define __OpenSpaceToolkit_Physics_Environment_Atmospheric_Model__
 
+#include <OpenSpaceToolkit/Core/Container/Pair.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
@@ -17,8 +20,11 @@ namespace environment
 namespace atmospheric
 {
 
+using ostk::core::container::Pair;
 using ostk::core::type::Real;
 
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::coordinate::Position;
 using ostk::physics::time::Instant;
 
@@ -26,6 +32,8 @@ using ostk::physics::time::Instant;
 class Model
 {
    public:
+    static constexpr double gradientStep = 10.0;  /// Central difference step of the density gradient [m]
+
     /// @brief Constructor (default)
     Model();
 
@@ -48,6 +56,16 @@ class Model
     /// @param [in] anInstant An Instant
     /// @return Atmospheric density value [kg.m^-3]
     virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const = 0;
+
+    /// @brief Get the atmospheric density value and its gradient at a given position and instant
+    ///
+    /// Defaults to central differences of the density along the axes of the position frame.
+    ///
+    /// @param [in] aPosition A Position
+    /// @param [in] anInstant An Instant
+    /// @return Atmospheric density value [kg.m^-3] and its gradient with respect to the position, expressed in the
+    /// position frame [kg.m^-4]
+    virtual Pair<Real, Vector3d> getDensityAndGradientAt(const Position& aPosition, const Instant& anInstant) const;
 };
 
 }  // namespace atmospheric
@@ -3,8 +3,10 @@
 #ifndef __OpenSpaceToolkit_Physics_Manager__
 #define __OpenSpaceToolkit_Physics_Manager__
 
+#include <condition_variable>
 #include <filesystem>
 #include <mutex>
+#include <thread>
 
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
@@ -28,6 +30,10 @@ using ostk::physics::time::Instant;
 /// @brief OSTk manager base class (thread-safe)
 ///
 /// The base manager defines methods for tracking and checking the manifest file.
+///
+/// Managers can refresh their data in the background: a refresh thread checks the data manifest periodically and,
+/// when the remote data is newer, fetches it into a temporary directory and publishes it. Queries keep using the
+/// previously loaded data until then.
 class Manager
 {
    public:
@@ -51,8 +57,8 @@ class Manager
     /// @brief move assignment operator (deleted)
     Manager& operator=(Manager&&) = delete;
 
-    /// @brief Destructor
-    virtual ~Manager() = default;
+    /// @brief Destructor (stops background refresh)
+    virtual ~Manager();
 
     /// @brief Get manager mode
     ///
@@ -113,6 +119,46 @@ class Manager
     /// @endcode
     void clearLocalRepository();
 
+    /// @brief Check if background refresh is active
+    ///
+    /// @code
+    ///     bool isActive = manager.isBackgroundRefreshActive();
+    /// @endcode
+    ///
+    /// @return True if background refresh is active
+    bool isBackgroundRefreshActive() const;
+
+    /// @brief Refresh data
+    ///
+    /// Fetches and loads data that is newer on the remote than the loaded data (Automatic mode only). The manager
+    /// mutex is only held to publish the refreshed data, so that concurrent queries are not blocked by fetching.
+    ///
+    /// @code
+    ///     manager.refresh();
+    /// @endcode
+    void refresh();
+
+    /// @brief Start background refresh
+    ///
+    /// Refreshes data once immediately, then at every period, on a background thread. Refresh errors are reported on
+    /// the standard error stream and retried at the next period. Restarts background refresh if already active.
+    ///
+    /// @code
+    ///     manager.startBackgroundRefresh(Duration::Hours(1.0));
+    /// @endcode
+    ///
+    /// @param [in] aPeriod A refresh period
+    void startBackgroundRefresh(const Duration& aPeriod);
+
+    /// @brief Stop background refresh
+    ///
+    /// Waits for an ongoing refresh to complete.
+    ///
+    /// @code
+    ///     manager.stopBackgroundRefresh();
+    /// @endcode
+    void stopBackgroundRefresh();
+
    protected:
     String managerModeEnvironmentVariableName_;
     Directory defaultLocalRepositoryDirectory_;
@@ -152,6 +198,15 @@ class Manager
     /// @endcode
     virtual void setup_();
 
+    /// @brief Refresh data, to be implemented by managers that support it (does nothing by default).
+    ///
+    /// Called by `refresh` and by the background refresh thread, without the manager mutex held.
+    ///
+    /// @code
+    ///     manager.refresh_();
+    /// @endcode
+    virtual void refresh_();
+
     /// @brief Check if the local repository is currently locked.
     ///
     /// @code
@@ -222,6 +277,12 @@ class Manager
     /// @return The default lock timeout duration
     static Duration DefaultLocalRepositoryLockTimeout_(const String& aLocalRepositoryLockTimeoutEnvironmentVariableName
     );
+
+   private:
+    std::thread refreshThread_;
+    mutable std::mutex refreshMutex_;
+    std::condition_variable refreshCondition_;
+    bool isRefreshStopRequested_;
 };
 
 }  // namespace physics
@@ -0,0 +1,92 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Physics_Utility_AtomicShared__
+#define __OpenSpaceToolkit_Physics_Utility_AtomicShared__
+
+#include <atomic>
+#include <memory>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace utilities
+{
+
+using ostk::core::type::Shared;
+
+/// @brief Shared pointer that can be loaded and stored concurrently.
+///
+/// Backed by std::atomic<std::shared_ptr<T>> where the standard library provides it (C++20), and by the
+/// std::atomic_load / std::atomic_store overloads for std::shared_ptr otherwise (C++17).
+///
+/// Neither is lock-free. libstdc++ guards std::atomic<std::shared_ptr<T>> with a spin lock held in the pointer itself,
+/// for the duration of a reference count update. The C++17 overloads lock a mutex from a global pool, which is shared
+/// with every other shared pointer hashed to the same mutex. A load therefore costs an uncontended lock and a
+/// reference count increment: it is meant for state that is read far more often than it is published, not for
+/// per-element hot loops.
+///
+/// @code
+///     AtomicShared<const Snapshot> snapshot = {std::make_shared<const Snapshot>()};
+///     Shared<const Snapshot> snapshotSPtr = snapshot.load();
+///     snapshot.store(std::make_shared<const Snapshot>(newSnapshot));
+/// @endcode
+
+template <typename T>
+class AtomicShared
+{
+   public:
+    /// @brief Constructor
+    ///
+    /// @param [in] aSharedPtr An initial shared pointer
+
+    AtomicShared(const Shared<T>& aSharedPtr = nullptr)
+        : sharedPtr_(aSharedPtr)
+    {
+    }
+
+    AtomicShared(const AtomicShared&) = delete;
+
+    AtomicShared& operator=(const AtomicShared&) = delete;
+
+    /// @brief Load the current shared pointer
+    ///
+    /// @return Shared pointer
+
+    Shared<T> load() const
+    {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return sharedPtr_.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&sharedPtr_, std::memory_order_acquire);
+#endif
+    }
+
+    /// @brief Replace the current shared pointer
+    ///
+    /// @param [in] aSharedPtr A shared pointer
+
+    void store(Shared<T> aSharedPtr)
+    {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        sharedPtr_.store(std::move(aSharedPtr), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&sharedPtr_, std::move(aSharedPtr), std::memory_order_release);
+#endif
+    }
+
+   private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<Shared<T>> sharedPtr_;
+#else
+    Shared<T> sharedPtr_;
+#endif
+};
+
+}  // namespace utilities
+}  // namespace physics
+}  // namespace ostk
+
+#endif
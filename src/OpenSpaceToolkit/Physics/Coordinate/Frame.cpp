@@ -1,11 +1,14 @@
 /// Apache License 2.0
 
+#include <atomic>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/CIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientation.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/GCRF.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/ITRF.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/J2000.hpp>
@@ -14,6 +17,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/TEME.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/TIRF.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/TOD.hpp>
+#include <OpenSpaceToolkit/Physics/Utility/AtomicShared.hpp>
 
 namespace ostk
 {
@@ -22,6 +26,7 @@ namespace physics
 namespace coordinate
 {
 
+using ostk::physics::utilities::AtomicShared;
 using FrameManager = ostk::physics::coordinate::frame::Manager;
 
 // https://stackoverflow.com/questions/8147027/how-do-i-call-stdmake-shared-on-a-class-with-only-protected-or-private-const
@@ -29,16 +34,216 @@ using FrameManager = ostk::physics::coordinate::frame::Manager;
 struct SharedFrameEnabler : public Frame
 {
     SharedFrameEnabler(
+        const Uint64 anId,
         const String& aName,
         bool isQuasiInertial,
         const Shared<const Frame>& aParentFrame,
         const Shared<const Provider>& aProvider
     )
-        : Frame(aName, isQuasiInertial, aParentFrame, aProvider)
+        : Frame(anId, aName, isQuasiInertial, aParentFrame, aProvider)
     {
     }
 };
 
+// Identifier 0 is reserved for undefined frames
+
+static std::atomic<Uint64> nextFrameId {1};
+
+// Kinds of parameterized built-in frames, identifying them in frame registry keys
+
+enum class FrameKind : Uint8
+{
+    J2000 = 1,
+    MOD,
+    TOD,
+    TEMEOfEpoch
+};
+
+// Handle on a built-in frame, valid as long as no frame is removed from the registry. Reading a handle takes the
+// AtomicShared lock and a reference count increment, still far cheaper than a registry lookup.
+
+struct FrameHandle
+{
+    Shared<const Frame> frameSPtr;
+    Uint64 frameRegistryGeneration;
+};
+
+template <typename FrameGenerator>
+static Shared<const Frame> accessFrameWithHandle(
+    AtomicShared<const FrameHandle>& aFrameHandle, const FrameGenerator& aFrameGenerator
+)
+{
+    const Uint64 frameRegistryGeneration = FrameManager::Get().getFrameRegistryGeneration();
+
+    const Shared<const FrameHandle> frameHandleSPtr = aFrameHandle.load();
+
+    if ((frameHandleSPtr != nullptr) && (frameHandleSPtr->frameRegistryGeneration == frameRegistryGeneration))
+    {
+        return frameHandleSPtr->frameSPtr;
+    }
+
+    const Shared<const Frame> frameSPtr = aFrameGenerator();
+
+    aFrameHandle.store(std::make_shared<const FrameHandle>(FrameHandle {frameSPtr, frameRegistryGeneration}));
+
+    return frameSPtr;
+}
+
+template <typename FrameGenerator>
+static Shared<const Frame> accessFrameWithKey(
+    const FrameKind& aFrameKind,
+    const Instant& anEpoch,
+    const Uint8 aParameter,
+    const FrameGenerator& aFrameGenerator
+)
+{
+    const FrameManager::FrameKey frameKey = {static_cast<Uint8>(aFrameKind), anEpoch, aParameter};
+
+    if (const auto frameSPtr = FrameManager::Get().accessFrameWithKey(frameKey))
+    {
+        return frameSPtr;
+    }
+
+    const Shared<const Frame> frameSPtr = aFrameGenerator();
+
+    FrameManager::Get().addFrameKey(frameKey, frameSPtr);
+
+    return frameSPtr;
+}
+
+// Replace each run of consecutive time invariant providers with a single static provider
+
+static Array<Shared<const Provider>> foldTimeInvariantProviders(const Array<Shared<const Provider>>& aProviderArray)
+{
+    using ostk::core::type::Index;
+
+    using StaticProvider = ostk::physics::coordinate::frame::provider::Static;
+
+    Array<Shared<const Provider>> providers = Array<Shared<const Provider>>::Empty();
+    providers.reserve(aProviderArray.getSize());
+
+    Index index = 0;
+
+    while (index < aProviderArray.getSize())
+    {
+        Index runEndIndex = index;
+
+        while ((runEndIndex < aProviderArray.getSize()) && aProviderArray[runEndIndex]->isTimeInvariant())
+        {
+            ++runEndIndex;
+        }
+
+        if (runEndIndex - index < 2)
+        {
+            providers.add(aProviderArray[index]);
+            ++index;
+
+            continue;
+        }
+
+        Transform transform = Transform::Identity(Instant::J2000());
+
+        for (; index < runEndIndex; ++index)
+        {
+            transform *= aProviderArray[index]->getTransformAt(Instant::J2000());
+        }
+
+        providers.add(std::make_shared<const StaticProvider>(transform));
+    }
+
+    return providers;
+}
+
+// Replace each ITRF / TIRF / CIRF provider chain (child to ancestor order) with a single Earth orientation provider
+
+static Array<Shared<const Provider>> fuseEarthOrientationProviders(const Array<Shared<const Provider>>& aProviderArray)
+{
+    using ostk::core::type::Index;
+
+    using CIRFProvider = ostk::physics::coordinate::frame::provider::CIRF;
+    using EarthOrientationProvider = ostk::physics::coordinate::frame::provider::EarthOrientation;
+    using ITRFProvider = ostk::physics::coordinate::frame::provider::ITRF;
+    using TIRFProvider = ostk::physics::coordinate::frame::provider::TIRF;
+
+    Array<Shared<const Provider>> providers = Array<Shared<const Provider>>::Empty();
+    providers.reserve(aProviderArray.getSize());
+
+    Index index = 0;
+
+    while (index < aProviderArray.getSize())
+    {
+        if ((index + 2 < aProviderArray.getSize()) &&
+            (dynamic_cast<const ITRFProvider*>(aProviderArray[index].get()) != nullptr) &&
+            (dynamic_cast<const TIRFProvider*>(aProviderArray[index + 1].get()) != nullptr))
+        {
+            if (const auto cirfProviderPtr = dynamic_cast<const CIRFProvider*>(aProviderArray[index + 2].get()))
+            {
+                providers.add(std::make_shared<const EarthOrientationProvider>(cirfProviderPtr->getMode()));
+                index += 3;
+
+                continue;
+            }
+        }
+
+        providers.add(aProviderArray[index]);
+        ++index;
+    }
+
+    return providers;
+}
+
+static Shared<const FrameManager::TransformPlan> buildTransformPlan(
+    const Shared<const Frame>& aFromFrameSPtr,
+    const Shared<const Frame>& aToFrameSPtr,
+    const Shared<const Frame>& aCommonAncestorSPtr
+)
+{
+    if ((aCommonAncestorSPtr == nullptr) || (!aCommonAncestorSPtr->isDefined()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "No common ancestor between [{}] and [{}].", aFromFrameSPtr->getName(), aToFrameSPtr->getName()
+        );
+    }
+
+    FrameManager::TransformPlan transformPlan;
+
+    for (auto framePtr = aFromFrameSPtr.get(); (*framePtr) != (*aCommonAncestorSPtr);
+         framePtr = framePtr->accessParent().get())
+    {
+        transformPlan.originProviders.add(framePtr->accessProvider());
+    }
+
+    for (auto framePtr = aToFrameSPtr.get(); (*framePtr) != (*aCommonAncestorSPtr);
+         framePtr = framePtr->accessParent().get())
+    {
+        transformPlan.destinationProviders.add(framePtr->accessProvider());
+    }
+
+    transformPlan.originProviders =
+        foldTimeInvariantProviders(fuseEarthOrientationProviders(transformPlan.originProviders));
+    transformPlan.destinationProviders =
+        foldTimeInvariantProviders(fuseEarthOrientationProviders(transformPlan.destinationProviders));
+
+    // If both branches are time invariant, fold the whole plan into a single destination provider
+
+    const auto isTimeInvariant = [](const Array<Shared<const Provider>>& aProviderArray) -> bool
+    {
+        return aProviderArray.isEmpty() || ((aProviderArray.getSize() == 1) && aProviderArray[0]->isTimeInvariant());
+    };
+
+    if (isTimeInvariant(transformPlan.originProviders) && isTimeInvariant(transformPlan.destinationProviders))
+    {
+        using StaticProvider = ostk::physics::coordinate::frame::provider::Static;
+
+        const Transform transform_destination_origin = transformPlan.getTransformAt(Instant::J2000());
+
+        transformPlan.originProviders = Array<Shared<const Provider>>::Empty();
+        transformPlan.destinationProviders = {std::make_shared<const StaticProvider>(transform_destination_origin)};
+    }
+
+    return std::make_shared<const FrameManager::TransformPlan>(transformPlan);
+}
+
 Frame::~Frame() {}
 
 bool Frame::operator==(const Frame& aFrame) const
@@ -48,12 +253,7 @@ bool Frame::operator==(const Frame& aFrame) const
         return false;
     }
 
-    return (name_ == aFrame.name_) && (quasiInertial_ == aFrame.quasiInertial_) &&
-           (((parentFrameSPtr_ == nullptr) && (aFrame.parentFrameSPtr_ == nullptr)) ||
-            ((parentFrameSPtr_ != nullptr) && (aFrame.parentFrameSPtr_ != nullptr) &&
-             ((*parentFrameSPtr_) == (*aFrame.parentFrameSPtr_)))) &&
-           ((providerSPtr_ != nullptr) && (aFrame.providerSPtr_ != nullptr) &&
-            (providerSPtr_.get() == aFrame.providerSPtr_.get()));
+    return id_ == aFrame.id_;
 }
 
 bool Frame::operator!=(const Frame& aFrame) const
@@ -158,6 +358,16 @@ Shared<const Provider> Frame::accessProvider() const
     return providerSPtr_;
 }
 
+Uint64 Frame::getId() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    return id_;
+}
+
 String Frame::getName() const
 {
     if (!this->isDefined())
@@ -244,6 +454,11 @@ Transform Frame::getTransformTo(const Shared<const Frame>& aFrameSPtr, const Ins
 
     const Shared<const Frame> thisSPtr = this->shared_from_this();
 
+    // Generation is read before computing the transform, so that a transform computed across an invalidation of the
+    // cache is not cached
+
+    const Uint64 transformCacheGeneration = FrameManager::Get().getTransformCacheGeneration();
+
     const Transform transform = FrameManager::Get().accessCachedTransform(thisSPtr, aFrameSPtr, anInstant);
 
     if (transform.isDefined())
@@ -251,144 +466,249 @@ Transform Frame::getTransformTo(const Shared<const Frame>& aFrameSPtr, const Ins
         return transform;
     }
 
-    // Find common ancestor
+    // Access transform plan, computing it on first use
 
-    const Shared<const Frame> commonAncestorSPtr = Frame::FindCommonAncestor(thisSPtr, aFrameSPtr);
+    Shared<const FrameManager::TransformPlan> transformPlanSPtr =
+        FrameManager::Get().accessTransformPlan(thisSPtr, aFrameSPtr);
 
-    if ((commonAncestorSPtr == nullptr) || (!commonAncestorSPtr->isDefined()))
+    if (transformPlanSPtr == nullptr)
     {
-        throw ostk::core::error::RuntimeError(
-            "No common ancestor between [{}] and [{}].", this->getName(), aFrameSPtr->getName()
-        );
+        transformPlanSPtr = buildTransformPlan(thisSPtr, aFrameSPtr, Frame::FindCommonAncestor(thisSPtr, aFrameSPtr));
+
+        FrameManager::Get().addTransformPlan(thisSPtr, aFrameSPtr, transformPlanSPtr);
     }
 
-    // Compute transform from common ancestor to origin
+    const Transform transform_destination_origin = transformPlanSPtr->getTransformAt(anInstant);
+
+    FrameManager::Get().addCachedTransform(
+        thisSPtr, aFrameSPtr, anInstant, transform_destination_origin, transformCacheGeneration
+    );
 
-    Transform transform_origin_common = Transform::Identity(anInstant);
+    return transform_destination_origin;
+}
 
-    for (auto framePtr = this; (*framePtr) != (*commonAncestorSPtr); framePtr = framePtr->accessParent().get())
+Array<Transform> Frame::getTransformsTo(const Shared<const Frame>& aFrameSPtr, const Array<Instant>& anInstantArray)
+    const
+{
+    for (const auto& instant : anInstantArray)
     {
-        transform_origin_common *= framePtr->accessProvider()->getTransformAt(anInstant);
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
     }
 
-    // Compute transform from destination to common ancestor
-
-    Transform transform_destination_common = Transform::Identity(anInstant);
+    if ((!this->isDefined()) || (aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
 
-    for (auto framePtr = aFrameSPtr.get(); (*framePtr) != (*commonAncestorSPtr);
-         framePtr = framePtr->accessParent().get())
+    if ((*this) == (*aFrameSPtr))
     {
-        transform_destination_common *= framePtr->accessProvider()->getTransformAt(anInstant);
+        Array<Transform> transforms = Array<Transform>::Empty();
+        transforms.reserve(anInstantArray.getSize());
+
+        for (const auto& instant : anInstantArray)
+        {
+            transforms.add(Transform::Identity(instant));
+        }
+
+        return transforms;
     }
 
-    // Compute transform from origin to destination
+    const Shared<const Frame> thisSPtr = this->shared_from_this();
 
-    const Transform transform_destination_origin = transform_destination_common * transform_origin_common.getInverse();
+    // Access transform plan, computing it on first use
 
-    FrameManager::Get().addCachedTransform(thisSPtr, aFrameSPtr, anInstant, transform_destination_origin);
+    Shared<const FrameManager::TransformPlan> transformPlanSPtr =
+        FrameManager::Get().accessTransformPlan(thisSPtr, aFrameSPtr);
 
-    return transform_destination_origin;
+    if (transformPlanSPtr == nullptr)
+    {
+        transformPlanSPtr = buildTransformPlan(thisSPtr, aFrameSPtr, Frame::FindCommonAncestor(thisSPtr, aFrameSPtr));
+
+        FrameManager::Get().addTransformPlan(thisSPtr, aFrameSPtr, transformPlanSPtr);
+    }
+
+    return transformPlanSPtr->getTransformsAt(anInstantArray);
 }
 
 Shared<const Frame> Frame::Undefined()
 {
-    return std::make_shared<const SharedFrameEnabler>(String::Empty(), false, nullptr, nullptr);
+    return std::make_shared<const SharedFrameEnabler>(0, String::Empty(), false, nullptr, nullptr);
 }
 
 Shared<const Frame> Frame::GCRF()
 {
-    using GCRFProvider = ostk::physics::coordinate::frame::provider::GCRF;
+    static AtomicShared<const FrameHandle> frameHandle;
+
+    return accessFrameWithHandle(
+        frameHandle,
+        []() -> Shared<const Frame>
+        {
+            using GCRFProvider = ostk::physics::coordinate::frame::provider::GCRF;
 
-    static const Shared<const Provider> providerSPtr = std::make_shared<const GCRFProvider>();
+            static const Shared<const Provider> providerSPtr = std::make_shared<const GCRFProvider>();
 
-    return Frame::Emplace("GCRF", true, nullptr, providerSPtr);
+            return Frame::Emplace("GCRF", true, nullptr, providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::J2000(const iau::Theory& aTheory)
 {
-    using J2000Provider = ostk::physics::coordinate::frame::provider::J2000;
+    return accessFrameWithKey(
+        FrameKind::J2000,
+        Instant::J2000(),
+        static_cast<Uint8>(aTheory),
+        [&aTheory]() -> Shared<const Frame>
+        {
+            using J2000Provider = ostk::physics::coordinate::frame::provider::J2000;
 
-    const Shared<const Provider> providerSPtr = std::make_shared<const J2000Provider>(aTheory);
+            const Shared<const Provider> providerSPtr = std::make_shared<const J2000Provider>(aTheory);
 
-    return Frame::Emplace(
-        String::Format("J2000 ({})", iau::StringFromTheory(aTheory)), true, Frame::GCRF(), providerSPtr
+            return Frame::Emplace(
+                String::Format("J2000 ({})", iau::StringFromTheory(aTheory)), true, Frame::GCRF(), providerSPtr
+            );
+        }
     );
 }
 
 Shared<const Frame> Frame::MOD(const Instant& anEpoch)
 {
-    using Scale = ostk::physics::time::Scale;
+    return accessFrameWithKey(
+        FrameKind::MOD,
+        anEpoch,
+        0,
+        [&anEpoch]() -> Shared<const Frame>
+        {
+            using Scale = ostk::physics::time::Scale;
 
-    const String frameName = String::Format("MOD @ {}", anEpoch.toString(Scale::TT));
+            const String frameName = String::Format("MOD @ {}", anEpoch.toString(Scale::TT));
 
-    using MODProvider = ostk::physics::coordinate::frame::provider::MOD;
+            using MODProvider = ostk::physics::coordinate::frame::provider::MOD;
 
-    const Shared<const Provider> providerSPtr = std::make_shared<const MODProvider>(anEpoch);
+            const Shared<const Provider> providerSPtr = std::make_shared<const MODProvider>(anEpoch);
 
-    return Frame::Emplace(frameName, true, Frame::GCRF(), providerSPtr);
+            return Frame::Emplace(frameName, true, Frame::GCRF(), providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::TOD(const Instant& anEpoch, const iau::Theory& aTheory)
 {
-    using Scale = ostk::physics::time::Scale;
+    return accessFrameWithKey(
+        FrameKind::TOD,
+        anEpoch,
+        static_cast<Uint8>(aTheory),
+        [&anEpoch, &aTheory]() -> Shared<const Frame>
+        {
+            using Scale = ostk::physics::time::Scale;
 
-    const String frameName =
-        String::Format("TOD ({}) @ {}", iau::StringFromTheory(aTheory), anEpoch.toString(Scale::TT));
+            const String frameName =
+                String::Format("TOD ({}) @ {}", iau::StringFromTheory(aTheory), anEpoch.toString(Scale::TT));
 
-    using TODProvider = ostk::physics::coordinate::frame::provider::TOD;
+            using TODProvider = ostk::physics::coordinate::frame::provider::TOD;
 
-    const Shared<const Provider> providerSPtr = std::make_shared<const TODProvider>(anEpoch, aTheory);
+            const Shared<const Provider> providerSPtr = std::make_shared<const TODProvider>(anEpoch, aTheory);
 
-    return Frame::Emplace(frameName, true, Frame::GCRF(), providerSPtr);
+            return Frame::Emplace(frameName, true, Frame::GCRF(), providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::TEME()
 {
-    using TEMEProvider = ostk::physics::coordinate::frame::provider::TEME;
+    static AtomicShared<const FrameHandle> frameHandle;
 
-    static const Shared<const Provider> providerSPtr = std::make_shared<const TEMEProvider>();
+    return accessFrameWithHandle(
+        frameHandle,
+        []() -> Shared<const Frame>
+        {
+            using TEMEProvider = ostk::physics::coordinate::frame::provider::TEME;
 
-    return Frame::Emplace("TEME", true, Frame::ITRF(), providerSPtr);
+            static const Shared<const Provider> providerSPtr = std::make_shared<const TEMEProvider>();
+
+            return Frame::Emplace("TEME", true, Frame::ITRF(), providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::TEMEOfEpoch(const Instant& anEpoch)
 {
-    using Scale = ostk::physics::time::Scale;
-    using StaticProvider = ostk::physics::coordinate::frame::provider::Static;
+    return accessFrameWithKey(
+        FrameKind::TEMEOfEpoch,
+        anEpoch,
+        0,
+        [&anEpoch]() -> Shared<const Frame>
+        {
+            using Scale = ostk::physics::time::Scale;
+            using StaticProvider = ostk::physics::coordinate::frame::provider::Static;
 
-    const String temeOfEpochFrameName = String::Format("TEMEOfEpoch @ {}", anEpoch.toString(Scale::TT));
+            const String temeOfEpochFrameName = String::Format("TEMEOfEpoch @ {}", anEpoch.toString(Scale::TT));
 
-    const Shared<const Provider> providerSPtr =
-        std::make_shared<const StaticProvider>(Frame::GCRF()->getTransformTo(Frame::TEME(), anEpoch));
+            if (const auto frameSPtr = FrameManager::Get().accessFrameWithName(temeOfEpochFrameName))
+            {
+                return frameSPtr;
+            }
 
-    return Frame::Emplace(temeOfEpochFrameName, true, Frame::GCRF(), providerSPtr);
+            const Shared<const Provider> providerSPtr =
+                std::make_shared<const StaticProvider>(Frame::GCRF()->getTransformTo(Frame::TEME(), anEpoch));
+
+            return Frame::Emplace(temeOfEpochFrameName, true, Frame::GCRF(), providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::CIRF()
 {
-    using CIRFProvider = ostk::physics::coordinate::frame::provider::CIRF;
+    static AtomicShared<const FrameHandle> frameHandle;
+
+    return accessFrameWithHandle(
+        frameHandle,
+        []() -> Shared<const Frame>
+        {
+            using CIRFProvider = ostk::physics::coordinate::frame::provider::CIRF;
 
-    static const Shared<const Provider> providerSPtr = std::make_shared<const CIRFProvider>();
+            static const Shared<const Provider> providerSPtr = std::make_shared<const CIRFProvider>();
 
-    return Frame::Emplace("CIRF", false, Frame::GCRF(), providerSPtr);
+            return Frame::Emplace("CIRF", false, Frame::GCRF(), providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::TIRF()
 {
-    using TIRFProvider = ostk::physics::coordinate::frame::provider::TIRF;
+    static AtomicShared<const FrameHandle> frameHandle;
+
+    return accessFrameWithHandle(
+        frameHandle,
+        []() -> Shared<const Frame>
+        {
+            using TIRFProvider = ostk::physics::coordinate::frame::provider::TIRF;
 
-    static const Shared<const Provider> providerSPtr = std::make_shared<const TIRFProvider>();
+            static const Shared<const Provider> providerSPtr = std::make_shared<const TIRFProvider>();
 
-    return Frame::Emplace("TIRF", false, Frame::CIRF(), providerSPtr);
+            return Frame::Emplace("TIRF", false, Frame::CIRF(), providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::ITRF()
 {
-    using ITRFProvider = ostk::physics::coordinate::frame::provider::ITRF;
+    static AtomicShared<const FrameHandle> frameHandle;
 
-    static const Shared<const Provider> providerSPtr = std::make_shared<const ITRFProvider>();
+    return accessFrameWithHandle(
+        frameHandle,
+        []() -> Shared<const Frame>
+        {
+            using ITRFProvider = ostk::physics::coordinate::frame::provider::ITRF;
+
+            static const Shared<const Provider> providerSPtr = std::make_shared<const ITRFProvider>();
 
-    return Frame::Emplace("ITRF", false, Frame::TIRF(), providerSPtr);
+            return Frame::Emplace("ITRF", false, Frame::TIRF(), providerSPtr);
+        }
+    );
 }
 
 Shared<const Frame> Frame::WithName(const String& aName)
@@ -452,12 +772,14 @@ void Frame::Destruct(const String& aName)
 }
 
 Frame::Frame(
+    const Uint64 anId,
     const String& aName,
     bool isQuasiInertial,
     const Shared<const Frame>& aParentFrame,
     const Shared<const Provider>& aProvider
 )
     : std::enable_shared_from_this<ostk::physics::coordinate::Frame>(),
+      id_(anId),
       name_(aName),
       quasiInertial_(isQuasiInertial),
       parentFrameSPtr_(aParentFrame),
@@ -499,10 +821,17 @@ Shared<const Frame> Frame::Emplace(
     }
 
     const Shared<const Frame> frameSPtr =
-        std::make_shared<const SharedFrameEnabler>(aName, isQuasiInertial, aParentFrame, aProvider);
+        std::make_shared<const SharedFrameEnabler>(nextFrameId++, aName, isQuasiInertial, aParentFrame, aProvider);
 
     FrameManager::Get().addFrame(frameSPtr);
 
+    // Another thread may have registered a frame with the same name in the meantime: return the registered one
+
+    if (const auto registeredFrameSPtr = FrameManager::Get().accessFrameWithName(aName))
+    {
+        return registeredFrameSPtr;
+    }
+
     return frameSPtr;
 }
 
@@ -1,5 +1,7 @@
 /// Apache License 2.0
 
+#include <boost/functional/hash.hpp>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
@@ -14,20 +16,118 @@ namespace coordinate
 namespace frame
 {
 
+namespace
+{
+
+struct ThreadLocalTransformCacheEntry
+{
+    Uint64 generation = 0;
+    Uint64 fromFrameId = 0;
+    Uint64 toFrameId = 0;
+    Instant instant = Instant::Undefined();
+    Transform transform = Transform::Undefined();
+};
+
+thread_local std::vector<ThreadLocalTransformCacheEntry> threadLocalTransformCache;
+
+ThreadLocalTransformCacheEntry& accessThreadLocalTransformCacheEntry(
+    const Size aCacheSize, const Uint64 aFromFrameId, const Uint64 aToFrameId, const Instant& anInstant
+)
+{
+    if (threadLocalTransformCache.size() != aCacheSize)
+    {
+        threadLocalTransformCache.resize(aCacheSize);
+    }
+
+    std::size_t seed = std::hash<Instant>()(anInstant);
+
+    boost::hash_combine(seed, aFromFrameId);
+    boost::hash_combine(seed, aToFrameId);
+
+    return threadLocalTransformCache[seed % aCacheSize];
+}
+
+Array<Transform> composeProviderTransformsAt(
+    const Array<Shared<const Provider>>& aProviderArray, const Array<Instant>& anInstantArray
+)
+{
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    for (const auto& instant : anInstantArray)
+    {
+        transforms.add(Transform::Identity(instant));
+    }
+
+    for (const auto& providerSPtr : aProviderArray)
+    {
+        const Array<Transform> providerTransforms = providerSPtr->getTransformsAt(anInstantArray);
+
+        for (Index index = 0; index < transforms.getSize(); ++index)
+        {
+            transforms[index] *= providerTransforms[index];
+        }
+    }
+
+    return transforms;
+}
+
+}  // namespace
+
+Transform Manager::TransformPlan::getTransformAt(const Instant& anInstant) const
+{
+    // Compute transform from common ancestor to origin
+
+    Transform transform_origin_common = Transform::Identity(anInstant);
+
+    for (const auto& providerSPtr : originProviders)
+    {
+        transform_origin_common *= providerSPtr->getTransformAt(anInstant);
+    }
+
+    // Compute transform from common ancestor to destination
+
+    Transform transform_destination_common = Transform::Identity(anInstant);
+
+    for (const auto& providerSPtr : destinationProviders)
+    {
+        transform_destination_common *= providerSPtr->getTransformAt(anInstant);
+    }
+
+    // Compute transform from origin to destination
+
+    return transform_destination_common * transform_origin_common.getInverse();
+}
+
+Array<Transform> Manager::TransformPlan::getTransformsAt(const Array<Instant>& anInstantArray) const
+{
+    const Array<Transform> transforms_origin_common = composeProviderTransformsAt(originProviders, anInstantArray);
+
+    Array<Transform> transforms_destination_origin =
+        composeProviderTransformsAt(destinationProviders, anInstantArray);
+
+    for (Index index = 0; index < transforms_destination_origin.getSize(); ++index)
+    {
+        transforms_destination_origin[index] *= transforms_origin_common[index].getInverse();
+    }
+
+    return transforms_destination_origin;
+}
+
 bool Manager::hasFrameWithName(const String& aFrameName) const
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
 
-    return frameMap_.find(aFrameName) != frameMap_.end();
+    return frameRegistrySPtr->frameMap.find(aFrameName) != frameRegistrySPtr->frameMap.end();
 }
 
 Shared<const Frame> Manager::accessFrameWithName(const String& aFrameName) const
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
 
-    const auto frameMapIt = frameMap_.find(aFrameName);
+    const auto frameMapIt = frameRegistrySPtr->frameMap.find(aFrameName);
 
-    if (frameMapIt != frameMap_.end())
+    if (frameMapIt != frameRegistrySPtr->frameMap.end())
     {
         return frameMapIt->second;
     }
@@ -39,41 +139,122 @@ Shared<const Frame> Manager::accessFrameWithName(const String& aFrameName) const
 
 Array<String> Manager::getAllFrameNames() const
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
 
     Array<String> frameNames;
-    frameNames.reserve(frameMap_.size());
-    for (const auto& frame : frameMap_)
+    frameNames.reserve(frameRegistrySPtr->frameMap.size());
+    for (const auto& frame : frameRegistrySPtr->frameMap)
     {
         frameNames.add(frame.first);
     }
     return frameNames;
 }
 
+Shared<const Frame> Manager::accessFrameWithKey(const FrameKey& aFrameKey) const
+{
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
+
+    const auto keyedFrameMapIt = frameRegistrySPtr->keyedFrameMap.find(aFrameKey);
+
+    if (keyedFrameMapIt != frameRegistrySPtr->keyedFrameMap.end())
+    {
+        return keyedFrameMapIt->second;
+    }
+
+    return nullptr;
+}
+
+Uint64 Manager::getFrameRegistryGeneration() const
+{
+    return frameRegistryGeneration_.load(std::memory_order_acquire);
+}
+
+Uint64 Manager::getTransformCacheGeneration() const
+{
+    return generation_.load(std::memory_order_acquire);
+}
+
 const Transform Manager::accessCachedTransform(
     const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr, const Instant& anInstant
 ) const
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    const Uint64 fromFrameId = aFromFrameSPtr->getId();
+    const Uint64 toFrameId = aToFrameSPtr->getId();
 
-    const auto transformCacheFromFrameIt = transformCache_.find(aFromFrameSPtr.get());
+    // Generation is read before accessing the shared cache, so that an entry invalidated in the meantime is never
+    // considered valid by the thread-local cache
 
-    if (transformCacheFromFrameIt != transformCache_.end())
+    const Uint64 generation = generation_.load(std::memory_order_acquire);
+
+    if (threadLocalTransformCacheSize_ > 0)
     {
-        const auto transformCacheToFrameIt = transformCacheFromFrameIt->second.find(aToFrameSPtr.get());
+        const ThreadLocalTransformCacheEntry& threadLocalEntry =
+            accessThreadLocalTransformCacheEntry(threadLocalTransformCacheSize_, fromFrameId, toFrameId, anInstant);
 
-        if (transformCacheToFrameIt != transformCacheFromFrameIt->second.end())
+        if ((threadLocalEntry.generation == generation) && (threadLocalEntry.fromFrameId == fromFrameId) &&
+            (threadLocalEntry.toFrameId == toFrameId) && (threadLocalEntry.instant == anInstant))
         {
-            const auto transformCacheInstantIt = transformCacheToFrameIt->second.find(anInstant);
+            return threadLocalEntry.transform;
+        }
+    }
 
-            if (transformCacheInstantIt != transformCacheToFrameIt->second.end())
-            {
-                return (transformCacheInstantIt->second);
-            }
+    const TransformCacheKey key = Manager::TransformCacheKeyFrom(fromFrameId, toFrameId, anInstant);
+
+    const TransformCacheShard& shard = this->accessTransformCacheShard(key);
+
+    Transform transform = Transform::Undefined();
+
+    {
+        const std::shared_lock<std::shared_mutex> lock {shard.mutex};
+
+        const auto entryIt = shard.entries.find(key);
+
+        if (entryIt == shard.entries.end())
+        {
+            return Transform::Undefined();
+        }
+
+        const TransformCacheEntry& entry = entryIt->second;
+
+        entry.referenced.store(true, std::memory_order_relaxed);
+
+        // Entries are stored in a single direction, the reverse transform is computed lazily
+
+        const bool isFromFirstFrame = (fromFrameId == key.firstFrameId);
+
+        transform = (isFromFirstFrame == entry.isFromFirstFrame) ? entry.transform : entry.transform.getInverse();
+    }
+
+    if (threadLocalTransformCacheSize_ > 0)
+    {
+        ThreadLocalTransformCacheEntry& threadLocalEntry =
+            accessThreadLocalTransformCacheEntry(threadLocalTransformCacheSize_, fromFrameId, toFrameId, anInstant);
+
+        threadLocalEntry = {generation, fromFrameId, toFrameId, anInstant, transform};
+    }
+
+    return transform;
+}
+
+Shared<const Manager::TransformPlan> Manager::accessTransformPlan(
+    const Shared<const Frame>& aFromFrameSPtr, const Shared<const Frame>& aToFrameSPtr
+) const
+{
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
+
+    const auto transformPlanFromFrameIt = frameRegistrySPtr->transformPlans.find(aFromFrameSPtr->getId());
+
+    if (transformPlanFromFrameIt != frameRegistrySPtr->transformPlans.end())
+    {
+        const auto transformPlanToFrameIt = transformPlanFromFrameIt->second.find(aToFrameSPtr->getId());
+
+        if (transformPlanToFrameIt != transformPlanFromFrameIt->second.end())
+        {
+            return transformPlanToFrameIt->second;
         }
     }
 
-    return Transform::Undefined();
+    return nullptr;
 }
 
 void Manager::addFrame(const Shared<const Frame>& aFrameSPtr)
@@ -85,44 +266,108 @@ void Manager::addFrame(const Shared<const Frame>& aFrameSPtr)
 
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    if (frameMap_.find(aFrameSPtr->getName()) == frameMap_.end())
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
+
+    if (frameRegistrySPtr->frameMap.find(aFrameSPtr->getName()) == frameRegistrySPtr->frameMap.end())
     {
-        frameMap_.insert({aFrameSPtr->getName(), aFrameSPtr});
+        FrameRegistry frameRegistry = *frameRegistrySPtr;
+
+        frameRegistry.frameMap.insert({aFrameSPtr->getName(), aFrameSPtr});
+
+        frameRegistry_.store(std::make_shared<const FrameRegistry>(std::move(frameRegistry)));
     }
 }
 
+void Manager::addFrameKey(const FrameKey& aFrameKey, const Shared<const Frame>& aFrameSPtr)
+{
+    if (aFrameSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
+
+    const auto frameMapIt = frameRegistrySPtr->frameMap.find(aFrameSPtr->getName());
+
+    if ((frameMapIt == frameRegistrySPtr->frameMap.end()) || ((*frameMapIt->second) != (*aFrameSPtr)))
+    {
+        return;
+    }
+
+    FrameRegistry frameRegistry = *frameRegistrySPtr;
+
+    frameRegistry.keyedFrameMap.insert({aFrameKey, aFrameSPtr});
+
+    frameRegistry_.store(std::make_shared<const FrameRegistry>(std::move(frameRegistry)));
+}
+
 void Manager::removeFrameWithName(const String& aFrameName)
 {
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    const auto frameMapIt = frameMap_.find(aFrameName);
+    const Shared<const FrameRegistry> frameRegistrySPtr = this->accessFrameRegistry();
 
-    if (frameMapIt != frameMap_.end())
+    const auto frameMapIt = frameRegistrySPtr->frameMap.find(aFrameName);
+
+    if (frameMapIt != frameRegistrySPtr->frameMap.end())
     {
-        const Frame* framePtr = frameMapIt->second.get();
+        const Uint64 frameId = frameMapIt->second->getId();
 
-        // Delete related cached transforms
+        // Delete related cached transforms, rejecting transforms being computed concurrently
 
-        const auto transformCacheFromFrameIt = transformCache_.find(framePtr);
+        generation_.fetch_add(1, std::memory_order_acq_rel);
 
-        if (transformCacheFromFrameIt != transformCache_.end())
+        for (TransformCacheShard& shard : transformCacheShards_)
         {
-            transformCache_.erase(transformCacheFromFrameIt);
-        }
+            const std::unique_lock<std::shared_mutex> shardLock {shard.mutex};
 
-        for (auto& transformCacheIt : transformCache_)
-        {
-            const auto transformCacheToFrameIt = transformCacheIt.second.find(framePtr);
+            std::vector<TransformCacheMap::value_type*> clock;
+            clock.reserve(shard.clock.size());
 
-            if (transformCacheToFrameIt != transformCacheIt.second.end())
+            for (TransformCacheMap::value_type* entryPtr : shard.clock)
             {
-                transformCacheIt.second.erase(transformCacheToFrameIt);
+                if ((entryPtr->first.firstFrameId == frameId) || (entryPtr->first.secondFrameId == frameId))
+                {
+                    shard.entries.erase(shard.entries.find(entryPtr->first));
+                }
+                else
+                {
+                    clock.push_back(entryPtr);
+                }
             }
+
+            shard.clock = std::move(clock);
+            shard.clockHand = 0;
+        }
+
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+
+        // Delete frame, keys and transform plans referring to it
+
+        FrameRegistry frameRegistry = *frameRegistrySPtr;
+
+        frameRegistry.frameMap.erase(aFrameName);
+
+        for (auto keyedFrameMapIt = frameRegistry.keyedFrameMap.begin();
+             keyedFrameMapIt != frameRegistry.keyedFrameMap.end();)
+        {
+            keyedFrameMapIt = (keyedFrameMapIt->second->getId() == frameId)
+                                ? frameRegistry.keyedFrameMap.erase(keyedFrameMapIt)
+                                : std::next(keyedFrameMapIt);
+        }
+
+        frameRegistry.transformPlans.erase(frameId);
+
+        for (auto& transformPlanIt : frameRegistry.transformPlans)
+        {
+            transformPlanIt.second.erase(frameId);
         }
 
-        // Delete frame
+        frameRegistry_.store(std::make_shared<const FrameRegistry>(std::move(frameRegistry)));
 
-        frameMap_.erase(frameMapIt);
+        frameRegistryGeneration_.fetch_add(1, std::memory_order_acq_rel);
     }
     else
     {
@@ -134,8 +379,20 @@ void Manager::clearAllFrames()
 {
     const std::lock_guard<std::mutex> lock {mutex_};
 
-    frameMap_.clear();
-    transformCache_.clear();
+    frameRegistry_.store(std::make_shared<const FrameRegistry>());
+
+    frameRegistryGeneration_.fetch_add(1, std::memory_order_acq_rel);
+
+    this->clearTransformCacheShards();
+
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void Manager::clearCachedTransforms()
+{
+    this->clearTransformCacheShards();
+
+    generation_.fetch_add(1, std::memory_order_acq_rel);
 }
 
 void Manager::addCachedTransform(
@@ -145,37 +402,117 @@ void Manager::addCachedTransform(
     const Transform& aTransform
 )
 {
-    const std::lock_guard<std::mutex> lock {mutex_};
+    this->addCachedTransform(
+        aFromFrameSPtr, aToFrameSPtr, anInstant, aTransform, generation_.load(std::memory_order_acquire)
+    );
+}
+
+void Manager::addCachedTransform(
+    const Shared<const Frame>& aFromFrameSPtr,
+    const Shared<const Frame>& aToFrameSPtr,
+    const Instant& anInstant,
+    const Transform& aTransform,
+    const Uint64 aGeneration
+)
+{
+    const Uint64 fromFrameId = aFromFrameSPtr->getId();
+    const Uint64 toFrameId = aToFrameSPtr->getId();
 
-    const auto transformCacheFromFrameIt = transformCache_.insert({aFromFrameSPtr.get(), {}}).first;
-    const auto transformCacheToFrameIt = transformCacheFromFrameIt->second.insert({aToFrameSPtr.get(), {}}).first;
+    // A stale entry is never hit, as thread-local entries are only valid for the current generation
 
-    // Check size for this specific frame pair
-    if (transformCacheToFrameIt->second.size() >= maxTransformCacheSize_)
+    if (threadLocalTransformCacheSize_ > 0)
     {
-        // Clear instants for this frame pair only
-        // TBI: Improve caching strategy, perhaps LRU.
-        transformCacheToFrameIt->second.clear();
+        ThreadLocalTransformCacheEntry& threadLocalEntry =
+            accessThreadLocalTransformCacheEntry(threadLocalTransformCacheSize_, fromFrameId, toFrameId, anInstant);
+
+        threadLocalEntry = {aGeneration, fromFrameId, toFrameId, anInstant, aTransform};
+    }
+
+    if (transformCacheShardCapacity_ == 0)
+    {
+        return;
+    }
+
+    const TransformCacheKey key = Manager::TransformCacheKeyFrom(fromFrameId, toFrameId, anInstant);
+    const bool isFromFirstFrame = (fromFrameId == key.firstFrameId);
+
+    TransformCacheShard& shard = this->accessTransformCacheShard(key);
+
+    const std::unique_lock<std::shared_mutex> lock {shard.mutex};
+
+    // Invalidations increment the generation before clearing shards, so that a transform computed before an
+    // invalidation is either rejected here or cleared afterwards
+
+    if (aGeneration != generation_.load(std::memory_order_acquire))
+    {
+        return;
     }
 
-    const auto transformCacheToInstantIt = transformCacheToFrameIt->second.insert({anInstant, aTransform}).first;
+    if (shard.entries.find(key) != shard.entries.end())
+    {
+        return;
+    }
 
-    (void)transformCacheToInstantIt;
+    const bool isFull = (shard.clock.size() >= transformCacheShardCapacity_);
 
-    // Eagerly cache the reverse transform (toFrame -> fromFrame -> instant)
-    const auto reverseTransformCacheToFrameIt = transformCache_.insert({aToFrameSPtr.get(), {}}).first;
-    const auto reverseTransformCacheFromFrameIt =
-        reverseTransformCacheToFrameIt->second.insert({aFromFrameSPtr.get(), {}}).first;
+    if (isFull)
+    {
+        // CLOCK eviction: give a second chance to recently referenced entries
 
-    // Check size for this specific frame pair
-    if (reverseTransformCacheFromFrameIt->second.size() >= maxTransformCacheSize_)
+        while (shard.clock[shard.clockHand]->second.referenced.exchange(false, std::memory_order_relaxed))
+        {
+            shard.clockHand = (shard.clockHand + 1) % shard.clock.size();
+        }
+
+        shard.entries.erase(shard.entries.find(shard.clock[shard.clockHand]->first));
+    }
+
+    const auto entryIt = shard.entries
+                             .emplace(
+                                 std::piecewise_construct,
+                                 std::forward_as_tuple(key),
+                                 std::forward_as_tuple(aTransform, isFromFirstFrame)
+                             )
+                             .first;
+
+    if (isFull)
+    {
+        shard.clock[shard.clockHand] = &(*entryIt);
+        shard.clockHand = (shard.clockHand + 1) % shard.clock.size();
+    }
+    else
+    {
+        shard.clock.push_back(&(*entryIt));
+    }
+}
+
+void Manager::addTransformPlan(
+    const Shared<const Frame>& aFromFrameSPtr,
+    const Shared<const Frame>& aToFrameSPtr,
+    const Shared<const TransformPlan>& aTransformPlanSPtr
+)
+{
+    if (aTransformPlanSPtr == nullptr)
     {
-        // Clear instants for this frame pair only
-        // TBI: Improve caching strategy, perhaps LRU.
-        reverseTransformCacheFromFrameIt->second.clear();
+        throw ostk::core::error::runtime::Undefined("Transform plan");
     }
 
-    reverseTransformCacheFromFrameIt->second.insert({anInstant, aTransform.getInverse()}).first;
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    FrameRegistry frameRegistry = *this->accessFrameRegistry();
+
+    frameRegistry.transformPlans[aFromFrameSPtr->getId()][aToFrameSPtr->getId()] = aTransformPlanSPtr;
+
+    // Eagerly store the reverse plan (toFrame -> fromFrame), which swaps origin and destination branches
+
+    const TransformPlan reverseTransformPlan = {
+        aTransformPlanSPtr->destinationProviders, aTransformPlanSPtr->originProviders
+    };
+
+    frameRegistry.transformPlans[aToFrameSPtr->getId()][aFromFrameSPtr->getId()] =
+        std::make_shared<const TransformPlan>(reverseTransformPlan);
+
+    frameRegistry_.store(std::make_shared<const FrameRegistry>(std::move(frameRegistry)));
 }
 
 Manager& Manager::Get()
@@ -184,7 +521,7 @@ Manager& Manager::Get()
     {
         const char* maxTransformCacheSizeEnv = std::getenv("OSTK_PHYSICS_FRAME_MANAGER_MAX_TRANSFORM_CACHE_SIZE");
 
-        Size value = 1000;
+        Size value = 16384;
 
         if (maxTransformCacheSizeEnv != nullptr)
         {
@@ -202,13 +539,119 @@ Manager& Manager::Get()
         return value;
     }();
 
-    static Manager manager {maxTransformCacheSize};
+    static Size threadLocalTransformCacheSize = []()
+    {
+        const char* threadLocalTransformCacheSizeEnv =
+            std::getenv("OSTK_PHYSICS_FRAME_MANAGER_THREAD_LOCAL_TRANSFORM_CACHE_SIZE");
+
+        Size value = 64;
+
+        if (threadLocalTransformCacheSizeEnv != nullptr)
+        {
+            try
+            {
+                value = std::stoul(threadLocalTransformCacheSizeEnv);
+            }
+            catch (const std::exception& e)
+            {
+                throw ostk::core::error::RuntimeError(
+                    "Invalid value for OSTK_PHYSICS_FRAME_MANAGER_THREAD_LOCAL_TRANSFORM_CACHE_SIZE: {}", e.what()
+                );
+            }
+        }
+        return value;
+    }();
+
+    static Manager manager {maxTransformCacheSize, threadLocalTransformCacheSize};
 
     return manager;
 }
 
-Manager::Manager(const Size& aMaxTransformCacheSize)
-    : maxTransformCacheSize_(aMaxTransformCacheSize)
+Manager::Manager(const Size& aMaxTransformCacheSize, const Size& aThreadLocalTransformCacheSize)
+    : maxTransformCacheSize_(aMaxTransformCacheSize),
+      transformCacheShardCapacity_(
+          (aMaxTransformCacheSize + Manager::TransformCacheShardCount - 1) / Manager::TransformCacheShardCount
+      ),
+      threadLocalTransformCacheSize_(aThreadLocalTransformCacheSize),
+      generation_(1),
+      frameRegistryGeneration_(1),
+      frameRegistry_(std::make_shared<const FrameRegistry>())
+{
+    for (TransformCacheShard& shard : transformCacheShards_)
+    {
+        shard.entries.reserve(transformCacheShardCapacity_);
+        shard.clock.reserve(transformCacheShardCapacity_);
+    }
+}
+
+void Manager::clearTransformCacheShards()
+{
+    // Reject transforms being computed concurrently, callers increment the generation again once shards are cleared
+
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+
+    for (TransformCacheShard& shard : transformCacheShards_)
+    {
+        const std::unique_lock<std::shared_mutex> shardLock {shard.mutex};
+
+        shard.clock.clear();
+        shard.entries.clear();
+        shard.clockHand = 0;
+    }
+}
+
+Manager::TransformCacheShard& Manager::accessTransformCacheShard(const TransformCacheKey& aTransformCacheKey) const
+{
+    return transformCacheShards_[TransformCacheKeyHasher()(aTransformCacheKey) % Manager::TransformCacheShardCount];
+}
+
+Manager::TransformCacheKey Manager::TransformCacheKeyFrom(
+    const Uint64 aFromFrameId, const Uint64 aToFrameId, const Instant& anInstant
+)
+{
+    return {std::min(aFromFrameId, aToFrameId), std::max(aFromFrameId, aToFrameId), anInstant};
+}
+
+Shared<const Manager::FrameRegistry> Manager::accessFrameRegistry() const
+{
+    return frameRegistry_.load();
+}
+
+bool Manager::FrameKey::operator==(const FrameKey& aFrameKey) const
+{
+    return (kind == aFrameKey.kind) && (epoch == aFrameKey.epoch) && (parameter == aFrameKey.parameter);
+}
+
+std::size_t Manager::FrameKeyHasher::operator()(const FrameKey& aFrameKey) const
+{
+    std::size_t seed = std::hash<Instant>()(aFrameKey.epoch);
+
+    boost::hash_combine(seed, aFrameKey.kind);
+    boost::hash_combine(seed, aFrameKey.parameter);
+
+    return seed;
+}
+
+bool Manager::TransformCacheKey::operator==(const TransformCacheKey& aTransformCacheKey) const
+{
+    return (firstFrameId == aTransformCacheKey.firstFrameId) && (secondFrameId == aTransformCacheKey.secondFrameId) &&
+           (instant == aTransformCacheKey.instant);
+}
+
+std::size_t Manager::TransformCacheKeyHasher::operator()(const TransformCacheKey& aTransformCacheKey) const
+{
+    std::size_t seed = std::hash<Instant>()(aTransformCacheKey.instant);
+
+    boost::hash_combine(seed, aTransformCacheKey.firstFrameId);
+    boost::hash_combine(seed, aTransformCacheKey.secondFrameId);
+
+    return seed;
+}
+
+Manager::TransformCacheEntry::TransformCacheEntry(const Transform& aTransform, bool fromFirstFrame)
+    : transform(aTransform),
+      isFromFirstFrame(fromFirstFrame),
+      referenced(true)
 {
 }
 
@@ -15,6 +15,24 @@ Provider::Provider() {}
 
 Provider::~Provider() {}
 
+bool Provider::isTimeInvariant() const
+{
+    return false;
+}
+
+Array<Transform> Provider::getTransformsAt(const Array<Instant>& anInstantArray) const
+{
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    for (const auto& instant : anInstantArray)
+    {
+        transforms.add(this->getTransformAt(instant));
+    }
+
+    return transforms;
+}
+
 }  // namespace frame
 }  // namespace coordinate
 }  // namespace physics
@@ -1,6 +1,14 @@
 /// Apache License 2.0
 
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
@@ -27,7 +35,152 @@ namespace frame
 namespace provider
 {
 
-CIRF::CIRF() {}
+namespace
+{
+
+using ostk::core::type::Shared;
+
+static const double djmjd0 = 2400000.5;
+
+// Table grid: nodes every half day of MJD (TT), interpolated with an 8-point Lagrange polynomial (3 nodes before the
+// query interval, 5 after). A chunk holds the stencils of 64 consecutive grid intervals.
+
+static const double tableStep = 0.5;  // [day]
+static const int tableOrder = 8;
+static const int tableStencilOffset = 3;
+static const int tableChunkSize = 64;
+static const int tableChunkNodeCount = tableChunkSize + tableOrder - 1;
+
+struct XysChunk
+{
+    std::array<double, 3 * tableChunkNodeCount> values;  ///< (x, y, s) per node
+};
+
+class XysTable
+{
+   public:
+    static XysTable& Get()
+    {
+        static XysTable table;
+
+        return table;
+    }
+
+    Shared<const XysChunk> accessChunk(const std::int64_t aChunkIndex)
+    {
+        {
+            const std::shared_lock<std::shared_mutex> lock {mutex_};
+
+            const auto chunkIt = chunks_.find(aChunkIndex);
+
+            if (chunkIt != chunks_.end())
+            {
+                return chunkIt->second;
+            }
+        }
+
+        // Evaluate the series outside of the lock, concurrent evaluations of the same chunk yield identical values
+
+        const Shared<XysChunk> chunkSPtr = std::make_shared<XysChunk>();
+
+        const std::int64_t firstNodeIndex = aChunkIndex * tableChunkSize - tableStencilOffset;
+
+        for (int nodeIndex = 0; nodeIndex < tableChunkNodeCount; ++nodeIndex)
+        {
+            double* values = chunkSPtr->values.data() + 3 * nodeIndex;
+
+            iauXys06a(
+                djmjd0,
+                static_cast<double>(firstNodeIndex + nodeIndex) * tableStep,
+                &values[0],
+                &values[1],
+                &values[2]
+            );
+        }
+
+        const std::unique_lock<std::shared_mutex> lock {mutex_};
+
+        return chunks_.emplace(aChunkIndex, chunkSPtr).first->second;
+    }
+
+   private:
+    std::shared_mutex mutex_;
+    std::unordered_map<std::int64_t, Shared<const XysChunk>> chunks_;
+
+    XysTable() = default;
+};
+
+std::int64_t chunkIndexOf(const std::int64_t aGridIndex)
+{
+    return (aGridIndex >= 0) ? (aGridIndex / tableChunkSize) : (-((-aGridIndex - 1) / tableChunkSize) - 1);
+}
+
+void interpolateXys(const double aModifiedJulianDate, double& x, double& y, double& s)
+{
+    const double gridTime = aModifiedJulianDate / tableStep;
+    const std::int64_t gridIndex = static_cast<std::int64_t>(std::floor(gridTime));
+    const double u = gridTime - static_cast<double>(gridIndex);
+
+    const std::int64_t chunkIndex = chunkIndexOf(gridIndex);
+    const Shared<const XysChunk> chunkSPtr = XysTable::Get().accessChunk(chunkIndex);
+
+    const double* values = chunkSPtr->values.data() + 3 * (gridIndex - chunkIndex * tableChunkSize);
+
+    x = 0.0;
+    y = 0.0;
+    s = 0.0;
+
+    for (int i = 0; i < tableOrder; ++i)
+    {
+        double weight = 1.0;
+
+        for (int j = 0; j < tableOrder; ++j)
+        {
+            if (j != i)
+            {
+                weight *= (u - static_cast<double>(j - tableStencilOffset)) / static_cast<double>(i - j);
+            }
+        }
+
+        x += weight * values[3 * i + 0];
+        y += weight * values[3 * i + 1];
+        s += weight * values[3 * i + 2];
+    }
+}
+
+Transform computeTransform(const Instant& anInstant, const Real& aTtModifiedJulianDate, const CIRF::Mode& aMode)
+{
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+
+    // http://www.iausofa.org/2018_0130_C/sofa/sofa_pn_c.pdf
+
+    // GCRS to CIRS matrix
+
+    const Matrix3d rc2i = CIRF::ComputeMatrix(aTtModifiedJulianDate, aMode);  // dcm_CIRS_GCRS
+
+    const Vector3d GCRF_x_CIRF = Vector3d(rc2i.col(0)).normalized();
+    const Vector3d GCRF_y_CIRF = Vector3d(rc2i.col(1)).normalized();
+    const Vector3d GCRF_z_CIRF = Vector3d(rc2i.col(2)).normalized();
+
+    const RotationMatrix dcm_CIRF_GCRF = RotationMatrix::Columns(GCRF_x_CIRF, GCRF_y_CIRF, GCRF_z_CIRF);
+
+    // Output
+
+    const Vector3d x_CIRF_GCRF = {0.0, 0.0, 0.0};
+    const Vector3d v_CIRF_GCRF = {0.0, 0.0, 0.0};
+
+    const Quaternion q_CIRF_GCRF = Quaternion::RotationMatrix(dcm_CIRF_GCRF).rectify();
+    const Vector3d w_CIRF_GCRF_in_CIRF = {0.0, 0.0, 0.0};
+
+    return Transform::Passive(anInstant, x_CIRF_GCRF, v_CIRF_GCRF, q_CIRF_GCRF, w_CIRF_GCRF_in_CIRF);
+}
+
+}  // namespace
+
+CIRF::CIRF(const CIRF::Mode& aMode)
+    : mode_(aMode)
+{
+}
 
 CIRF::~CIRF() {}
 
@@ -41,11 +194,13 @@ bool CIRF::isDefined() const
     return true;
 }
 
-Transform CIRF::getTransformAt(const Instant& anInstant) const
+CIRF::Mode CIRF::getMode() const
 {
-    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+    return mode_;
+}
 
-    using ostk::physics::time::DateTime;
+Transform CIRF::getTransformAt(const Instant& anInstant) const
+{
     using ostk::physics::time::Scale;
 
     if (!anInstant.isDefined())
@@ -58,12 +213,65 @@ Transform CIRF::getTransformAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("CIRF");
     }
 
-    // http://www.iausofa.org/2018_0130_C/sofa/sofa_pn_c.pdf
+    return computeTransform(anInstant, anInstant.getModifiedJulianDate(Scale::TT), mode_);
+}
+
+Array<Transform> CIRF::getTransformsAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::physics::time::Scale;
+
+    for (const auto& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
 
-    // Time (TT)
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("CIRF");
+    }
 
-    static const Real djmjd0 = 2400000.5;
-    const Real tt = anInstant.getModifiedJulianDate(Scale::TT);
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    for (const auto& instant : anInstantArray)
+    {
+        transforms.add(computeTransform(instant, instant.getModifiedJulianDate(Scale::TT), mode_));
+    }
+
+    return transforms;
+}
+
+void CIRF::PrecomputeTable(const Interval& anInterval)
+{
+    using ostk::physics::time::Scale;
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    const std::int64_t firstChunkIndex = chunkIndexOf(
+        static_cast<std::int64_t>(std::floor(anInterval.accessStart().getModifiedJulianDate(Scale::TT) / tableStep))
+    );
+    const std::int64_t lastChunkIndex = chunkIndexOf(
+        static_cast<std::int64_t>(std::floor(anInterval.accessEnd().getModifiedJulianDate(Scale::TT) / tableStep))
+    );
+
+    for (std::int64_t chunkIndex = firstChunkIndex; chunkIndex <= lastChunkIndex; ++chunkIndex)
+    {
+        XysTable::Get().accessChunk(chunkIndex);
+    }
+}
+
+Matrix3d CIRF::ComputeMatrix(const Real& aModifiedJulianDate, const CIRF::Mode& aMode)
+{
+    if (!aModifiedJulianDate.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Modified julian date");
+    }
 
     // CIP and CIO, IAU 2006/2000A
 
@@ -71,7 +279,14 @@ Transform CIRF::getTransformAt(const Instant& anInstant) const
     double y;
     double s;
 
-    iauXys06a(djmjd0, tt, &x, &y, &s);
+    if (aMode == CIRF::Mode::Table)
+    {
+        interpolateXys(aModifiedJulianDate, x, y, s);
+    }
+    else
+    {
+        iauXys06a(djmjd0, aModifiedJulianDate, &x, &y, &s);
+    }
 
     // CIP offsets wrt IAU 2006/2000A (mas->radians)
 
@@ -89,21 +304,17 @@ Transform CIRF::getTransformAt(const Instant& anInstant) const
 
     iauC2ixys(x, y, s, rc2i);
 
-    const Vector3d GCRF_x_CIRF = Vector3d(rc2i[0][0], rc2i[1][0], rc2i[2][0]).normalized();
-    const Vector3d GCRF_y_CIRF = Vector3d(rc2i[0][1], rc2i[1][1], rc2i[2][1]).normalized();
-    const Vector3d GCRF_z_CIRF = Vector3d(rc2i[0][2], rc2i[1][2], rc2i[2][2]).normalized();
-
-    const RotationMatrix dcm_CIRF_GCRF = RotationMatrix::Columns(GCRF_x_CIRF, GCRF_y_CIRF, GCRF_z_CIRF);
-
-    // Output
-
-    const Vector3d x_CIRF_GCRF = {0.0, 0.0, 0.0};
-    const Vector3d v_CIRF_GCRF = {0.0, 0.0, 0.0};
+    Matrix3d dcm;
 
-    const Quaternion q_CIRF_GCRF = Quaternion::RotationMatrix(dcm_CIRF_GCRF).rectify();
-    const Vector3d w_CIRF_GCRF_in_CIRF = {0.0, 0.0, 0.0};
+    for (int rowIndex = 0; rowIndex < 3; ++rowIndex)
+    {
+        for (int columnIndex = 0; columnIndex < 3; ++columnIndex)
+        {
+            dcm(rowIndex, columnIndex) = rc2i[rowIndex][columnIndex];
+        }
+    }
 
-    return Transform::Passive(anInstant, x_CIRF_GCRF, v_CIRF_GCRF, q_CIRF_GCRF, w_CIRF_GCRF_in_CIRF);
+    return dcm;
 }
 
 }  // namespace provider
@@ -0,0 +1,203 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/RotationMatrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientation.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+// Include sofa last to avoid type errors in underlying Eigen lib
+#include <sofa/sofa.h>
+
+#define DAYSEC (86400.0)
+#define DAS2R (4.848136811095359935899141e-6)
+
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
+using IersManager = ostk::physics::coordinate::frame::provider::iers::Manager;
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+
+namespace
+{
+
+Transform computeTransform(
+    const Instant& anInstant, const EarthOrientationParameters& anEop, const CIRF::Mode& aCirfMode
+)
+{
+    using ostk::core::type::Real;
+
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+    using ostk::mathematics::object::Matrix3d;
+    using ostk::mathematics::object::Vector2d;
+
+    using ostk::physics::time::Scale;
+
+    // http://www.iausofa.org/2018_0130_C/sofa/sofa_pn_c.pdf
+
+    // Time arguments
+
+    static const Real djmjd0 = 2400000.5;
+
+    const Real tt = anInstant.getModifiedJulianDate(Scale::TT);
+    const Real utc = anInstant.getModifiedJulianDate(Scale::UTC);
+
+    const Real date = std::floor(utc);
+    const Real time = utc - date;
+
+    // Earth orientation parameters
+
+    const Real dut1 = anEop.ut1MinusUtc;             // [s]
+    const Vector2d polarMotion = anEop.polarMotion;  // [asec]
+
+    Real lod_ms = anEop.lod;  // [ms]
+
+    if (!lod_ms.isDefined())
+    {
+        lod_ms = 0.0;
+    }
+
+    // GCRS to CIRS matrix (see CIRF)
+
+    const Matrix3d dcm_CIRF_GCRF = CIRF::ComputeMatrix(tt, aCirfMode);
+
+    // CIRS to TIRS matrix, from the Earth rotation angle (see TIRF)
+
+    const Real era = iauEra00(djmjd0 + date, time + dut1 / DAYSEC);
+
+    const double cosEra = std::cos(era);
+    const double sinEra = std::sin(era);
+
+    Matrix3d dcm_TIRF_CIRF;
+    dcm_TIRF_CIRF << +cosEra, +sinEra, 0.0, -sinEra, +cosEra, 0.0, 0.0, 0.0, 1.0;
+
+    // TIRS to ITRS matrix, from polar motion and the TIO locator (see ITRF)
+
+    double rpom[3][3];
+
+    iauPom00(polarMotion.x() * DAS2R, polarMotion.y() * DAS2R, iauSp00(djmjd0, tt), rpom);
+
+    Matrix3d dcm_ITRF_TIRF;
+    dcm_ITRF_TIRF << rpom[0][0], rpom[0][1], rpom[0][2], rpom[1][0], rpom[1][1], rpom[1][2], rpom[2][0], rpom[2][1],
+        rpom[2][2];
+
+    // Combined matrix and angular velocity
+
+    const Matrix3d dcm_ITRF_GCRF = dcm_ITRF_TIRF * dcm_TIRF_CIRF * dcm_CIRF_GCRF;
+
+    const RotationMatrix rotationMatrix_ITRF_GCRF = {
+        dcm_ITRF_GCRF(0, 0),
+        dcm_ITRF_GCRF(0, 1),
+        dcm_ITRF_GCRF(0, 2),
+        dcm_ITRF_GCRF(1, 0),
+        dcm_ITRF_GCRF(1, 1),
+        dcm_ITRF_GCRF(1, 2),
+        dcm_ITRF_GCRF(2, 0),
+        dcm_ITRF_GCRF(2, 1),
+        dcm_ITRF_GCRF(2, 2)
+    };
+
+    const Real w_TIRF_CIRF = (72921151.467064 - 0.843994809 * lod_ms) *
+                             1e-12;  // [rad/s] https://www.iers.org/IERS/EN/Science/EarthRotation/UT1LOD.html
+
+    // Ω_ITRF_GCRF_in_ITRF = q_ITRF_TIRF * Ω_TIRF_CIRF_in_TIRF, as CIRF and ITRF do not rotate wrt their parents
+
+    const Vector3d x_ITRF_GCRF = {0.0, 0.0, 0.0};
+    const Vector3d v_ITRF_GCRF = {0.0, 0.0, 0.0};
+
+    const Quaternion q_ITRF_GCRF = Quaternion::RotationMatrix(rotationMatrix_ITRF_GCRF).toNormalized().rectify();
+    const Vector3d w_ITRF_GCRF_in_ITRF = Vector3d(dcm_ITRF_TIRF.col(2)) * w_TIRF_CIRF;
+
+    return Transform::Passive(anInstant, x_ITRF_GCRF, v_ITRF_GCRF, q_ITRF_GCRF, w_ITRF_GCRF_in_ITRF);
+}
+
+}  // namespace
+
+EarthOrientation::EarthOrientation(const CIRF::Mode& aCirfMode)
+    : cirfMode_(aCirfMode)
+{
+}
+
+EarthOrientation::~EarthOrientation() {}
+
+EarthOrientation* EarthOrientation::clone() const
+{
+    return new EarthOrientation(*this);
+}
+
+bool EarthOrientation::isDefined() const
+{
+    return true;
+}
+
+CIRF::Mode EarthOrientation::getCirfMode() const
+{
+    return cirfMode_;
+}
+
+Transform EarthOrientation::getTransformAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("EarthOrientation");
+    }
+
+    return computeTransform(anInstant, IersManager::Get().getEopAt(anInstant), cirfMode_);
+}
+
+Array<Transform> EarthOrientation::getTransformsAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::core::type::Size;
+
+    for (const auto& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("EarthOrientation");
+    }
+
+    // All instants are resolved against the same IERS snapshot
+
+    const Array<EarthOrientationParameters> eops = IersManager::Get().getEopAt(anInstantArray);
+
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    for (Size index = 0; index < anInstantArray.getSize(); ++index)
+    {
+        transforms.add(computeTransform(anInstantArray[index], eops[index], cirfMode_));
+    }
+
+    return transforms;
+}
+
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
@@ -27,6 +27,11 @@ bool GCRF::isDefined() const
     return true;
 }
 
+bool GCRF::isTimeInvariant() const
+{
+    return true;
+}
+
 Transform GCRF::getTransformAt(const Instant& anInstant) const
 {
     return Transform::Identity(anInstant);
@@ -1,17 +1,24 @@
 /// Apache License 2.0
 
-#include <fstream>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <string_view>
 
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/BulletinA.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Cache.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Parser.hpp>
 #include <OpenSpaceToolkit/Physics/Data/Utility.hpp>
 
 namespace ostk
@@ -27,8 +34,121 @@ namespace provider
 namespace iers
 {
 
+namespace cache = ostk::physics::data::cache;
+namespace parser = ostk::physics::data::parser;
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+using ostk::core::type::Uint32;
+
+using ostk::physics::data::parser::LineReader;
+using ostk::physics::data::parser::MappedFile;
 using ostk::physics::data::utilities::getFileModifiedInstant;
 
+namespace
+{
+
+// To be incremented whenever the cached content layout changes
+constexpr Uint32 cacheContentVersion = 1;
+
+// Sort rows by MJD, keeping the first of duplicate rows
+
+template <class Row>
+void sortRows(Array<Row>& aRowArray)
+{
+    std::stable_sort(
+        aRowArray.begin(),
+        aRowArray.end(),
+        [](const Row& aFirstRow, const Row& aSecondRow) -> bool
+        {
+            return static_cast<double>(aFirstRow.mjd) < static_cast<double>(aSecondRow.mjd);
+        }
+    );
+
+    aRowArray.erase(
+        std::unique(
+            aRowArray.begin(),
+            aRowArray.end(),
+            [](const Row& aFirstRow, const Row& aSecondRow) -> bool
+            {
+                return static_cast<double>(aFirstRow.mjd) == static_cast<double>(aSecondRow.mjd);
+            }
+        ),
+        aRowArray.end()
+    );
+}
+
+// Index of the row at a given MJD, or the row count if there is none. Daily rows are indexed directly.
+
+template <class Row>
+Index findRowIndex(const Array<Row>& aRowArray, const double aModifiedJulianDate)
+{
+    if (aRowArray.isEmpty())
+    {
+        return 0;
+    }
+
+    const double offset = aModifiedJulianDate - static_cast<double>(aRowArray.accessFirst().mjd);
+
+    if ((offset >= 0.0) && (offset < static_cast<double>(aRowArray.getSize())))
+    {
+        const Index rowIndex = static_cast<Index>(offset);
+
+        if (static_cast<double>(aRowArray[rowIndex].mjd) == aModifiedJulianDate)
+        {
+            return rowIndex;
+        }
+    }
+
+    const auto rowIt = std::lower_bound(
+        aRowArray.begin(),
+        aRowArray.end(),
+        aModifiedJulianDate,
+        [](const Row& aRow, const double aValue) -> bool
+        {
+            return static_cast<double>(aRow.mjd) < aValue;
+        }
+    );
+
+    if ((rowIt != aRowArray.end()) && (static_cast<double>(rowIt->mjd) == aModifiedJulianDate))
+    {
+        return static_cast<Index>(std::distance(aRowArray.begin(), rowIt));
+    }
+
+    return aRowArray.getSize();
+}
+
+// Check that a word only holds digits and, if allowed, a leading minus sign and decimal points
+
+bool isNumberWord(const std::string_view& aWord, const bool allowSign, const bool allowPoint)
+{
+    std::size_t position = 0;
+
+    if (allowSign && (!aWord.empty()) && (aWord.front() == '-'))
+    {
+        position = 1;
+    }
+
+    if (position >= aWord.size())
+    {
+        return false;
+    }
+
+    for (; position < aWord.size(); ++position)
+    {
+        const char character = aWord[position];
+
+        if (!(((character >= '0') && (character <= '9')) || (allowPoint && (character == '.'))))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace
+
 std::ostream& operator<<(std::ostream& anOutputStream, const BulletinA& aBulletinA)
 {
     using ostk::core::type::String;
@@ -57,10 +177,8 @@ std::ostream& operator<<(std::ostream& anOutputStream, const BulletinA& aBulleti
 
     ostk::core::utils::Print::Separator(anOutputStream, "Observation");
 
-    for (const auto& observationIt : aBulletinA.observations_)
+    for (const auto& observation : aBulletinA.observations_)
     {
-        const BulletinA::Observation& observation = observationIt.second;
-
         ostk::core::utils::Print::Line(anOutputStream) << String::Format(
             "{:>4d}  {:>2d}  {:>2d}  {:>5d}  {:f}  {:f}  {:f}  {:f}  {:f}  {:f}",
             static_cast<int>(observation.year),
@@ -78,10 +196,8 @@ std::ostream& operator<<(std::ostream& anOutputStream, const BulletinA& aBulleti
 
     ostk::core::utils::Print::Separator(anOutputStream, "Prediction");
 
-    for (const auto& predictionIt : aBulletinA.predictions_)
+    for (const auto& prediction : aBulletinA.predictions_)
     {
-        const BulletinA::Prediction& prediction = predictionIt.second;
-
         ostk::core::utils::Print::Line(anOutputStream) << String::Format(
             "{:>4d}  {:>2d}  {:>2d}  {:>5d}  {:f}  {:f}  {:f}",
             static_cast<int>(prediction.year),
@@ -102,8 +218,8 @@ std::ostream& operator<<(std::ostream& anOutputStream, const BulletinA& aBulleti
 bool BulletinA::isDefined() const
 {
     return releaseDate_.isDefined() && taiMinusUtc_.isDefined() && taiMinusUtcEpoch_.isDefined() &&
-           observationInterval_.isDefined() && (!observations_.empty()) && predictionInterval_.isDefined() &&
-           (!predictions_.empty());
+           observationInterval_.isDefined() && (!observations_.isEmpty()) && predictionInterval_.isDefined() &&
+           (!predictions_.isEmpty());
 }
 
 const Date& BulletinA::accessReleaseDate() const
@@ -212,42 +328,38 @@ BulletinA::Observation BulletinA::getObservationAt(const Instant& anInstant) con
 
     const Real instantMjd = anInstant.getModifiedJulianDate(Scale::UTC);
 
-    const auto observationIt = observations_.find(instantMjd.floor());
+    const Index observationIndex = findRowIndex(observations_, std::floor(static_cast<double>(instantMjd)));
 
-    if (observationIt != observations_.end())
+    if (observationIndex < observations_.getSize())
     {
         if (instantMjd.isInteger())
         {
-            return observationIt->second;
+            return observations_[observationIndex];
         }
         else
         {
-            const auto nextObservationIt = std::next(observationIt);
+            Index observation1Index = observationIndex;
+            Index observation2Index = observationIndex;
 
-            auto observation1It = observations_.begin();
-            auto observation2It = observations_.begin();
-
-            if (nextObservationIt != observations_.end())
+            if ((observationIndex + 1) < observations_.getSize())
             {
                 // linearly interpolate between two observations
-                observation1It = observationIt;
-                observation2It = nextObservationIt;
+                observation2Index = observationIndex + 1;
             }
             else
             {
                 // linearly extrapolate from the last two observations to fill the gap before the first prediction
-                observation1It = std::prev(observationIt);
-                observation2It = observationIt;
+                observation1Index = observationIndex - 1;
             }
 
-            const Integer year = observationIt->second.year;
-            const Integer month = observationIt->second.month;
-            const Integer day = observationIt->second.day;
+            const Integer year = observations_[observationIndex].year;
+            const Integer month = observations_[observationIndex].month;
+            const Integer day = observations_[observationIndex].day;
 
             // [TBI] IERS gazette #13 for more precise interpolation and correction for tidal effects
 
-            const Observation observation1 = observation1It->second;
-            const Observation observation2 = observation2It->second;
+            const Observation& observation1 = observations_[observation1Index];
+            const Observation& observation2 = observations_[observation2Index];
 
             const Real ratio = (instantMjd - observation1.mjd) / (observation2.mjd - observation1.mjd);
 
@@ -308,24 +420,22 @@ BulletinA::Prediction BulletinA::getPredictionAt(const Instant& anInstant) const
 
     const Real instantMjd = anInstant.getModifiedJulianDate(Scale::UTC);
 
-    const auto predictionIt = predictions_.find(instantMjd.floor());
+    const Index predictionIndex = findRowIndex(predictions_, std::floor(static_cast<double>(instantMjd)));
 
-    if (predictionIt != predictions_.end())
+    if (predictionIndex < predictions_.getSize())
     {
         if (instantMjd.isInteger())
         {
-            return predictionIt->second;
+            return predictions_[predictionIndex];
         }
         else
         {
-            const auto nextPredictionIt = std::next(predictionIt);
-
-            if (nextPredictionIt != predictions_.end())
+            if ((predictionIndex + 1) < predictions_.getSize())
             {
                 // [TBI] IERS gazette #13 for more precise interpolation and correction for tidal effects
 
-                const BulletinA::Prediction& previousPrediction = predictionIt->second;
-                const BulletinA::Prediction& nextPrediction = nextPredictionIt->second;
+                const BulletinA::Prediction& previousPrediction = predictions_[predictionIndex];
+                const BulletinA::Prediction& nextPrediction = predictions_[predictionIndex + 1];
 
                 const Real ratio =
                     (instantMjd - previousPrediction.mjd) / (nextPrediction.mjd - previousPrediction.mjd);
@@ -457,94 +567,136 @@ BulletinA BulletinA::Load(const filesystem::File& aFile)
 
     bulletin.lastModifiedTimestamp_ = getFileModifiedInstant(aFile);
 
-    std::ifstream fileStream {aFile.getPath().toString()};
+    const MappedFile mappedFile = {aFile};
+
+    LineReader lineReader = {mappedFile.accessContent()};
 
     Index lineIndex = 0;
-    String line;
+    std::string_view line;
 
     static const boost::regex releaseDateRegex =
         boost::regex("^[ ]+([\\d]+) ([\\w]+) ([\\d]+)[ ]+Vol\\.[\\d\\w\\. ]+$");
     static const boost::regex taiMinusUtcEpochRegex = boost::regex("^[ ]+Beginning ([\\d]+) ([\\w]+) ([\\d]+):[ ]+$");
     static const boost::regex taiMinusUtcRegex = boost::regex("^[ ]+TAI-UTC = ([-]?[\\d.]+) ([\\d]+) seconds[ ]+$");
-    static const boost::regex observationRegex = boost::regex(
-        "^[ ]+([\\d]+)[ ]+([\\d]+)[ ]+([\\d]+)[ ]+([\\d]+)[ ]+([-]?[\\d.]+)[ ]+([\\d.]+)[ ]+([-]?[\\d.]+)[ "
-        "]+([\\d.]+)[ ]+([-]?[\\d.]+)[ ]+([\\d.]+)[ ]+$"
-    );
-    static const boost::regex predictionRegex = boost::regex(
-        "^[ ]+([\\d]{4})[ ]+([\\d]+)[ ]+([\\d]+)[ ]+([\\d]+)[ ]+([-]?[\\d.]+)[ ]+([-]?[\\d.]+)[ ]+([-]?[\\d.]+)[ ]+$"
-    );
 
-    // Quick and dirty implementation.
-    // The part below can be greatly improved:
-    // - If Bulletin A has constant line count, using line index based parsing will be much faster
-    // - Use flags to identify sections, to avoid regex'ing each line
+    const auto parseInteger = [](const std::string_view& aWord) -> int
+    {
+        int value = 0;
+
+        if (!parser::parseInteger(aWord, value))
+        {
+            throw ostk::core::error::RuntimeError("Cannot parse integer [{}].", std::string(aWord));
+        }
 
-    boost::smatch match;
+        return value;
+    };
 
-    while (std::getline(fileStream, line))
+    const auto parseReal = [](const std::string_view& aWord) -> double
     {
-        if ((lineIndex < 10) && (!bulletin.releaseDate_.isDefined()) &&
-            boost::regex_match(line, match, releaseDateRegex))
-        {
-            const Uint8 day = static_cast<Uint8>(boost::lexical_cast<Uint16>(match[1]));
-            const Uint8 month = monthFromString(String(match[2]));
-            const Uint16 year = boost::lexical_cast<Uint16>(match[3]);
+        double value = 0.0;
 
-            bulletin.releaseDate_ = Date(year, month, day);
+        if (!parser::parseReal(aWord, value))
+        {
+            throw ostk::core::error::RuntimeError("Cannot parse real [{}].", std::string(aWord));
         }
 
-        if ((lineIndex < 30) && (!bulletin.taiMinusUtcEpoch_.isDefined()) &&
-            boost::regex_match(line, match, taiMinusUtcEpochRegex))
+        return value;
+    };
+
+    // Header lines are matched against regular expressions, observation and prediction rows are tokenized in place.
+    // Rows are space-separated, with leading and trailing spaces:
+    //
+    // - Observations: YY MM DD MJD x xError y yError UT1-UTC UT1-UTCError
+    // - Predictions: YYYY MM DD MJD x y UT1-UTC
+
+    std::string_view words[11];
+
+    while (lineReader.readLine(line))
+    {
+        if (lineIndex < 30)
         {
-            const Uint8 day = static_cast<Uint8>(boost::lexical_cast<Uint16>(match[1]));
-            const Uint8 month = monthFromString(String(match[2]));
-            const Uint16 year = boost::lexical_cast<Uint16>(match[3]);
+            const std::string headerLine {line};
 
-            bulletin.taiMinusUtcEpoch_ =
-                Instant::DateTime(DateTime(Date(year, month, day), Time::Midnight()), Scale::UTC);  // [TBC] UTC?
+            boost::smatch match;
+
+            if ((lineIndex < 10) && (!bulletin.releaseDate_.isDefined()) &&
+                boost::regex_match(headerLine, match, releaseDateRegex))
+            {
+                const Uint8 day = static_cast<Uint8>(boost::lexical_cast<Uint16>(match[1]));
+                const Uint8 month = monthFromString(String(match[2]));
+                const Uint16 year = boost::lexical_cast<Uint16>(match[3]);
+
+                bulletin.releaseDate_ = Date(year, month, day);
+            }
+
+            if ((!bulletin.taiMinusUtcEpoch_.isDefined()) &&
+                boost::regex_match(headerLine, match, taiMinusUtcEpochRegex))
+            {
+                const Uint8 day = static_cast<Uint8>(boost::lexical_cast<Uint16>(match[1]));
+                const Uint8 month = monthFromString(String(match[2]));
+                const Uint16 year = boost::lexical_cast<Uint16>(match[3]);
+
+                bulletin.taiMinusUtcEpoch_ =
+                    Instant::DateTime(DateTime(Date(year, month, day), Time::Midnight()), Scale::UTC);  // [TBC] UTC?
+            }
+
+            if ((!bulletin.taiMinusUtc_.isDefined()) && boost::regex_match(headerLine, match, taiMinusUtcRegex))
+            {
+                const Real seconds =
+                    boost::lexical_cast<double>(match[1]) + boost::lexical_cast<double>(match[2]) / 1e6;
+
+                bulletin.taiMinusUtc_ = Duration::Seconds(seconds);
+            }
         }
 
-        if ((lineIndex < 30) && (!bulletin.taiMinusUtc_.isDefined()) &&
-            boost::regex_match(line, match, taiMinusUtcRegex))
-        {
-            const Real seconds = boost::lexical_cast<double>(match[1]) + boost::lexical_cast<double>(match[2]) / 1e6;
+        lineIndex++;
 
-            bulletin.taiMinusUtc_ = Duration::Seconds(seconds);
+        if ((line.size() < 2) || (line.front() != ' ') || (line.back() != ' '))
+        {
+            continue;
         }
 
-        if (boost::regex_match(line, match, observationRegex))
+        const Size wordCount = parser::splitWhitespace(line, words, 11);
+
+        if ((wordCount == 10) && isNumberWord(words[0], false, false) && isNumberWord(words[1], false, false) &&
+            isNumberWord(words[2], false, false) && isNumberWord(words[3], false, false) &&
+            isNumberWord(words[4], true, true) && isNumberWord(words[5], false, true) &&
+            isNumberWord(words[6], true, true) && isNumberWord(words[7], false, true) &&
+            isNumberWord(words[8], true, true) && isNumberWord(words[9], false, true))
         {
-            const Integer year = 2000 + boost::lexical_cast<int>(match[1]);
-            const Integer month = boost::lexical_cast<int>(match[2]);
-            const Integer day = boost::lexical_cast<int>(match[3]);
+            const Integer year = 2000 + parseInteger(words[0]);
+            const Integer month = parseInteger(words[1]);
+            const Integer day = parseInteger(words[2]);
 
-            const Integer mjd = boost::lexical_cast<int>(match[4]);
+            const Integer mjd = parseInteger(words[3]);
 
-            const Real x = boost::lexical_cast<double>(match[5]);
-            const Real xError = boost::lexical_cast<double>(match[6]);
-            const Real y = boost::lexical_cast<double>(match[7]);
-            const Real yError = boost::lexical_cast<double>(match[8]);
-            const Real ut1MinusUtc = boost::lexical_cast<double>(match[9]);
-            const Real ut1MinusUtcError = boost::lexical_cast<double>(match[10]);
+            const Real x = parseReal(words[4]);
+            const Real xError = parseReal(words[5]);
+            const Real y = parseReal(words[6]);
+            const Real yError = parseReal(words[7]);
+            const Real ut1MinusUtc = parseReal(words[8]);
+            const Real ut1MinusUtcError = parseReal(words[9]);
 
             const BulletinA::Observation observation = {
                 year, month, day, Real::Integer(mjd), x, xError, y, yError, ut1MinusUtc, ut1MinusUtcError
             };
 
-            bulletin.observations_.insert({mjd, observation});
+            bulletin.observations_.add(observation);
         }
-
-        if (boost::regex_match(line, match, predictionRegex))
+        else if ((wordCount == 7) && (words[0].size() == 4) && isNumberWord(words[0], false, false) &&
+                 isNumberWord(words[1], false, false) && isNumberWord(words[2], false, false) &&
+                 isNumberWord(words[3], false, false) && isNumberWord(words[4], true, true) &&
+                 isNumberWord(words[5], true, true) && isNumberWord(words[6], true, true))
         {
-            const Integer year = boost::lexical_cast<int>(match[1]);
-            const Integer month = boost::lexical_cast<int>(match[2]);
-            const Integer day = boost::lexical_cast<int>(match[3]);
+            const Integer year = parseInteger(words[0]);
+            const Integer month = parseInteger(words[1]);
+            const Integer day = parseInteger(words[2]);
 
-            const Integer mjd = boost::lexical_cast<int>(match[4]);
+            const Integer mjd = parseInteger(words[3]);
 
-            const Real x = boost::lexical_cast<double>(match[5]);
-            const Real y = boost::lexical_cast<double>(match[6]);
-            const Real ut1MinusUtc = boost::lexical_cast<double>(match[7]);
+            const Real x = parseReal(words[4]);
+            const Real y = parseReal(words[5]);
+            const Real ut1MinusUtc = parseReal(words[6]);
 
             const BulletinA::Prediction prediction = {
                 year,
@@ -556,34 +708,144 @@ BulletinA BulletinA::Load(const filesystem::File& aFile)
                 ut1MinusUtc,
             };
 
-            bulletin.predictions_.insert({mjd, prediction});
+            bulletin.predictions_.add(prediction);
         }
-
-        lineIndex++;
     }
 
-    if (!bulletin.observations_.empty())
+    sortRows(bulletin.observations_);
+    sortRows(bulletin.predictions_);
+
+    bulletin.setIntervals();
+
+    return bulletin;
+}
+
+BulletinA BulletinA::LoadCached(const filesystem::File& aFile)
+{
+    using ostk::physics::time::DateTime;
+    using ostk::physics::time::Scale;
+    using ostk::physics::time::Time;
+
+    if (!aFile.isDefined())
     {
-        const Instant observationStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(bulletin.observations_.begin()->first), Scale::UTC);
-        const Instant observationEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(bulletin.observations_.rbegin()->first), Scale::UTC) +
-            Duration::Days(1);
+        throw ostk::core::error::runtime::Undefined("File");
+    }
 
-        bulletin.observationInterval_ =
-            Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
     }
 
-    if (!bulletin.predictions_.empty())
+    BulletinA bulletin;
+
+    const bool isCacheLoaded = cache::Load(
+        aFile,
+        "BulletinA",
+        cacheContentVersion,
+        [&bulletin](cache::Reader& aReader) -> void
+        {
+            bulletin.releaseDate_ = aReader.readDate();
+
+            const Real taiMinusUtcNanoseconds = aReader.readReal();
+
+            bulletin.taiMinusUtc_ = taiMinusUtcNanoseconds.isDefined() ? Duration::Nanoseconds(taiMinusUtcNanoseconds)
+                                                                       : Duration::Undefined();
+
+            const Date taiMinusUtcEpochDate = aReader.readDate();
+
+            bulletin.taiMinusUtcEpoch_ =
+                taiMinusUtcEpochDate.isDefined()
+                    ? Instant::DateTime(DateTime(taiMinusUtcEpochDate, Time::Midnight()), Scale::UTC)
+                    : Instant::Undefined();
+
+            const Size observationCount = aReader.readSize();
+
+            for (Index observationIndex = 0; observationIndex < observationCount; ++observationIndex)
+            {
+                bulletin.observations_.add({
+                    aReader.readInteger(),
+                    aReader.readInteger(),
+                    aReader.readInteger(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                });
+            }
+
+            const Size predictionCount = aReader.readSize();
+
+            for (Index predictionIndex = 0; predictionIndex < predictionCount; ++predictionIndex)
+            {
+                bulletin.predictions_.add({
+                    aReader.readInteger(),
+                    aReader.readInteger(),
+                    aReader.readInteger(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                    aReader.readReal(),
+                });
+            }
+        }
+    );
+
+    if (!isCacheLoaded)
     {
-        const Instant predictionStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(bulletin.predictions_.begin()->first), Scale::UTC);
-        const Instant predictionEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(bulletin.predictions_.rbegin()->first), Scale::UTC);
+        bulletin = BulletinA::Load(aFile);
+
+        cache::Writer writer;
+
+        writer.writeDate(bulletin.releaseDate_);
+        writer.writeReal(
+            bulletin.taiMinusUtc_.isDefined() ? bulletin.taiMinusUtc_.inNanoseconds() : Real::Undefined()
+        );
+        writer.writeDate(
+            bulletin.taiMinusUtcEpoch_.isDefined() ? bulletin.taiMinusUtcEpoch_.getDateTime(Scale::UTC).getDate()
+                                                   : Date::Undefined()
+        );
+
+        writer.writeSize(bulletin.observations_.getSize());
+
+        for (const auto& observation : bulletin.observations_)
+        {
+            writer.writeInteger(observation.year);
+            writer.writeInteger(observation.month);
+            writer.writeInteger(observation.day);
+            writer.writeReal(observation.mjd);
+            writer.writeReal(observation.x);
+            writer.writeReal(observation.xError);
+            writer.writeReal(observation.y);
+            writer.writeReal(observation.yError);
+            writer.writeReal(observation.ut1MinusUtc);
+            writer.writeReal(observation.ut1MinusUtcError);
+        }
+
+        writer.writeSize(bulletin.predictions_.getSize());
 
-        bulletin.predictionInterval_ = Interval::Closed(predictionStartInstant, predictionEndInstant);
+        for (const auto& prediction : bulletin.predictions_)
+        {
+            writer.writeInteger(prediction.year);
+            writer.writeInteger(prediction.month);
+            writer.writeInteger(prediction.day);
+            writer.writeReal(prediction.mjd);
+            writer.writeReal(prediction.x);
+            writer.writeReal(prediction.y);
+            writer.writeReal(prediction.ut1MinusUtc);
+        }
+
+        cache::Save(aFile, "BulletinA", cacheContentVersion, writer);
+
+        return bulletin;
     }
 
+    bulletin.lastModifiedTimestamp_ = getFileModifiedInstant(aFile);
+
+    bulletin.setIntervals();
+
     return bulletin;
 }
 
@@ -593,10 +855,32 @@ BulletinA::BulletinA()
       taiMinusUtc_(Duration::Undefined()),
       taiMinusUtcEpoch_(Instant::Undefined()),
       observationInterval_(Interval::Undefined()),
-      observations_(Map<Integer, BulletinA::Observation>()),
+      observations_(Array<BulletinA::Observation>::Empty()),
       predictionInterval_(Interval::Undefined()),
-      predictions_(Map<Integer, BulletinA::Prediction>())
+      predictions_(Array<BulletinA::Prediction>::Empty())
+{
+}
+
+void BulletinA::setIntervals()
 {
+    using ostk::physics::time::Scale;
+
+    if (!observations_.isEmpty())
+    {
+        const Instant observationStartInstant = Instant::ModifiedJulianDate(observations_.accessFirst().mjd, Scale::UTC);
+        const Instant observationEndInstant =
+            Instant::ModifiedJulianDate(observations_.accessLast().mjd, Scale::UTC) + Duration::Days(1);
+
+        observationInterval_ = Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
+    }
+
+    if (!predictions_.isEmpty())
+    {
+        const Instant predictionStartInstant = Instant::ModifiedJulianDate(predictions_.accessFirst().mjd, Scale::UTC);
+        const Instant predictionEndInstant = Instant::ModifiedJulianDate(predictions_.accessLast().mjd, Scale::UTC);
+
+        predictionInterval_ = Interval::Closed(predictionStartInstant, predictionEndInstant);
+    }
 }
 
 }  // namespace iers
@@ -0,0 +1,67 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EarthOrientationParameters.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+namespace iers
+{
+
+bool EarthOrientationParameters::isDefined() const
+{
+    return (source != EarthOrientationParameters::Source::Undefined) && polarMotion.isDefined() &&
+           ut1MinusUtc.isDefined();
+}
+
+EarthOrientationParameters EarthOrientationParameters::Undefined()
+{
+    return {
+        EarthOrientationParameters::Source::Undefined,
+        Vector2d::Undefined(),
+        Real::Undefined(),
+        Real::Undefined(),
+        Real::Undefined(),
+        Real::Undefined()
+    };
+}
+
+String EarthOrientationParameters::StringFromSource(const EarthOrientationParameters::Source& aSource)
+{
+    switch (aSource)
+    {
+        case EarthOrientationParameters::Source::Undefined:
+            return "Undefined";
+
+        case EarthOrientationParameters::Source::BulletinAObservation:
+            return "Bulletin A Observation";
+
+        case EarthOrientationParameters::Source::BulletinAPrediction:
+            return "Bulletin A Prediction";
+
+        case EarthOrientationParameters::Source::Finals2000A:
+            return "Finals 2000A";
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Source");
+            break;
+    }
+
+    return String::Empty();
+}
+
+}  // namespace iers
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
@@ -1,17 +1,24 @@
 /// Apache License 2.0
 
-#include <fstream>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <sstream>
+#include <string>
+#include <string_view>
 
 #include <boost/lexical_cast.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Finals2000A.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Cache.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Parser.hpp>
 #include <OpenSpaceToolkit/Physics/Data/Utility.hpp>
 
 namespace ostk
@@ -27,8 +34,104 @@ namespace provider
 namespace iers
 {
 
+namespace cache = ostk::physics::data::cache;
+namespace parser = ostk::physics::data::parser;
+
+using ostk::core::type::Size;
+using ostk::core::type::Uint32;
+
+using ostk::physics::data::parser::LineReader;
+using ostk::physics::data::parser::MappedFile;
 using ostk::physics::data::utilities::getFileModifiedInstant;
 
+namespace
+{
+
+// To be incremented whenever the cached content layout changes
+constexpr Uint32 cacheContentVersion = 1;
+
+void writeData(cache::Writer& aWriter, const Finals2000A::Data& aData)
+{
+    aWriter.writeInteger(aData.year);
+    aWriter.writeInteger(aData.month);
+    aWriter.writeInteger(aData.day);
+    aWriter.writeReal(aData.mjd);
+    aWriter.writeCharacter(aData.polarMotionflag);
+    aWriter.writeReal(aData.x_A);
+    aWriter.writeReal(aData.xError_A);
+    aWriter.writeReal(aData.y_A);
+    aWriter.writeReal(aData.yError_A);
+    aWriter.writeCharacter(aData.ut1MinusUtcFlag);
+    aWriter.writeReal(aData.ut1MinusUtc_A);
+    aWriter.writeReal(aData.ut1MinusUtcError_A);
+    aWriter.writeReal(aData.lod_A);
+    aWriter.writeReal(aData.lodError_A);
+    aWriter.writeCharacter(aData.nutationFlag);
+    aWriter.writeReal(aData.dx_A);
+    aWriter.writeReal(aData.dxError_A);
+    aWriter.writeReal(aData.dy_A);
+    aWriter.writeReal(aData.dyError_A);
+    aWriter.writeReal(aData.x_B);
+    aWriter.writeReal(aData.y_B);
+    aWriter.writeReal(aData.ut1MinusUtc_B);
+    aWriter.writeReal(aData.dx_B);
+    aWriter.writeReal(aData.dy_B);
+}
+
+Finals2000A::Data readData(cache::Reader& aReader)
+{
+    // Braced initializers are evaluated in order
+
+    return {
+        aReader.readInteger(),
+        aReader.readInteger(),
+        aReader.readInteger(),
+        aReader.readReal(),
+        aReader.readCharacter(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readCharacter(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readCharacter(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal(),
+        aReader.readReal()
+    };
+}
+
+double toColumnValue(const Real& aValue)
+{
+    return aValue.isDefined() ? static_cast<double>(aValue) : std::numeric_limits<double>::quiet_NaN();
+}
+
+Real fromColumnValue(const double aValue)
+{
+    return std::isnan(aValue) ? Real::Undefined() : Real(aValue);
+}
+
+// Linear interpolation, NaN if any bound is undefined
+
+double interpolateColumn(const std::vector<double>& aColumn, const Index aPreviousIndex, const double aRatio)
+{
+    const double previousValue = aColumn[aPreviousIndex];
+    const double nextValue = aColumn[aPreviousIndex + 1];
+
+    return previousValue + aRatio * (nextValue - previousValue);
+}
+
+}  // namespace
+
 std::ostream& operator<<(std::ostream& anOutputStream, const Finals2000A& aFinals2000A)
 {
     using ostk::core::type::String;
@@ -85,29 +188,20 @@ Vector2d Finals2000A::getPolarMotionAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    const Pair<const Finals2000A::Data*, const Finals2000A::Data*> dataRange = this->accessDataRange(anInstant);
+    Index previousIndex = 0;
+    double ratio = 0.0;
 
-    if ((dataRange.first != nullptr) && (dataRange.second != nullptr))
+    if (this->accessBracket(anInstant.getModifiedJulianDate(Scale::UTC), previousIndex, ratio))
     {
-        const Finals2000A::Data& previousData = *(dataRange.first);
-        const Finals2000A::Data& nextData = *(dataRange.second);
-
-        if (previousData.x_A.isDefined() && previousData.y_A.isDefined() && nextData.x_A.isDefined() &&
-            nextData.y_A.isDefined())
-        {
-            const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
-
-            const Real ratio = (instantMjd_UTC - previousData.mjd) / (nextData.mjd - previousData.mjd);
-
-            const Real x_A = previousData.x_A + ratio * (nextData.x_A - previousData.x_A);
-            const Real y_A = previousData.y_A + ratio * (nextData.y_A - previousData.y_A);
+        const double x_A = interpolateColumn(x_, previousIndex, ratio);
+        const double y_A = interpolateColumn(y_, previousIndex, ratio);
 
-            return {x_A, y_A};
-        }
-        else
+        if (std::isnan(x_A) || std::isnan(y_A))
         {
             return Vector2d::Undefined();
         }
+
+        return {x_A, y_A};
     }
 
     throw ostk::core::error::RuntimeError("Cannot get polar motion at [{}].", anInstant.toString(Scale::UTC));
@@ -127,30 +221,12 @@ Real Finals2000A::getUt1MinusUtcAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    const Pair<const Finals2000A::Data*, const Finals2000A::Data*> dataRange = this->accessDataRange(anInstant);
+    Index previousIndex = 0;
+    double ratio = 0.0;
 
-    if ((dataRange.first != nullptr) && (dataRange.second != nullptr))
+    if (this->accessBracket(anInstant.getModifiedJulianDate(Scale::UTC), previousIndex, ratio))
     {
-        const Finals2000A::Data& previousData = *(dataRange.first);
-        const Finals2000A::Data& nextData = *(dataRange.second);
-
-        if (previousData.ut1MinusUtc_A.isDefined() && nextData.ut1MinusUtc_A.isDefined())
-        {
-            const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
-
-            const Real ratio = (instantMjd_UTC - previousData.mjd) / (nextData.mjd - previousData.mjd);
-
-            const Real ut1MinusUtc_A =
-                previousData.ut1MinusUtc_A + ratio * (nextData.ut1MinusUtc_A - previousData.ut1MinusUtc_A);
-            // const Real ut1MinusUtc_B = previousData.ut1MinusUtc_B + ratio * (nextData.ut1MinusUtc_B -
-            // previousData.ut1MinusUtc_B) ;
-
-            return ut1MinusUtc_A;
-        }
-        else
-        {
-            return Real::Undefined();
-        }
+        return fromColumnValue(interpolateColumn(ut1MinusUtc_, previousIndex, ratio));
     }
 
     throw ostk::core::error::RuntimeError("Cannot get UT1 - UTC at [{}].", anInstant.toString(Scale::UTC));
@@ -170,30 +246,50 @@ Real Finals2000A::getLodAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    const Pair<const Finals2000A::Data*, const Finals2000A::Data*> dataRange = this->accessDataRange(anInstant);
+    Index previousIndex = 0;
+    double ratio = 0.0;
 
-    if ((dataRange.first != nullptr) && (dataRange.second != nullptr))
+    if (this->accessBracket(anInstant.getModifiedJulianDate(Scale::UTC), previousIndex, ratio))
     {
-        const Finals2000A::Data& previousData = *(dataRange.first);
-        const Finals2000A::Data& nextData = *(dataRange.second);
+        return fromColumnValue(interpolateColumn(lod_, previousIndex, ratio));
+    }
 
-        if (previousData.lod_A.isDefined() && nextData.lod_A.isDefined())
-        {
-            const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
+    throw ostk::core::error::RuntimeError("Cannot get length of day at [{}].", anInstant.toString(Scale::UTC));
+}
 
-            const Real ratio = (instantMjd_UTC - previousData.mjd) / (nextData.mjd - previousData.mjd);
+EarthOrientationParameters Finals2000A::getEopAt(const Instant& anInstant) const
+{
+    using ostk::physics::time::Scale;
 
-            const Real lod_A = previousData.lod_A + ratio * (nextData.lod_A - previousData.lod_A);
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
 
-            return lod_A;
-        }
-        else
-        {
-            return Real::Undefined();
-        }
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    throw ostk::core::error::RuntimeError("Cannot get length of day at [{}].", anInstant.toString(Scale::UTC));
+    Index previousIndex = 0;
+    double ratio = 0.0;
+
+    if (!this->accessBracket(anInstant.getModifiedJulianDate(Scale::UTC), previousIndex, ratio))
+    {
+        return EarthOrientationParameters::Undefined();
+    }
+
+    const double x_A = interpolateColumn(x_, previousIndex, ratio);
+    const double y_A = interpolateColumn(y_, previousIndex, ratio);
+
+    return {
+        EarthOrientationParameters::Source::Finals2000A,
+        (std::isnan(x_A) || std::isnan(y_A)) ? Vector2d::Undefined() : Vector2d(x_A, y_A),
+        fromColumnValue(interpolateColumn(ut1MinusUtc_, previousIndex, ratio)),
+        fromColumnValue(interpolateColumn(lod_, previousIndex, ratio)),
+        fromColumnValue(interpolateColumn(dx_, previousIndex, ratio)),
+        fromColumnValue(interpolateColumn(dy_, previousIndex, ratio))
+    };
 }
 
 Finals2000A::Data Finals2000A::getDataAt(const Instant& anInstant) const
@@ -210,9 +306,10 @@ Finals2000A::Data Finals2000A::getDataAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Finals 2000A");
     }
 
-    const Pair<const Finals2000A::Data*, const Finals2000A::Data*> dataRange = this->accessDataRange(anInstant);
+    Index previousIndex = 0;
+    double bracketRatio = 0.0;
 
-    if ((dataRange.first != nullptr) && (dataRange.second != nullptr))
+    if (this->accessBracket(anInstant.getModifiedJulianDate(Scale::UTC), previousIndex, bracketRatio))
     {
         auto interpolate = [](const Real& aPreviousValue, const Real& aNextValue, const Real& aRatio) -> Real
         {
@@ -229,12 +326,10 @@ Finals2000A::Data Finals2000A::getDataAt(const Instant& anInstant) const
             return Real::Undefined();
         };
 
-        const Finals2000A::Data& previousData = *(dataRange.first);
-        const Finals2000A::Data& nextData = *(dataRange.second);
+        const Finals2000A::Data& previousData = data_[previousIndex];
+        const Finals2000A::Data& nextData = data_[previousIndex + 1];
 
-        const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
-
-        const Real ratio = (instantMjd_UTC - previousData.mjd) / (nextData.mjd - previousData.mjd);
+        const Real ratio = bracketRatio;
 
         const Integer year = previousData.year;
         const Integer month = previousData.month;
@@ -315,6 +410,7 @@ Finals2000A Finals2000A::Load(const filesystem::File& aFile)
     using ostk::core::container::Array;
     using ostk::core::type::Index;
     using ostk::core::type::Real;
+    using ostk::core::type::Size;
     using ostk::core::type::String;
     using ostk::core::type::Uint16;
     using ostk::core::type::Uint8;
@@ -337,66 +433,95 @@ Finals2000A Finals2000A::Load(const filesystem::File& aFile)
 
     finals2000a.lastModifiedTimestamp_ = getFileModifiedInstant(aFile);
 
-    std::ifstream fileStream(aFile.getPath().toString());
+    const MappedFile mappedFile = {aFile};
+
+    LineReader lineReader = {mappedFile.accessContent()};
 
-    Index lineIndex = 0;
-    String line;
+    std::string_view line;
 
-    auto parseReal = [](const String& aLine, const Index& aStartColumnNumber, const Index& anEndColumnNumber) -> Real
+    // Fixed-width columns, 1-based and inclusive
+
+    const auto parseReal = [&line](const Index& aStartColumnNumber, const Index& anEndColumnNumber) -> Real
     {
-        String string = aLine.getSubstring(aStartColumnNumber - 1, anEndColumnNumber - aStartColumnNumber + 1).trim();
+        const std::string_view field = parser::fixedColumn(line, aStartColumnNumber, anEndColumnNumber);
 
-        if (string.isEmpty())
+        if (field.empty())
         {
             return Real::Undefined();
         }
 
-        if ((string.getLength() > 2) && (string.getHead(1) == "."))
+        double value = 0.0;
+
+        if (!parser::parseReal(field, value))
+        {
+            throw ostk::core::error::RuntimeError("Cannot parse real [{}].", std::string(field));
+        }
+
+        return value;
+    };
+
+    const auto parseInteger = [&line](const Index& aStartColumnNumber, const Index& anEndColumnNumber) -> Integer
+    {
+        const std::string_view field = parser::fixedColumn(line, aStartColumnNumber, anEndColumnNumber);
+
+        int value = 0;
+
+        if (!parser::parseInteger(field, value))
         {
-            string = "0." + string.getTail(string.getLength() - 1);
+            throw ostk::core::error::RuntimeError("Cannot parse integer [{}].", std::string(field));
         }
 
-        if ((string.getLength() > 2) && (string.getHead(2) == "-."))
+        return value;
+    };
+
+    const auto parseFlag = [&line](const Index& aColumnNumber) -> char
+    {
+        if (aColumnNumber > line.size())
         {
-            string = "-0." + string.getTail(string.getLength() - 2);
+            throw ostk::core::error::RuntimeError("Cannot parse flag at column [{}].", aColumnNumber);
         }
 
-        return Real::Parse(string);
+        return line[aColumnNumber - 1];
     };
 
-    while (std::getline(fileStream, line))
+    while (lineReader.readLine(line))
     {
-        const Integer year = Integer::Parse(line.getSubstring(0, 2).trim());
-        const Integer month = Integer::Parse(line.getSubstring(2, 2).trim());
-        const Integer day = Integer::Parse(line.getSubstring(4, 2).trim());
+        if (parser::trim(line).empty())
+        {
+            continue;
+        }
 
-        const Real mjd = parseReal(line, 8, 15);
+        const Integer year = parseInteger(1, 2);
+        const Integer month = parseInteger(3, 4);
+        const Integer day = parseInteger(5, 6);
 
-        const char polarMotionflag = line.at(16);
+        const Real mjd = parseReal(8, 15);
 
-        const Real x_A = parseReal(line, 19, 27);
-        const Real xError_A = parseReal(line, 28, 36);
-        const Real y_A = parseReal(line, 38, 46);
-        const Real yError_A = parseReal(line, 47, 55);
+        const char polarMotionflag = parseFlag(17);
 
-        const char ut1MinusUtcFlag = line.at(57);
+        const Real x_A = parseReal(19, 27);
+        const Real xError_A = parseReal(28, 36);
+        const Real y_A = parseReal(38, 46);
+        const Real yError_A = parseReal(47, 55);
 
-        const Real ut1MinusUtc_A = parseReal(line, 59, 68);
-        const Real ut1MinusUtcError_A = parseReal(line, 69, 78);
-        const Real lod_A = parseReal(line, 80, 86);
-        const Real lodError_A = parseReal(line, 87, 93);
+        const char ut1MinusUtcFlag = parseFlag(58);
 
-        const char nutationFlag = line.at(95);
+        const Real ut1MinusUtc_A = parseReal(59, 68);
+        const Real ut1MinusUtcError_A = parseReal(69, 78);
+        const Real lod_A = parseReal(80, 86);
+        const Real lodError_A = parseReal(87, 93);
 
-        const Real dx_A = parseReal(line, 98, 106);
-        const Real dxError_A = parseReal(line, 107, 115);
-        const Real dy_A = parseReal(line, 117, 125);
-        const Real dyError_A = parseReal(line, 126, 134);
-        const Real x_B = parseReal(line, 135, 144);
-        const Real y_B = parseReal(line, 145, 154);
-        const Real ut1MinusUtc_B = parseReal(line, 155, 165);
-        const Real dx_B = parseReal(line, 166, 175);
-        const Real dy_B = parseReal(line, 176, 185);
+        const char nutationFlag = parseFlag(96);
+
+        const Real dx_A = parseReal(98, 106);
+        const Real dxError_A = parseReal(107, 115);
+        const Real dy_A = parseReal(117, 125);
+        const Real dyError_A = parseReal(126, 134);
+        const Real x_B = parseReal(135, 144);
+        const Real y_B = parseReal(145, 154);
+        const Real ut1MinusUtc_B = parseReal(155, 165);
+        const Real dx_B = parseReal(166, 175);
+        const Real dy_B = parseReal(176, 185);
 
         const Finals2000A::Data data = {
             year,
@@ -425,15 +550,155 @@ Finals2000A Finals2000A::Load(const filesystem::File& aFile)
             dy_B
         };
 
-        finals2000a.data_.insert({mjd, data});
+        finals2000a.data_.add(data);
+    }
+
+    // Sort rows by MJD, keeping the first of duplicate rows
+
+    std::stable_sort(
+        finals2000a.data_.begin(),
+        finals2000a.data_.end(),
+        [](const Finals2000A::Data& aFirstData, const Finals2000A::Data& aSecondData) -> bool
+        {
+            return aFirstData.mjd < aSecondData.mjd;
+        }
+    );
+
+    finals2000a.data_.erase(
+        std::unique(
+            finals2000a.data_.begin(),
+            finals2000a.data_.end(),
+            [](const Finals2000A::Data& aFirstData, const Finals2000A::Data& aSecondData) -> bool
+            {
+                return aFirstData.mjd == aSecondData.mjd;
+            }
+        ),
+        finals2000a.data_.end()
+    );
+
+    // Columns
+
+    const Size rowCount = finals2000a.data_.getSize();
+
+    finals2000a.mjd_.reserve(rowCount);
+    finals2000a.x_.reserve(rowCount);
+    finals2000a.y_.reserve(rowCount);
+    finals2000a.ut1MinusUtc_.reserve(rowCount);
+    finals2000a.lod_.reserve(rowCount);
+    finals2000a.dx_.reserve(rowCount);
+    finals2000a.dy_.reserve(rowCount);
+
+    for (const auto& data : finals2000a.data_)
+    {
+        finals2000a.mjd_.push_back(toColumnValue(data.mjd));
+        finals2000a.x_.push_back(toColumnValue(data.x_A));
+        finals2000a.y_.push_back(toColumnValue(data.y_A));
+        finals2000a.ut1MinusUtc_.push_back(toColumnValue(data.ut1MinusUtc_A));
+        finals2000a.lod_.push_back(toColumnValue(data.lod_A));
+        finals2000a.dx_.push_back(toColumnValue(data.dx_A));
+        finals2000a.dy_.push_back(toColumnValue(data.dy_A));
+    }
+
+    finals2000a.isDaily_ = true;
+
+    for (Index rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+    {
+        if (finals2000a.mjd_[rowIndex] != (finals2000a.mjd_.front() + static_cast<double>(rowIndex)))
+        {
+            finals2000a.isDaily_ = false;
+
+            break;
+        }
+    }
+
+    if (!finals2000a.data_.empty())
+    {
+        const Instant startInstant = Instant::ModifiedJulianDate(finals2000a.data_.accessFirst().mjd, Scale::UTC);
+        const Instant endInstant = Instant::ModifiedJulianDate(finals2000a.data_.accessLast().mjd, Scale::UTC);
+
+        finals2000a.span_ = Interval::Closed(startInstant, endInstant);
+    }
+
+    return finals2000a;
+}
+
+Finals2000A Finals2000A::LoadCached(const filesystem::File& aFile)
+{
+    using ostk::physics::time::Scale;
+
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    Finals2000A finals2000a;
+
+    const bool isCacheLoaded = cache::Load(
+        aFile,
+        "Finals2000A",
+        cacheContentVersion,
+        [&finals2000a](cache::Reader& aReader) -> void
+        {
+            const Size rowCount = aReader.readSize();
+
+            finals2000a.data_.reserve(rowCount);
+
+            for (Index rowIndex = 0; rowIndex < rowCount; ++rowIndex)
+            {
+                finals2000a.data_.add(readData(aReader));
+            }
+
+            finals2000a.isDaily_ = (aReader.readCharacter() != 0);
+
+            aReader.readColumn(finals2000a.mjd_);
+            aReader.readColumn(finals2000a.x_);
+            aReader.readColumn(finals2000a.y_);
+            aReader.readColumn(finals2000a.ut1MinusUtc_);
+            aReader.readColumn(finals2000a.lod_);
+            aReader.readColumn(finals2000a.dx_);
+            aReader.readColumn(finals2000a.dy_);
+        }
+    );
+
+    if (!isCacheLoaded)
+    {
+        finals2000a = Finals2000A::Load(aFile);
+
+        cache::Writer writer;
+
+        writer.writeSize(finals2000a.data_.getSize());
+
+        for (const auto& data : finals2000a.data_)
+        {
+            writeData(writer, data);
+        }
+
+        writer.writeCharacter(finals2000a.isDaily_ ? 1 : 0);
+
+        writer.writeColumn(finals2000a.mjd_);
+        writer.writeColumn(finals2000a.x_);
+        writer.writeColumn(finals2000a.y_);
+        writer.writeColumn(finals2000a.ut1MinusUtc_);
+        writer.writeColumn(finals2000a.lod_);
+        writer.writeColumn(finals2000a.dx_);
+        writer.writeColumn(finals2000a.dy_);
+
+        cache::Save(aFile, "Finals2000A", cacheContentVersion, writer);
 
-        lineIndex++;
+        return finals2000a;
     }
 
+    finals2000a.lastModifiedTimestamp_ = getFileModifiedInstant(aFile);
+
     if (!finals2000a.data_.empty())
     {
-        const Instant startInstant = Instant::ModifiedJulianDate(finals2000a.data_.begin()->first, Scale::UTC);
-        const Instant endInstant = Instant::ModifiedJulianDate(finals2000a.data_.rbegin()->first, Scale::UTC);
+        const Instant startInstant = Instant::ModifiedJulianDate(finals2000a.data_.accessFirst().mjd, Scale::UTC);
+        const Instant endInstant = Instant::ModifiedJulianDate(finals2000a.data_.accessLast().mjd, Scale::UTC);
 
         finals2000a.span_ = Interval::Closed(startInstant, endInstant);
     }
@@ -444,34 +709,54 @@ Finals2000A Finals2000A::Load(const filesystem::File& aFile)
 Finals2000A::Finals2000A()
     : lastModifiedTimestamp_(Instant::Undefined()),
       span_(Interval::Undefined()),
-      data_(Map<Real, Finals2000A::Data>())
+      data_(Array<Finals2000A::Data>::Empty()),
+      isDaily_(false),
+      mjd_(),
+      x_(),
+      y_(),
+      ut1MinusUtc_(),
+      lod_(),
+      dx_(),
+      dy_()
 {
 }
 
-Pair<const Finals2000A::Data*, const Finals2000A::Data*> Finals2000A::accessDataRange(const Instant& anInstant) const
+Index Finals2000A::lowerBoundIndexOf(const double aModifiedJulianDate) const
 {
-    using ostk::physics::time::Scale;
+    // Daily rows: the first row whose MJD is not lower than the query is found directly
+
+    if (isDaily_)
+    {
+        const double offset = aModifiedJulianDate - mjd_.front();
 
-    const Real instantMjd_UTC = anInstant.getModifiedJulianDate(Scale::UTC);
+        if (!(offset > 0.0))
+        {
+            return 0;
+        }
 
-    const auto nextDataIt = data_.lower_bound(instantMjd_UTC);
+        const double index = std::ceil(offset);
 
-    if (nextDataIt == data_.end())
-    {
-        return {&(data_.rbegin()->second), nullptr};
+        return (index < static_cast<double>(mjd_.size())) ? static_cast<Index>(index) : mjd_.size();
     }
-    else if (nextDataIt == data_.begin())
+
+    return static_cast<Index>(
+        std::distance(mjd_.begin(), std::lower_bound(mjd_.begin(), mjd_.end(), aModifiedJulianDate))
+    );
+}
+
+bool Finals2000A::accessBracket(const double aModifiedJulianDate, Index& aPreviousIndex, double& aRatio) const
+{
+    const Index nextIndex = this->lowerBoundIndexOf(aModifiedJulianDate);
+
+    if ((nextIndex == 0) || (nextIndex >= mjd_.size()))
     {
-        return {nullptr, &(nextDataIt->second)};
+        return false;
     }
-    else
-    {
-        const auto previousDataIt = std::prev(nextDataIt);
 
-        return {&(previousDataIt->second), &(nextDataIt->second)};
-    }
+    aPreviousIndex = nextIndex - 1;
+    aRatio = (aModifiedJulianDate - mjd_[aPreviousIndex]) / (mjd_[nextIndex] - mjd_[aPreviousIndex]);
 
-    return {nullptr, nullptr};
+    return true;
 }
 
 }  // namespace iers
@@ -1,5 +1,6 @@
 /// Apache License 2.0
 
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
 #include <fstream>
@@ -15,9 +16,11 @@
 
 #include <OpenSpaceToolkit/IO/IP/TCP/HTTP/Client.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Data/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Data/Manifest.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Utility.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Date.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
@@ -43,6 +46,9 @@ using ostk::core::type::String;
 using ostk::io::ip::tcp::http::Client;
 using ostk::io::URL;
 
+using ostk::physics::data::utilities::getFileModifiedInstant;
+
+using FrameManager = ostk::physics::coordinate::frame::Manager;
 using ManifestManager = ostk::physics::data::Manager;
 
 const String bulletinAFileName = "ser7.dat";
@@ -53,6 +59,11 @@ const String finals2000AManifestName = "finals-2000A";
 
 const String temporaryDirectoryName = "tmp";
 
+Manager::~Manager()
+{
+    this->stopBackgroundRefresh();
+}
+
 Directory Manager::getBulletinADirectory() const
 {
     return Directory::Path(localRepository_.getPath() + Path::Parse("bulletin-A"));
@@ -67,11 +78,11 @@ BulletinA Manager::getBulletinA() const
 {
     std::lock_guard<std::mutex> lock {mutex_};
 
-    const BulletinA* bulletinAPtr = accessBulletinA_();
+    const Shared<const BulletinA> bulletinASPtr = accessBulletinA_();
 
-    if (bulletinAPtr != nullptr)
+    if (bulletinASPtr != nullptr)
     {
-        return *bulletinAPtr;
+        return *bulletinASPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot obtain Bulletin A.");
@@ -81,113 +92,56 @@ Finals2000A Manager::getFinals2000A() const
 {
     std::lock_guard<std::mutex> lock {mutex_};
 
-    const Finals2000A* finals2000aPtr = accessFinals2000A_();
+    const Shared<const Finals2000A> finals2000ASPtr = accessFinals2000A_();
 
-    if (finals2000aPtr != nullptr)
+    if (finals2000ASPtr != nullptr)
     {
-        return *finals2000aPtr;
+        return *finals2000ASPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot obtain Finals 2000A.");
 }
 
-Vector2d Manager::getPolarMotionAt(const Instant& anInstant) const
+Shared<const Snapshot> Manager::getSnapshot() const
 {
-    if (!anInstant.isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Instant");
-    }
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
 
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    // Try data in this order:
-    // 1. Bulletin A rapid service observations (released daily)
-    // 2. Bulletin A predictions (released daily)
-    // 3. Finals 2000A observations (released weekly)
-    //
-    // https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
-
-    const BulletinA* bulletinAPtr = this->accessBulletinA_();
+    // Bulletins are loaded at most once: a snapshot missing one of them still skips the manager mutex, provided
+    // loading it was attempted
 
-    if (bulletinAPtr != nullptr)
+    if (snapshotSPtr->isBulletinAResolved() && snapshotSPtr->isFinals2000AResolved())
     {
-        if (bulletinAPtr->accessObservationInterval().contains(anInstant))
-        {
-            const BulletinA::Observation observation = bulletinAPtr->getObservationAt(anInstant);
-
-            return {observation.x, observation.y};
-        }
-        else if (bulletinAPtr->accessPredictionInterval().contains(anInstant))
-        {
-            const BulletinA::Prediction prediction = bulletinAPtr->getPredictionAt(anInstant);
-
-            return {prediction.x, prediction.y};
-        }
+        return snapshotSPtr;
     }
 
-    const Finals2000A* finals2000aPtr = this->accessFinals2000A_();
+    // Load missing bulletins, which publishes a new snapshot
 
-    if (finals2000aPtr != nullptr)
-    {
-        const Vector2d polarMotion = finals2000aPtr->getPolarMotionAt(anInstant);
-        if (!polarMotion.isDefined())
-        {
-            throw ostk::core::error::RuntimeError(
-                "Cannot obtain polar motion from Finals2000a at [{}].", anInstant.toString()
-            );
-        }
-        return polarMotion;
-    }
+    std::lock_guard<std::mutex> lock {mutex_};
 
-    throw ostk::core::error::RuntimeError("Cannot obtain polar motion at [{}].", anInstant.toString());
+    this->resolveBulletinA_();
+    this->resolveFinals2000A_();
 
-    return Vector2d::Undefined();
+    return snapshot_.load();
 }
 
-Real Manager::getUt1MinusUtcAt(const Instant& anInstant) const
+Vector2d Manager::getPolarMotionAt(const Instant& anInstant) const
 {
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    // Try data in this order:
-    // 1. Bulletin A rapid service observations (released daily)
-    // 2. Bulletin A predictions (released daily)
-    // 3. Finals 2000A observations (released weekly)
-    //
-    // https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
-
-    const BulletinA* bulletinAPtr = this->accessBulletinA_();
-
-    if (bulletinAPtr != nullptr)
-    {
-        if (bulletinAPtr->accessObservationInterval().contains(anInstant))
-        {
-            const BulletinA::Observation observation = bulletinAPtr->getObservationAt(anInstant);
-
-            return observation.ut1MinusUtc;
-        }
-        else if (bulletinAPtr->accessPredictionInterval().contains(anInstant))
-        {
-            const BulletinA::Prediction prediction = bulletinAPtr->getPredictionAt(anInstant);
-
-            return prediction.ut1MinusUtc;
-        }
-    }
-
-    const Finals2000A* finals2000aPtr = this->accessFinals2000A_();
+    return this->getSnapshotAt_(anInstant)->getPolarMotionAt(anInstant);
+}
 
-    if (finals2000aPtr != nullptr)
+Real Manager::getUt1MinusUtcAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
     {
-        return finals2000aPtr->getUt1MinusUtcAt(anInstant);
+        throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    throw ostk::core::error::RuntimeError("Cannot obtain UT1 - UTC at [{}].", anInstant.toString());
-
-    return Real::Undefined();
+    return this->getSnapshotAt_(anInstant)->getUt1MinusUtcAt(anInstant);
 }
 
 Real Manager::getLodAt(const Instant& anInstant) const
@@ -197,18 +151,22 @@ Real Manager::getLodAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    const Finals2000A* finals2000aPtr = this->accessFinals2000A_();
+    return this->getSnapshot()->getLodAt(anInstant);
+}
 
-    if (finals2000aPtr != nullptr)
+EarthOrientationParameters Manager::getEopAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
     {
-        return finals2000aPtr->getLodAt(anInstant);
+        throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    throw ostk::core::error::RuntimeError("Cannot obtain LOD at [{}].", anInstant.toString());
+    return this->getSnapshot()->getEopAt(anInstant);
+}
 
-    return Real::Undefined();
+Array<EarthOrientationParameters> Manager::getEopAt(const Array<Instant>& anInstantArray) const
+{
+    return this->getSnapshot()->getEopAt(anInstantArray);
 }
 
 void Manager::loadBulletinA(const BulletinA& aBulletinA)
@@ -253,8 +211,13 @@ void Manager::reset()
 {
     BaseManager::reset();
 
-    bulletinA_ = BulletinA::Undefined();
-    finals2000A_ = Finals2000A::Undefined();
+    {
+        std::lock_guard<std::mutex> lock {mutex_};
+
+        snapshot_.store(std::make_shared<const Snapshot>(Snapshot::Undefined()));
+    }
+
+    FrameManager::Get().clearCachedTransforms();
 }
 
 void Manager::clearLocalRepository()
@@ -279,8 +242,7 @@ Manager::Manager()
           Path::Parse("coordinate/frame/provider/iers"),
           "OSTK_PHYSICS_COORDINATE_FRAME_PROVIDER_IERS_MANAGER_LOCAL_REPOSITORY_LOCK_TIMEOUT"
       ),
-      bulletinA_(BulletinA::Undefined()),
-      finals2000A_(Finals2000A::Undefined())
+      snapshot_(std::make_shared<const Snapshot>(Snapshot::Undefined()))
 {
     this->setup_();
 }
@@ -300,22 +262,188 @@ void Manager::setup_()
     }
 }
 
+void Manager::refresh_()
+{
+    if (this->getMode() != Manager::Mode::Automatic)
+    {
+        return;
+    }
+
+    ManifestManager& manifestManager = ManifestManager::Get();
+
+    // A bulletin is refreshed if it is not loaded yet or older than its remote. The local file is used if it is up to
+    // date, otherwise the latest file is fetched. Fetching and loading happen without the manager mutex held: queries
+    // keep using the current snapshot until the refreshed bulletin is published.
+
+    const auto isOutdated = [](const Instant& aLocalUpdateTimestamp, const Instant& aRemoteUpdateTimestamp) -> bool
+    {
+        return (!aLocalUpdateTimestamp.isDefined()) || (aRemoteUpdateTimestamp > aLocalUpdateTimestamp);
+    };
+
+    {
+        const Instant bulletinARemoteUpdateTimestamp = manifestManager.getLastUpdateTimestampFor(bulletinAManifestName);
+
+        const Shared<const BulletinA> bulletinASPtr = snapshot_.load()->accessBulletinA();
+
+        if ((bulletinASPtr == nullptr) ||
+            isOutdated(bulletinASPtr->accessLastModifiedTimestamp(), bulletinARemoteUpdateTimestamp))
+        {
+            const File localBulletinAFile =
+                File::Path(this->getBulletinADirectory().getPath() + Path::Parse(bulletinAFileName));
+
+            const File bulletinAFile =
+                (localBulletinAFile.exists() &&
+                 (!isOutdated(getFileModifiedInstant(localBulletinAFile), bulletinARemoteUpdateTimestamp)))
+                    ? localBulletinAFile
+                    : this->fetchLatestBulletinA_();
+
+            const BulletinA bulletinA = BulletinA::LoadCached(bulletinAFile);
+
+            std::lock_guard<std::mutex> lock {mutex_};
+
+            this->loadBulletinA_(bulletinA);
+        }
+    }
+
+    {
+        const Instant finals2000ARemoteUpdateTimestamp =
+            manifestManager.getLastUpdateTimestampFor(finals2000AManifestName);
+
+        const Shared<const Finals2000A> finals2000ASPtr = snapshot_.load()->accessFinals2000A();
+
+        if ((finals2000ASPtr == nullptr) ||
+            isOutdated(finals2000ASPtr->accessLastModifiedTimestamp(), finals2000ARemoteUpdateTimestamp))
+        {
+            const File localFinals2000AFile =
+                File::Path(this->getFinals2000ADirectory().getPath() + Path::Parse(finals2000AFileName));
+
+            const File finals2000AFile =
+                (localFinals2000AFile.exists() &&
+                 (!isOutdated(getFileModifiedInstant(localFinals2000AFile), finals2000ARemoteUpdateTimestamp)))
+                    ? localFinals2000AFile
+                    : this->fetchLatestFinals2000A_();
+
+            const Finals2000A finals2000A = Finals2000A::LoadCached(finals2000AFile);
+
+            std::lock_guard<std::mutex> lock {mutex_};
+
+            this->loadFinals2000A_(finals2000A);
+        }
+    }
+}
+
+Shared<const Snapshot> Manager::getSnapshotAt_(const Instant& anInstant) const
+{
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
+
+    // Polar motion and UT1 - UTC only need Finals 2000A where Bulletin A does not cover the query
+
+    if (snapshotSPtr->isBulletinAResolved() &&
+        (snapshotSPtr->isFinals2000AResolved() || snapshotSPtr->isCoveredByBulletinA(anInstant)))
+    {
+        return snapshotSPtr;
+    }
+
+    std::lock_guard<std::mutex> lock {mutex_};
+
+    this->resolveBulletinA_();
+
+    if (!snapshot_.load()->isCoveredByBulletinA(anInstant))
+    {
+        this->resolveFinals2000A_();
+    }
+
+    return snapshot_.load();
+}
+
+void Manager::resolveBulletinA_() const
+{
+    if (snapshot_.load()->isBulletinAResolved())
+    {
+        return;
+    }
+
+    this->accessBulletinA_();
+
+    // Record the attempt if no Bulletin A could be loaded, so that later queries do not search for it again
+
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
+
+    if (!snapshotSPtr->isBulletinAResolved())
+    {
+        snapshot_.store(std::make_shared<const Snapshot>(
+            snapshotSPtr->accessBulletinA(),
+            snapshotSPtr->accessFinals2000A(),
+            true,
+            snapshotSPtr->isFinals2000AResolved()
+        ));
+    }
+}
+
+void Manager::resolveFinals2000A_() const
+{
+    if (snapshot_.load()->isFinals2000AResolved())
+    {
+        return;
+    }
+
+    this->accessFinals2000A_();
+
+    // Record the attempt if no Finals 2000A could be loaded, so that later queries do not search for it again
+
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
+
+    if (!snapshotSPtr->isFinals2000AResolved())
+    {
+        snapshot_.store(std::make_shared<const Snapshot>(
+            snapshotSPtr->accessBulletinA(),
+            snapshotSPtr->accessFinals2000A(),
+            snapshotSPtr->isBulletinAResolved(),
+            true
+        ));
+    }
+}
+
 void Manager::loadBulletinA_(const BulletinA& aBulletinA) const
 {
-    bulletinA_ = aBulletinA;
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
+
+    snapshot_.store(std::make_shared<const Snapshot>(
+        std::make_shared<const BulletinA>(aBulletinA),
+        snapshotSPtr->accessFinals2000A(),
+        true,
+        snapshotSPtr->isFinals2000AResolved()
+    ));
+
+    // Transforms computed with previous Earth orientation parameters are now stale
+
+    FrameManager::Get().clearCachedTransforms();
 }
 
 void Manager::loadFinals2000A_(const Finals2000A& aFinals2000A) const
 {
-    finals2000A_ = aFinals2000A;
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
+
+    snapshot_.store(std::make_shared<const Snapshot>(
+        snapshotSPtr->accessBulletinA(),
+        std::make_shared<const Finals2000A>(aFinals2000A),
+        snapshotSPtr->isBulletinAResolved(),
+        true
+    ));
+
+    // Transforms computed with previous Earth orientation parameters are now stale
+
+    FrameManager::Get().clearCachedTransforms();
 }
 
-const BulletinA* Manager::accessBulletinA_() const
+Shared<const BulletinA> Manager::accessBulletinA_() const
 {
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
+
     // If we've loaded a file, simply return it
-    if (bulletinA_.isDefined())
+    if (snapshotSPtr->hasBulletinA())
     {
-        return &bulletinA_;
+        return snapshotSPtr->accessBulletinA();
     }
 
     // If set to automatic, try to load or fetch the latest file
@@ -332,7 +460,7 @@ const BulletinA* Manager::accessBulletinA_() const
                     File::Path(this->getBulletinADirectory().getPath() + Path::Parse(bulletinAFileName));
 
                 // if the file exists locally, load and check timestamp against remote
-                const BulletinA bulletinA = BulletinA::Load(localBulletinAFile);
+                const BulletinA bulletinA = BulletinA::LoadCached(localBulletinAFile);
 
                 ManifestManager& manifestManager = ManifestManager::Get();
 
@@ -355,9 +483,9 @@ const BulletinA* Manager::accessBulletinA_() const
                 localBulletinAFile = this->fetchLatestBulletinA_();
             }
 
-            this->loadBulletinA_(BulletinA::Load(localBulletinAFile));
+            this->loadBulletinA_(BulletinA::LoadCached(localBulletinAFile));
 
-            return &bulletinA_;
+            return snapshot_.load()->accessBulletinA();
         }
 
         case Manager::Mode::Manual:
@@ -370,9 +498,9 @@ const BulletinA* Manager::accessBulletinA_() const
             const File localBulletinAFile =
                 File::Path(this->getBulletinADirectory().getPath() + Path::Parse(bulletinAFileName));
 
-            this->loadBulletinA_(BulletinA::Load(localBulletinAFile));
+            this->loadBulletinA_(BulletinA::LoadCached(localBulletinAFile));
 
-            return &bulletinA_;
+            return snapshot_.load()->accessBulletinA();
         }
 
         default:
@@ -383,12 +511,14 @@ const BulletinA* Manager::accessBulletinA_() const
     return nullptr;
 }
 
-const Finals2000A* Manager::accessFinals2000A_() const
+Shared<const Finals2000A> Manager::accessFinals2000A_() const
 {
+    const Shared<const Snapshot> snapshotSPtr = snapshot_.load();
+
     // If we've loaded a file, simply return it
-    if (finals2000A_.isDefined())
+    if (snapshotSPtr->hasFinals2000A())
     {
-        return &finals2000A_;
+        return snapshotSPtr->accessFinals2000A();
     }
 
     // If set to automatic, try to load or fetch the latest file
@@ -405,7 +535,7 @@ const Finals2000A* Manager::accessFinals2000A_() const
                     File::Path(this->getFinals2000ADirectory().getPath() + Path::Parse(finals2000AFileName));
 
                 // if the file exists locally, load and check timestamp against remote
-                const Finals2000A finals2000A = Finals2000A::Load(localFinals2000AFile);
+                const Finals2000A finals2000A = Finals2000A::LoadCached(localFinals2000AFile);
 
                 ManifestManager& manifestManager = ManifestManager::Get();
 
@@ -428,9 +558,9 @@ const Finals2000A* Manager::accessFinals2000A_() const
                 localFinals2000AFile = this->fetchLatestFinals2000A_();
             }
 
-            this->loadFinals2000A_(Finals2000A::Load(localFinals2000AFile));
+            this->loadFinals2000A_(Finals2000A::LoadCached(localFinals2000AFile));
 
-            return &finals2000A_;
+            return snapshot_.load()->accessFinals2000A();
         }
         case Manager::Mode::Manual:
         {
@@ -442,11 +572,11 @@ const Finals2000A* Manager::accessFinals2000A_() const
             const File localFinals2000AFile =
                 File::Path(this->getFinals2000ADirectory().getPath() + Path::Parse(finals2000AFileName));
 
-            const Finals2000A finals2000A = Finals2000A::Load(localFinals2000AFile);
+            const Finals2000A finals2000A = Finals2000A::LoadCached(localFinals2000AFile);
 
             this->loadFinals2000A_(finals2000A);
 
-            return &finals2000A_;
+            return snapshot_.load()->accessFinals2000A();
         }
         default:
             return nullptr;
@@ -0,0 +1,273 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Snapshot.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+namespace iers
+{
+
+Snapshot::Snapshot(const Shared<const BulletinA>& aBulletinASPtr, const Shared<const Finals2000A>& aFinals2000ASPtr)
+    : Snapshot(aBulletinASPtr, aFinals2000ASPtr, aBulletinASPtr != nullptr, aFinals2000ASPtr != nullptr)
+{
+}
+
+Snapshot::Snapshot(
+    const Shared<const BulletinA>& aBulletinASPtr,
+    const Shared<const Finals2000A>& aFinals2000ASPtr,
+    const bool isBulletinAResolved,
+    const bool isFinals2000AResolved
+)
+    : bulletinASPtr_(aBulletinASPtr),
+      finals2000ASPtr_(aFinals2000ASPtr),
+      isBulletinAResolved_(isBulletinAResolved || (aBulletinASPtr != nullptr)),
+      isFinals2000AResolved_(isFinals2000AResolved || (aFinals2000ASPtr != nullptr))
+{
+}
+
+bool Snapshot::isDefined() const
+{
+    return this->hasBulletinA() || this->hasFinals2000A();
+}
+
+bool Snapshot::hasBulletinA() const
+{
+    return (bulletinASPtr_ != nullptr) && bulletinASPtr_->isDefined();
+}
+
+bool Snapshot::hasFinals2000A() const
+{
+    return (finals2000ASPtr_ != nullptr) && finals2000ASPtr_->isDefined();
+}
+
+bool Snapshot::isBulletinAResolved() const
+{
+    return isBulletinAResolved_;
+}
+
+bool Snapshot::isFinals2000AResolved() const
+{
+    return isFinals2000AResolved_;
+}
+
+bool Snapshot::isCoveredByBulletinA(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    return this->hasBulletinA() && (bulletinASPtr_->accessObservationInterval().contains(anInstant) ||
+                                    bulletinASPtr_->accessPredictionInterval().contains(anInstant));
+}
+
+const Shared<const BulletinA>& Snapshot::accessBulletinA() const
+{
+    return bulletinASPtr_;
+}
+
+const Shared<const Finals2000A>& Snapshot::accessFinals2000A() const
+{
+    return finals2000ASPtr_;
+}
+
+Vector2d Snapshot::getPolarMotionAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    // Try data in this order:
+    // 1. Bulletin A rapid service observations (released daily)
+    // 2. Bulletin A predictions (released daily)
+    // 3. Finals 2000A observations (released weekly)
+    //
+    // https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
+
+    if (this->hasBulletinA())
+    {
+        if (bulletinASPtr_->accessObservationInterval().contains(anInstant))
+        {
+            const BulletinA::Observation observation = bulletinASPtr_->getObservationAt(anInstant);
+
+            return {observation.x, observation.y};
+        }
+        else if (bulletinASPtr_->accessPredictionInterval().contains(anInstant))
+        {
+            const BulletinA::Prediction prediction = bulletinASPtr_->getPredictionAt(anInstant);
+
+            return {prediction.x, prediction.y};
+        }
+    }
+
+    if (this->hasFinals2000A())
+    {
+        const Vector2d polarMotion = finals2000ASPtr_->getPolarMotionAt(anInstant);
+        if (!polarMotion.isDefined())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Cannot obtain polar motion from Finals2000a at [{}].", anInstant.toString()
+            );
+        }
+        return polarMotion;
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot obtain polar motion at [{}].", anInstant.toString());
+
+    return Vector2d::Undefined();
+}
+
+Real Snapshot::getUt1MinusUtcAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    // Try data in this order:
+    // 1. Bulletin A rapid service observations (released daily)
+    // 2. Bulletin A predictions (released daily)
+    // 3. Finals 2000A observations (released weekly)
+    //
+    // https://hpiers.obspm.fr/eoppc/bul/bulb/explanatory.html
+
+    if (this->hasBulletinA())
+    {
+        if (bulletinASPtr_->accessObservationInterval().contains(anInstant))
+        {
+            const BulletinA::Observation observation = bulletinASPtr_->getObservationAt(anInstant);
+
+            return observation.ut1MinusUtc;
+        }
+        else if (bulletinASPtr_->accessPredictionInterval().contains(anInstant))
+        {
+            const BulletinA::Prediction prediction = bulletinASPtr_->getPredictionAt(anInstant);
+
+            return prediction.ut1MinusUtc;
+        }
+    }
+
+    if (this->hasFinals2000A())
+    {
+        return finals2000ASPtr_->getUt1MinusUtcAt(anInstant);
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot obtain UT1 - UTC at [{}].", anInstant.toString());
+
+    return Real::Undefined();
+}
+
+Real Snapshot::getLodAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (this->hasFinals2000A())
+    {
+        return finals2000ASPtr_->getLodAt(anInstant);
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot obtain LOD at [{}].", anInstant.toString());
+
+    return Real::Undefined();
+}
+
+EarthOrientationParameters Snapshot::getEopAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    // LOD and celestial pole offsets are only available in Finals 2000A
+
+    const EarthOrientationParameters finals2000AParameters =
+        this->hasFinals2000A() ? finals2000ASPtr_->getEopAt(anInstant) : EarthOrientationParameters::Undefined();
+
+    // Polar motion and UT1 - UTC, in the same order as getPolarMotionAt and getUt1MinusUtcAt
+
+    if (this->hasBulletinA())
+    {
+        if (bulletinASPtr_->accessObservationInterval().contains(anInstant))
+        {
+            const BulletinA::Observation observation = bulletinASPtr_->getObservationAt(anInstant);
+
+            return {
+                EarthOrientationParameters::Source::BulletinAObservation,
+                {observation.x, observation.y},
+                observation.ut1MinusUtc,
+                finals2000AParameters.lod,
+                finals2000AParameters.dx,
+                finals2000AParameters.dy
+            };
+        }
+        else if (bulletinASPtr_->accessPredictionInterval().contains(anInstant))
+        {
+            const BulletinA::Prediction prediction = bulletinASPtr_->getPredictionAt(anInstant);
+
+            return {
+                EarthOrientationParameters::Source::BulletinAPrediction,
+                {prediction.x, prediction.y},
+                prediction.ut1MinusUtc,
+                finals2000AParameters.lod,
+                finals2000AParameters.dx,
+                finals2000AParameters.dy
+            };
+        }
+    }
+
+    if (finals2000AParameters.source == EarthOrientationParameters::Source::Finals2000A)
+    {
+        if (!finals2000AParameters.polarMotion.isDefined())
+        {
+            throw ostk::core::error::RuntimeError(
+                "Cannot obtain polar motion from Finals2000a at [{}].", anInstant.toString()
+            );
+        }
+
+        return finals2000AParameters;
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot obtain Earth orientation parameters at [{}].", anInstant.toString());
+
+    return EarthOrientationParameters::Undefined();
+}
+
+Array<EarthOrientationParameters> Snapshot::getEopAt(const Array<Instant>& anInstantArray) const
+{
+    Array<EarthOrientationParameters> earthOrientationParameters = Array<EarthOrientationParameters>::Empty();
+    earthOrientationParameters.reserve(anInstantArray.getSize());
+
+    for (const auto& instant : anInstantArray)
+    {
+        earthOrientationParameters.add(this->getEopAt(instant));
+    }
+
+    return earthOrientationParameters;
+}
+
+Snapshot Snapshot::Undefined()
+{
+    return {nullptr, nullptr};
+}
+
+}  // namespace iers
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
@@ -19,6 +19,7 @@
 
 using IersManager = ostk::physics::coordinate::frame::provider::iers::Manager;
 using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
 
 namespace ostk
 {
@@ -31,42 +32,19 @@ namespace frame
 namespace provider
 {
 
-ITRF::ITRF() {}
-
-ITRF::~ITRF() {}
-
-ITRF* ITRF::clone() const
+namespace
 {
-    return new ITRF(*this);
-}
 
-bool ITRF::isDefined() const
-{
-    return true;
-}
+using ostk::mathematics::object::Vector2d;
 
-Transform ITRF::getTransformAt(const Instant& anInstant) const
+Transform computeTransform(const Instant& anInstant, const Real& aTtModifiedJulianDate, const Vector2d& aPolarMotion)
 {
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
-    using ostk::mathematics::object::Vector2d;
-
-    using ostk::physics::time::DateTime;
-    using ostk::physics::time::Scale;
-
-    if (!anInstant.isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Instant");
-    }
-
-    if (!this->isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("ITRF");
-    }
 
     // Time (TT)
 
     static const Real djmjd0 = 2400000.5;
-    const Real tt = anInstant.getModifiedJulianDate(Scale::TT);
+    const Real tt = aTtModifiedJulianDate;
 
     // The polar motion xp,yp can be obtained from IERS bulletins.  The
     // values are the coordinates (in radians) of the Celestial
@@ -77,7 +55,7 @@ Transform ITRF::getTransformAt(const Instant& anInstant) const
 
     // Polar motion
 
-    const Vector2d polarMotion = IersManager::Get().getPolarMotionAt(anInstant);  // [asec]
+    const Vector2d polarMotion = aPolarMotion;  // [asec]
 
     const Real xp = polarMotion.x() * DAS2R;  // [rad]
     const Real yp = polarMotion.y() * DAS2R;  // [rad]
@@ -116,6 +94,77 @@ Transform ITRF::getTransformAt(const Instant& anInstant) const
     return Transform::Passive(anInstant, x_ITRF_TIRF, v_ITRF_TIRF, q_ITRF_TIRF, w_ITRF_TIRF_in_ITRF);
 }
 
+}  // namespace
+
+ITRF::ITRF() {}
+
+ITRF::~ITRF() {}
+
+ITRF* ITRF::clone() const
+{
+    return new ITRF(*this);
+}
+
+bool ITRF::isDefined() const
+{
+    return true;
+}
+
+Transform ITRF::getTransformAt(const Instant& anInstant) const
+{
+    using ostk::physics::time::Scale;
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("ITRF");
+    }
+
+    return computeTransform(
+        anInstant, anInstant.getModifiedJulianDate(Scale::TT), IersManager::Get().getPolarMotionAt(anInstant)
+    );
+}
+
+Array<Transform> ITRF::getTransformsAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::core::type::Size;
+
+    using ostk::physics::time::Scale;
+
+    for (const auto& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("ITRF");
+    }
+
+    // All instants are resolved against the same IERS snapshot
+
+    const Array<EarthOrientationParameters> eops = IersManager::Get().getEopAt(anInstantArray);
+
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    for (Size index = 0; index < anInstantArray.getSize(); ++index)
+    {
+        const Instant& instant = anInstantArray[index];
+
+        transforms.add(computeTransform(instant, instant.getModifiedJulianDate(Scale::TT), eops[index].polarMotion));
+    }
+
+    return transforms;
+}
+
 }  // namespace provider
 }  // namespace frame
 }  // namespace coordinate
@@ -0,0 +1,420 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Interpolated.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+namespace frame
+{
+namespace provider
+{
+
+namespace
+{
+
+// Rotation angle between two unit quaternions, accurate down to very small angles
+
+double angleBetween(const Vector4d& aFirstQuaternion, const Vector4d& aSecondQuaternion)
+{
+    const Vector4d secondQuaternion =
+        (aFirstQuaternion.dot(aSecondQuaternion) < 0.0) ? Vector4d(-aSecondQuaternion) : aSecondQuaternion;
+
+    return 4.0 * std::atan2((aFirstQuaternion - secondQuaternion).norm(), (aFirstQuaternion + secondQuaternion).norm());
+}
+
+}  // namespace
+
+Interpolated::Interpolated(
+    const Shared<const Provider>& aProviderSPtr,
+    const Interval& anInterval,
+    const Angle& anAngularTolerance,
+    const Duration& aMaximumStep,
+    const Duration& aMinimumStep
+)
+    : providerSPtr_(aProviderSPtr),
+      interval_(anInterval),
+      angularTolerance_(anAngularTolerance),
+      maximumAngularError_(Angle::Undefined()),
+      nodes_()
+{
+    if ((providerSPtr_ == nullptr) || (!providerSPtr_->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Provider");
+    }
+
+    if (!interval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!interval_.getDuration().isStrictlyPositive())
+    {
+        throw ostk::core::error::RuntimeError("Interval [{}] must have a positive duration.", interval_.toString());
+    }
+
+    if (!angularTolerance_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Angular tolerance");
+    }
+
+    if (angularTolerance_.inRadians() <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Angular tolerance [{}] must be positive.", angularTolerance_.toString());
+    }
+
+    if ((!aMaximumStep.isDefined()) || (!aMinimumStep.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Step");
+    }
+
+    if ((!aMinimumStep.isStrictlyPositive()) || (aMinimumStep > aMaximumStep))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Minimum step [{}] must be positive and lower than maximum step [{}].",
+            aMinimumStep.toString(),
+            aMaximumStep.toString()
+        );
+    }
+
+    this->sample(aMaximumStep, aMinimumStep);
+}
+
+Interpolated::~Interpolated() {}
+
+Interpolated* Interpolated::clone() const
+{
+    return new Interpolated(*this);
+}
+
+bool Interpolated::isDefined() const
+{
+    return (providerSPtr_ != nullptr) && providerSPtr_->isDefined() && interval_.isDefined() &&
+           angularTolerance_.isDefined() && (!nodes_.empty());
+}
+
+const Shared<const Provider>& Interpolated::accessProvider() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interpolated");
+    }
+
+    return providerSPtr_;
+}
+
+Interval Interpolated::getInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interpolated");
+    }
+
+    return interval_;
+}
+
+Angle Interpolated::getAngularTolerance() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interpolated");
+    }
+
+    return angularTolerance_;
+}
+
+Angle Interpolated::getMaximumAngularError() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interpolated");
+    }
+
+    return maximumAngularError_;
+}
+
+Size Interpolated::getNodeCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interpolated");
+    }
+
+    return nodes_.size();
+}
+
+Transform Interpolated::getTransformAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interpolated");
+    }
+
+    if ((anInstant < interval_.accessStart()) || (anInstant > interval_.accessEnd()))
+    {
+        return providerSPtr_->getTransformAt(anInstant);
+    }
+
+    return this->interpolateAt(anInstant, (anInstant - interval_.accessStart()).inSeconds());
+}
+
+void Interpolated::sample(const Duration& aMaximumStep, const Duration& aMinimumStep)
+{
+    const double duration = interval_.getDuration().inSeconds();
+    const double minimumStep = aMinimumStep.inSeconds();
+
+    // Initial uniform grid
+
+    const Size segmentCount = std::max<Size>(1, static_cast<Size>(std::ceil(duration / aMaximumStep.inSeconds())));
+
+    nodes_.clear();
+    nodes_.reserve(segmentCount + 1);
+
+    for (Size index = 0; index <= segmentCount; ++index)
+    {
+        nodes_.push_back(this->nodeAt(duration * static_cast<double>(index) / static_cast<double>(segmentCount)));
+    }
+
+    // Bisect segments whose error, probed at interior points, exceeds the tolerance, until none does (or all reached
+    // the minimum step). The interpolation error of a segment does not necessarily peak at its midpoint, as node
+    // derivatives are estimated from neighbouring nodes: probing the quarter points as well bounds it more tightly.
+
+    static const std::array<double, 3> probeFractions = {0.25, 0.5, 0.75};
+
+    const double tolerance = angularTolerance_.inRadians();
+
+    double maximumError = 0.0;
+    bool isRefined = true;
+
+    while (isRefined)
+    {
+        Interpolated::ComputeOrientationDerivatives(nodes_);
+
+        std::vector<Node> nodes;
+        nodes.reserve(2 * nodes_.size());
+
+        maximumError = 0.0;
+        isRefined = false;
+
+        for (Size index = 0; index + 1 < nodes_.size(); ++index)
+        {
+            const Node& previousNode = nodes_[index];
+            const Node& nextNode = nodes_[index + 1];
+
+            nodes.push_back(previousNode);
+
+            const double step = nextNode.time - previousNode.time;
+            const double midpointTime = previousNode.time + 0.5 * step;
+
+            const Node midpointNode = this->nodeAt(midpointTime);
+
+            double error = 0.0;
+
+            for (const double probeFraction : probeFractions)
+            {
+                const double probeTime = previousNode.time + probeFraction * step;
+
+                const Vector4d probeOrientation =
+                    (probeFraction == 0.5) ? midpointNode.orientation : this->nodeAt(probeTime).orientation;
+
+                const Transform interpolatedTransform =
+                    this->interpolateAt(interval_.accessStart() + Duration::Seconds(probeTime), probeTime);
+                const Quaternion& interpolatedOrientation = interpolatedTransform.accessOrientation();
+
+                error = std::max(
+                    error,
+                    angleBetween(
+                        Vector4d(
+                            interpolatedOrientation.x(),
+                            interpolatedOrientation.y(),
+                            interpolatedOrientation.z(),
+                            interpolatedOrientation.s()
+                        ),
+                        probeOrientation
+                    )
+                );
+
+                if ((error > tolerance) && ((0.5 * step) >= minimumStep))
+                {
+                    break;
+                }
+            }
+
+            if ((error > tolerance) && ((0.5 * step) >= minimumStep))
+            {
+                nodes.push_back(midpointNode);
+                isRefined = true;
+            }
+            else
+            {
+                maximumError = std::max(maximumError, error);
+            }
+        }
+
+        nodes.push_back(nodes_.back());
+
+        nodes_ = std::move(nodes);
+    }
+
+    maximumAngularError_ = Angle::Radians(maximumError);
+}
+
+Interpolated::Node Interpolated::nodeAt(const double aTime) const
+{
+    const Transform transform = providerSPtr_->getTransformAt(interval_.accessStart() + Duration::Seconds(aTime));
+
+    const Quaternion& orientation = transform.accessOrientation();
+
+    return {
+        aTime,
+        Vector4d(orientation.x(), orientation.y(), orientation.z(), orientation.s()),
+        transform.accessTranslation(),
+        transform.accessVelocity(),
+        transform.accessAngularVelocity(),
+        Vector4d::Zero()
+    };
+}
+
+Transform Interpolated::interpolateAt(const Instant& anInstant, const double aTime) const
+{
+    // Locate segment
+
+    const auto nodeIt = std::upper_bound(
+        nodes_.begin(),
+        nodes_.end(),
+        aTime,
+        [](const double aValue, const Node& aNode) -> bool
+        {
+            return aValue < aNode.time;
+        }
+    );
+
+    const Size index = std::min<Size>(
+        static_cast<Size>(std::max<std::ptrdiff_t>(std::distance(nodes_.begin(), nodeIt) - 1, 0)), nodes_.size() - 2
+    );
+
+    const Node& previousNode = nodes_[index];
+    const Node& nextNode = nodes_[index + 1];
+
+    // Cubic Hermite basis
+
+    const double step = nextNode.time - previousNode.time;
+    const double u = (aTime - previousNode.time) / step;
+    const double u2 = u * u;
+    const double u3 = u2 * u;
+
+    const double h00 = 2.0 * u3 - 3.0 * u2 + 1.0;
+    const double h10 = u3 - 2.0 * u2 + u;
+    const double h01 = -2.0 * u3 + 3.0 * u2;
+    const double h11 = u3 - u2;
+
+    const double dh00 = (6.0 * u2 - 6.0 * u) / step;
+    const double dh10 = 3.0 * u2 - 4.0 * u + 1.0;
+    const double dh01 = (-6.0 * u2 + 6.0 * u) / step;
+    const double dh11 = 3.0 * u2 - 2.0 * u;
+
+    const Vector4d orientation = h00 * previousNode.orientation + h10 * step * previousNode.orientationDerivative +
+                                 h01 * nextNode.orientation + h11 * step * nextNode.orientationDerivative;
+
+    const Vector3d translation = h00 * previousNode.translation + h10 * step * previousNode.velocity +
+                                 h01 * nextNode.translation + h11 * step * nextNode.velocity;
+
+    const Vector3d velocity = dh00 * previousNode.translation + dh10 * previousNode.velocity +
+                              dh01 * nextNode.translation + dh11 * nextNode.velocity;
+
+    const Vector3d angularVelocity = (1.0 - u) * previousNode.angularVelocity + u * nextNode.angularVelocity;
+
+    return Transform::Passive(
+        anInstant,
+        translation,
+        velocity,
+        Quaternion::XYZS(orientation(0), orientation(1), orientation(2), orientation(3)).toNormalized(),
+        angularVelocity
+    );
+}
+
+void Interpolated::ComputeOrientationDerivatives(std::vector<Node>& aNodeArray)
+{
+    const Size nodeCount = aNodeArray.size();
+
+    // Align quaternion signs, so that consecutive nodes lie on the same hemisphere
+
+    for (Size index = 1; index < nodeCount; ++index)
+    {
+        if (aNodeArray[index].orientation.dot(aNodeArray[index - 1].orientation) < 0.0)
+        {
+            aNodeArray[index].orientation = -aNodeArray[index].orientation;
+        }
+    }
+
+    if (nodeCount < 2)
+    {
+        return;
+    }
+
+    if (nodeCount == 2)
+    {
+        const Vector4d derivative = (aNodeArray[1].orientation - aNodeArray[0].orientation) /
+                                    (aNodeArray[1].time - aNodeArray[0].time);
+
+        aNodeArray[0].orientationDerivative = derivative;
+        aNodeArray[1].orientationDerivative = derivative;
+
+        return;
+    }
+
+    // Second order finite differences, on a non-uniform grid
+
+    for (Size index = 1; index + 1 < nodeCount; ++index)
+    {
+        const double previousStep = aNodeArray[index].time - aNodeArray[index - 1].time;
+        const double nextStep = aNodeArray[index + 1].time - aNodeArray[index].time;
+
+        aNodeArray[index].orientationDerivative =
+            (previousStep * previousStep * (aNodeArray[index + 1].orientation - aNodeArray[index].orientation) +
+             nextStep * nextStep * (aNodeArray[index].orientation - aNodeArray[index - 1].orientation)) /
+            (previousStep * nextStep * (previousStep + nextStep));
+    }
+
+    {
+        const double firstStep = aNodeArray[1].time - aNodeArray[0].time;
+        const double secondStep = aNodeArray[2].time - aNodeArray[1].time;
+
+        aNodeArray[0].orientationDerivative =
+            -(2.0 * firstStep + secondStep) / (firstStep * (firstStep + secondStep)) * aNodeArray[0].orientation +
+            (firstStep + secondStep) / (firstStep * secondStep) * aNodeArray[1].orientation -
+            firstStep / (secondStep * (firstStep + secondStep)) * aNodeArray[2].orientation;
+    }
+
+    {
+        const double lastStep = aNodeArray[nodeCount - 1].time - aNodeArray[nodeCount - 2].time;
+        const double secondLastStep = aNodeArray[nodeCount - 2].time - aNodeArray[nodeCount - 3].time;
+
+        aNodeArray[nodeCount - 1].orientationDerivative =
+            (2.0 * lastStep + secondLastStep) / (lastStep * (lastStep + secondLastStep)) *
+                aNodeArray[nodeCount - 1].orientation -
+            (lastStep + secondLastStep) / (lastStep * secondLastStep) * aNodeArray[nodeCount - 2].orientation +
+            lastStep / (secondLastStep * (lastStep + secondLastStep)) * aNodeArray[nodeCount - 3].orientation;
+    }
+}
+
+}  // namespace provider
+}  // namespace frame
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
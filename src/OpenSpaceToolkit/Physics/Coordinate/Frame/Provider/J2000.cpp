@@ -27,45 +27,13 @@ namespace provider
 
 using ostk::physics::time::Scale;
 
-J2000::J2000(const iau::Theory& aTheory)
-    : theory_(aTheory)
-{
-}
-
-J2000::~J2000() {}
-
-J2000* J2000::clone() const
-{
-    return new J2000(*this);
-}
-
-bool J2000::isDefined() const
-{
-    return true;
-}
-
-iau::Theory J2000::getTheory() const
-{
-    return this->theory_;
-}
-
-Transform J2000::getTransformAt(const Instant& anInstant) const
+static Quaternion computeOrientation(const iau::Theory& aTheory)
 {
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 
-    if (!anInstant.isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Instant");
-    }
-
-    if (!this->isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("J2000");
-    }
-
     double rb[3][3];
 
-    switch (this->theory_)
+    switch (aTheory)
     {
         case iau::Theory::IAU_2000A:
         {
@@ -95,8 +63,7 @@ Transform J2000::getTransformAt(const Instant& anInstant) const
         }
 
         default:
-            throw ostk::core::error::runtime::Wrong("Theory");
-            break;
+            return Quaternion::Undefined();
     }
 
     const Vector3d GCRF_x_J2000 = Vector3d(rb[0][0], rb[1][0], rb[2][0]).normalized();
@@ -105,13 +72,62 @@ Transform J2000::getTransformAt(const Instant& anInstant) const
 
     const RotationMatrix dcm_J2000_GCRF = RotationMatrix::Columns(GCRF_x_J2000, GCRF_y_J2000, GCRF_z_J2000);
 
+    return Quaternion::RotationMatrix(dcm_J2000_GCRF).normalize().rectify();
+}
+
+J2000::J2000(const iau::Theory& aTheory)
+    : theory_(aTheory),
+      q_J2000_GCRF_(computeOrientation(aTheory))
+{
+}
+
+J2000::~J2000() {}
+
+J2000* J2000::clone() const
+{
+    return new J2000(*this);
+}
+
+bool J2000::isDefined() const
+{
+    return true;
+}
+
+bool J2000::isTimeInvariant() const
+{
+    return true;
+}
+
+iau::Theory J2000::getTheory() const
+{
+    return this->theory_;
+}
+
+Transform J2000::getTransformAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("J2000");
+    }
+
+    if (!q_J2000_GCRF_.isDefined())
+    {
+        throw ostk::core::error::runtime::Wrong("Theory");
+    }
+
+    // Frame bias is computed once at construction
+
     const Vector3d x_J2000_GCRF = {0.0, 0.0, 0.0};
     const Vector3d v_J2000_GCRF = {0.0, 0.0, 0.0};
 
-    const Quaternion q_J2000_GCRF = Quaternion::RotationMatrix(dcm_J2000_GCRF).normalize().rectify();
     const Vector3d w_J2000_GCRF_in_J2000 = {0.0, 0.0, 0.0};
 
-    return Transform::Passive(anInstant, x_J2000_GCRF, v_J2000_GCRF, q_J2000_GCRF, w_J2000_GCRF_in_J2000);
+    return Transform::Passive(anInstant, x_J2000_GCRF, v_J2000_GCRF, q_J2000_GCRF_, w_J2000_GCRF_in_J2000);
 }
 
 }  // namespace provider
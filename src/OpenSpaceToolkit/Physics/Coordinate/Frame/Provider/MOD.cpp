@@ -51,8 +51,25 @@ Triple<Angle, Angle, Angle> computeFK5Precession(const Instant& anInstant)
     return {Angle::Radians(zeta * s2r), Angle::Radians(theta * s2r), Angle::Radians(z * s2r)};
 }
 
+static Quaternion computeOrientation(const Instant& anEpoch)
+{
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+
+    if (!anEpoch.isDefined())
+    {
+        return Quaternion::Undefined();
+    }
+
+    const auto& [zeta, theta, z] = computeFK5Precession(anEpoch);
+
+    const RotationMatrix dcm_GCRF_MOD = RotationMatrix::RZ(zeta) * RotationMatrix::RY(-theta) * RotationMatrix::RZ(z);
+
+    return Quaternion::RotationMatrix(dcm_GCRF_MOD).conjugate().normalize().rectify();
+}
+
 MOD::MOD(const Instant& anEpoch)
-    : epoch_(anEpoch)
+    : epoch_(anEpoch),
+      q_MOD_GCRF_(computeOrientation(anEpoch))
 {
 }
 
@@ -68,6 +85,11 @@ bool MOD::isDefined() const
     return true;
 }
 
+bool MOD::isTimeInvariant() const
+{
+    return true;
+}
+
 Instant MOD::getEpoch() const
 {
     return epoch_;
@@ -75,13 +97,6 @@ Instant MOD::getEpoch() const
 
 Transform MOD::getTransformAt(const Instant& anInstant) const
 {
-    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
-    using ostk::mathematics::object::Vector2d;
-
-    using ostk::physics::time::DateTime;
-    using ostk::physics::time::Scale;
-    using ostk::physics::unit::Angle;
-
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
@@ -92,17 +107,19 @@ Transform MOD::getTransformAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("MOD");
     }
 
-    const auto& [zeta, theta, z] = computeFK5Precession(epoch_);
+    if (!q_MOD_GCRF_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Epoch");
+    }
 
-    const RotationMatrix dcm_GCRF_MOD = RotationMatrix::RZ(zeta) * RotationMatrix::RY(-theta) * RotationMatrix::RZ(z);
+    // Precession is evaluated at the epoch, once at construction
 
     const Vector3d x_MOD_GCRF = {0.0, 0.0, 0.0};
     const Vector3d v_MOD_GCRF = {0.0, 0.0, 0.0};
 
-    const Quaternion q_MOD_GCRF = Quaternion::RotationMatrix(dcm_GCRF_MOD).conjugate().normalize().rectify();
     const Vector3d w_MOD_GCRF_in_MOD = {0.0, 0.0, 0.0};
 
-    return Transform::Passive(anInstant, x_MOD_GCRF, v_MOD_GCRF, q_MOD_GCRF, w_MOD_GCRF_in_MOD);
+    return Transform::Passive(anInstant, x_MOD_GCRF, v_MOD_GCRF, q_MOD_GCRF_, w_MOD_GCRF_in_MOD);
 }
 
 }  // namespace provider
@@ -33,6 +33,11 @@ bool Static::isDefined() const
     return transform_.isDefined();
 }
 
+bool Static::isTimeInvariant() const
+{
+    return true;
+}
+
 Transform Static::getTransformAt(const Instant& anInstant) const
 {
     if (!this->isDefined())
@@ -27,23 +27,13 @@ namespace provider
 #define DAS2R (4.848136811095359935899141e-6)
 #define DS2R (7.272205216643039903848712e-5)
 
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
 using IersManager = ostk::physics::coordinate::frame::provider::iers::Manager;
 
-TEME::TEME() {}
-
-TEME::~TEME() {}
-
-TEME* TEME::clone() const
-{
-    return new TEME(*this);
-}
-
-bool TEME::isDefined() const
+namespace
 {
-    return true;
-}
 
-Transform TEME::getTransformAt(const Instant& anInstant) const
+Transform computeTransform(const Instant& anInstant, const EarthOrientationParameters& anEop)
 {
     // Seago, J., & Vallado, D. A. (2000, August). Coordinate frames of the U.S. Space Object Catalogs (AIAA Paper
     // No. 2000‑4025). Presented at the Astrodynamics Specialist Conference. https://doi.org/10.2514/6.2000-4025
@@ -56,20 +46,9 @@ Transform TEME::getTransformAt(const Instant& anInstant) const
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
     using ostk::mathematics::object::Vector2d;
 
-    using ostk::physics::time::DateTime;
     using ostk::physics::time::Scale;
     using ostk::physics::unit::Angle;
 
-    if (!anInstant.isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Instant");
-    }
-
-    if (!this->isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("TEME");
-    }
-
     // Time (UTC)
 
     static const Real djmjd0 = 2400000.5;
@@ -80,7 +59,7 @@ Transform TEME::getTransformAt(const Instant& anInstant) const
 
     // UT1 - UTC (s)
 
-    const Real dut1 = IersManager::Get().getUt1MinusUtcAt(anInstant);  // [s]
+    const Real dut1 = anEop.ut1MinusUtc;  // [s]
     const Real tut = time + dut1 / DAYSEC;
 
     // UT1 as a 2-part Julian Date
@@ -109,7 +88,7 @@ Transform TEME::getTransformAt(const Instant& anInstant) const
 
     // Polar motion matrix using the IAU 1980 model
 
-    const Vector2d polarMotion = IersManager::Get().getPolarMotionAt(anInstant);  // [asec]
+    const Vector2d polarMotion = anEop.polarMotion;  // [asec]
 
     const Real xp = polarMotion.x() * DAS2R;  // [rad]
     const Real yp = polarMotion.y() * DAS2R;  // [rad]
@@ -139,6 +118,69 @@ Transform TEME::getTransformAt(const Instant& anInstant) const
     return Transform::Passive(anInstant, x_TEME_ITRF, v_TEME_ITRF, q_TEME_ITRF, w_TEME_ITRF_in_TEME);
 }
 
+}  // namespace
+
+TEME::TEME() {}
+
+TEME::~TEME() {}
+
+TEME* TEME::clone() const
+{
+    return new TEME(*this);
+}
+
+bool TEME::isDefined() const
+{
+    return true;
+}
+
+Transform TEME::getTransformAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("TEME");
+    }
+
+    return computeTransform(anInstant, IersManager::Get().getEopAt(anInstant));
+}
+
+Array<Transform> TEME::getTransformsAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::core::type::Size;
+
+    for (const auto& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("TEME");
+    }
+
+    // All instants are resolved against the same IERS snapshot
+
+    const Array<EarthOrientationParameters> eops = IersManager::Get().getEopAt(anInstantArray);
+
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    for (Size index = 0; index < anInstantArray.getSize(); ++index)
+    {
+        transforms.add(computeTransform(anInstantArray[index], eops[index]));
+    }
+
+    return transforms;
+}
+
 }  // namespace provider
 }  // namespace frame
 }  // namespace coordinate
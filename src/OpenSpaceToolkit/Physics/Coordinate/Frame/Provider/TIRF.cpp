@@ -15,6 +15,7 @@
 
 #define DAYSEC (86400.0)
 
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
 using IersManager = ostk::physics::coordinate::frame::provider::iers::Manager;
 
 namespace ostk
@@ -28,50 +29,28 @@ namespace frame
 namespace provider
 {
 
-TIRF::TIRF() {}
-
-TIRF::~TIRF() {}
-
-TIRF* TIRF::clone() const
-{
-    return new TIRF(*this);
-}
-
-bool TIRF::isDefined() const
+namespace
 {
-    return true;
-}
 
-Transform TIRF::getTransformAt(const Instant& anInstant) const
+Transform computeTransform(
+    const Instant& anInstant, const Real& aUtcModifiedJulianDate, const Real& aUt1MinusUtc, const Real& aLod
+)
 {
     using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
 
-    using ostk::physics::time::DateTime;
-    using ostk::physics::time::Scale;
-
-    if (!anInstant.isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Instant");
-    }
-
-    if (!this->isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("TIRF");
-    }
-
     // http://www.iausofa.org/2018_0130_C/sofa/sofa_pn_c.pdf
 
     // Time (UTC)
 
     static const Real djmjd0 = 2400000.5;
-    const Real utc = anInstant.getModifiedJulianDate(Scale::UTC);
+    const Real utc = aUtcModifiedJulianDate;
 
     const Real date = std::floor(utc);
     const Real time = utc - date;
 
     // UT1 - UTC (s)
 
-    const Real dut1 = IersManager::Get().getUt1MinusUtcAt(anInstant);  // [s]
+    const Real dut1 = aUt1MinusUtc;  // [s]
 
     const Real tut = time + dut1 / DAYSEC;
 
@@ -89,7 +68,7 @@ Transform TIRF::getTransformAt(const Instant& anInstant) const
 
     // Angular velocity
 
-    Real lod_ms = IersManager::Get().getLodAt(anInstant);  // [ms]
+    Real lod_ms = aLod;  // [ms]
 
     if (!lod_ms.isDefined())
     {
@@ -111,6 +90,80 @@ Transform TIRF::getTransformAt(const Instant& anInstant) const
     return Transform::Passive(anInstant, x_TIRF_CIRF, v_TIRF_CIRF, q_TIRF_CIRF, w_TIRF_CIRF_in_TIRF);
 }
 
+}  // namespace
+
+TIRF::TIRF() {}
+
+TIRF::~TIRF() {}
+
+TIRF* TIRF::clone() const
+{
+    return new TIRF(*this);
+}
+
+bool TIRF::isDefined() const
+{
+    return true;
+}
+
+Transform TIRF::getTransformAt(const Instant& anInstant) const
+{
+    using ostk::physics::time::Scale;
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("TIRF");
+    }
+
+    const EarthOrientationParameters eop = IersManager::Get().getEopAt(anInstant);
+
+    return computeTransform(anInstant, anInstant.getModifiedJulianDate(Scale::UTC), eop.ut1MinusUtc, eop.lod);
+}
+
+Array<Transform> TIRF::getTransformsAt(const Array<Instant>& anInstantArray) const
+{
+    using ostk::core::type::Size;
+
+    using ostk::physics::time::Scale;
+
+    for (const auto& instant : anInstantArray)
+    {
+        if (!instant.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Instant");
+        }
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("TIRF");
+    }
+
+    // All instants are resolved against the same IERS snapshot
+
+    const Array<EarthOrientationParameters> eops = IersManager::Get().getEopAt(anInstantArray);
+
+    Array<Transform> transforms = Array<Transform>::Empty();
+    transforms.reserve(anInstantArray.getSize());
+
+    for (Size index = 0; index < anInstantArray.getSize(); ++index)
+    {
+        const Instant& instant = anInstantArray[index];
+        const EarthOrientationParameters& eop = eops[index];
+
+        transforms.add(
+            computeTransform(instant, instant.getModifiedJulianDate(Scale::UTC), eop.ut1MinusUtc, eop.lod)
+        );
+    }
+
+    return transforms;
+}
+
 }  // namespace provider
 }  // namespace frame
 }  // namespace coordinate
@@ -23,9 +23,55 @@ namespace provider
 
 using ostk::physics::time::Scale;
 
+static Quaternion computeOrientation(const Instant& anEpoch, const iau::Theory& aTheory)
+{
+    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
+
+    if (!anEpoch.isDefined())
+    {
+        return Quaternion::Undefined();
+    }
+
+    const double date1 = 2400000.5;
+    const double date2 = anEpoch.getModifiedJulianDate(Scale::TT);
+
+    double rbpn[3][3];
+
+    switch (aTheory)
+    {
+        case iau::Theory::IAU_2000A:
+            // Matrix of precession−nutation for a given date (including frame bias), equinox based, IAU 2000A model.
+            iauPnm00a(date1, date2, rbpn);
+            break;
+
+        case iau::Theory::IAU_2000B:
+            // Matrix of precession−nutation for a given date (including frame bias), equinox−based, IAU 2000B model.
+            iauPnm00b(date1, date2, rbpn);
+            break;
+
+        case iau::Theory::IAU_2006:
+            // Matrix of precession−nutation for a given date (including frame bias), equinox based, IAU 2006 precession
+            // and IAU 2000A nutation models.
+            iauPnm06a(date1, date2, rbpn);
+            break;
+
+        default:
+            return Quaternion::Undefined();
+    }
+
+    const Vector3d TOD_x_GCRF = Vector3d(rbpn[0][0], rbpn[1][0], rbpn[2][0]).normalized();
+    const Vector3d TOD_y_GCRF = Vector3d(rbpn[0][1], rbpn[1][1], rbpn[2][1]).normalized();
+    const Vector3d TOD_z_GCRF = Vector3d(rbpn[0][2], rbpn[1][2], rbpn[2][2]).normalized();
+
+    const RotationMatrix dcm_TOD_GCRF = RotationMatrix::Columns(TOD_x_GCRF, TOD_y_GCRF, TOD_z_GCRF);
+
+    return Quaternion::RotationMatrix(dcm_TOD_GCRF).normalize().rectify();
+}
+
 TOD::TOD(const Instant& anEpoch, const iau::Theory& aTheory)
     : epoch_(anEpoch),
-      theory_(aTheory)
+      theory_(aTheory),
+      q_TOD_GCRF_(computeOrientation(anEpoch, aTheory))
 {
 }
 
@@ -41,6 +87,11 @@ bool TOD::isDefined() const
     return this->epoch_.isDefined();
 }
 
+bool TOD::isTimeInvariant() const
+{
+    return true;
+}
+
 Instant TOD::getEpoch() const
 {
     if (!this->isDefined())
@@ -63,8 +114,6 @@ iau::Theory TOD::getTheory() const
 
 Transform TOD::getTransformAt(const Instant& anInstant) const
 {
-    using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
-
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
@@ -75,48 +124,19 @@ Transform TOD::getTransformAt(const Instant& anInstant) const
         throw ostk::core::error::runtime::Undefined("TOD");
     }
 
-    const double date1 = 2400000.5;
-    const double date2 = this->epoch_.getModifiedJulianDate(Scale::TT);
-
-    double rbpn[3][3];
-
-    switch (this->theory_)
+    if (!q_TOD_GCRF_.isDefined())
     {
-        case iau::Theory::IAU_2000A:
-            // Matrix of precession−nutation for a given date (including frame bias), equinox based, IAU 2000A model.
-            iauPnm00a(date1, date2, rbpn);
-            break;
-
-        case iau::Theory::IAU_2000B:
-            // Matrix of precession−nutation for a given date (including frame bias), equinox−based, IAU 2000B model.
-            iauPnm00b(date1, date2, rbpn);
-            break;
-
-        case iau::Theory::IAU_2006:
-            // Matrix of precession−nutation for a given date (including frame bias), equinox based, IAU 2006 precession
-            // and IAU 2000A nutation models.
-            iauPnm06a(date1, date2, rbpn);
-            break;
-
-        default:
-            throw ostk::core::error::runtime::Wrong("Theory");
-            break;
+        throw ostk::core::error::runtime::Wrong("Theory");
     }
 
-    const Vector3d TOD_x_GCRF = Vector3d(rbpn[0][0], rbpn[1][0], rbpn[2][0]).normalized();
-    const Vector3d TOD_y_GCRF = Vector3d(rbpn[0][1], rbpn[1][1], rbpn[2][1]).normalized();
-    const Vector3d TOD_z_GCRF = Vector3d(rbpn[0][2], rbpn[1][2], rbpn[2][2]).normalized();
-
-    const RotationMatrix dcm_TOD_GCRF =
-        RotationMatrix::Columns(TOD_x_GCRF, TOD_y_GCRF, TOD_z_GCRF);  // Change variable name?
+    // Precession-nutation is evaluated at the epoch, once at construction
 
     const Vector3d x_TOD_GCRF = {0.0, 0.0, 0.0};
     const Vector3d v_TOD_GCRF = {0.0, 0.0, 0.0};
 
-    const Quaternion q_TOD_GCRF = Quaternion::RotationMatrix(dcm_TOD_GCRF).normalize().rectify();
     const Vector3d w_TOD_GCRF_in_TOD = {0.0, 0.0, 0.0};
 
-    return Transform::Passive(anInstant, x_TOD_GCRF, v_TOD_GCRF, q_TOD_GCRF, w_TOD_GCRF_in_TOD);
+    return Transform::Passive(anInstant, x_TOD_GCRF, v_TOD_GCRF, q_TOD_GCRF_, w_TOD_GCRF_in_TOD);
 }
 
 }  // namespace provider
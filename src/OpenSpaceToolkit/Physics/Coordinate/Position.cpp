@@ -243,6 +243,61 @@ Position Position::FromLLA(
     );
 }
 
+Array<Position> Position::InFrame(
+    const Array<Position>& aPositionArray, const Shared<const Frame>& aFrameSPtr, const Array<Instant>& anInstantArray
+)
+{
+    using ostk::core::type::Index;
+
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (aPositionArray.getSize() != anInstantArray.getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Position array size [{}] differs from instant array size [{}].",
+            aPositionArray.getSize(),
+            anInstantArray.getSize()
+        );
+    }
+
+    if (aPositionArray.isEmpty())
+    {
+        return Array<Position>::Empty();
+    }
+
+    const Shared<const Frame>& frameSPtr = aPositionArray.accessFirst().frameSPtr_;
+
+    for (const auto& position : aPositionArray)
+    {
+        if (!position.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Position");
+        }
+
+        if ((*position.frameSPtr_) != (*frameSPtr))
+        {
+            throw ostk::core::error::RuntimeError("Positions are expressed in different frames.");
+        }
+    }
+
+    const Array<Transform> transforms = frameSPtr->getTransformsTo(aFrameSPtr, anInstantArray);
+
+    Array<Position> positions = Array<Position>::Empty();
+    positions.reserve(aPositionArray.getSize());
+
+    for (Index index = 0; index < aPositionArray.getSize(); ++index)
+    {
+        const Position& position = aPositionArray[index];
+
+        positions.add({transforms[index].applyToPosition(position.coordinates_), position.unit_, aFrameSPtr});
+    }
+
+    return positions;
+}
+
 }  // namespace coordinate
 }  // namespace physics
 }  // namespace ostk
@@ -0,0 +1,349 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+
+PositionArray::PositionArray(
+    const Matrix3Xd& aCoordinateMatrix, const PositionArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+)
+    : coordinates_(aCoordinateMatrix),
+      viewBufferPtr_(nullptr),
+      viewSize_(0),
+      unit_(aUnit),
+      frameSPtr_(aFrameSPtr)
+{
+}
+
+PositionArray::PositionArray(
+    Matrix3Xd&& aCoordinateMatrix, const PositionArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+)
+    : coordinates_(std::move(aCoordinateMatrix)),
+      viewBufferPtr_(nullptr),
+      viewSize_(0),
+      unit_(aUnit),
+      frameSPtr_(aFrameSPtr)
+{
+}
+
+bool PositionArray::operator==(const PositionArray& aPositionArray) const
+{
+    if ((!this->isDefined()) || (!aPositionArray.isDefined()))
+    {
+        return false;
+    }
+
+    return (unit_ == aPositionArray.unit_) && ((*frameSPtr_) == (*aPositionArray.frameSPtr_)) &&
+           (this->getSize() == aPositionArray.getSize()) &&
+           (this->accessCoordinates() == aPositionArray.accessCoordinates());
+}
+
+bool PositionArray::operator!=(const PositionArray& aPositionArray) const
+{
+    return !((*this) == aPositionArray);
+}
+
+Position PositionArray::operator[](const Index& anIndex) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::RuntimeError("Index [{}] out of bounds [{}].", anIndex, this->getSize());
+    }
+
+    return {this->accessCoordinates().col(anIndex), unit_, frameSPtr_};
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const PositionArray& aPositionArray)
+{
+    ostk::core::utils::Print::Header(anOutputStream, "Position Array");
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << aPositionArray.getSize();
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Unit:"
+        << ((aPositionArray.unit_ != Position::Unit::Undefined) ? Length::StringFromUnit(aPositionArray.unit_)
+                                                                : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Frame:"
+        << (((aPositionArray.frameSPtr_ != nullptr) && aPositionArray.frameSPtr_->isDefined())
+                ? aPositionArray.frameSPtr_->getName()
+                : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "View:" << (aPositionArray.isView() ? "True" : "False");
+
+    ostk::core::utils::Print::Footer(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool PositionArray::isDefined() const
+{
+    return (unit_ != Position::Unit::Undefined) && (frameSPtr_ != nullptr) && frameSPtr_->isDefined();
+}
+
+bool PositionArray::isEmpty() const
+{
+    return this->getSize() == 0;
+}
+
+bool PositionArray::isView() const
+{
+    return viewBufferPtr_ != nullptr;
+}
+
+Size PositionArray::getSize() const
+{
+    return (viewBufferPtr_ != nullptr) ? viewSize_ : static_cast<Size>(coordinates_.cols());
+}
+
+PositionArray::ConstMatrix3XdMap PositionArray::accessCoordinates() const
+{
+    if (viewBufferPtr_ != nullptr)
+    {
+        return ConstMatrix3XdMap(viewBufferPtr_, 3, static_cast<Eigen::Index>(viewSize_));
+    }
+
+    return ConstMatrix3XdMap(coordinates_.data(), 3, coordinates_.cols());
+}
+
+Shared<const Frame> PositionArray::accessFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    return frameSPtr_;
+}
+
+PositionArray::Matrix3Xd PositionArray::getCoordinates() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    return this->accessCoordinates();
+}
+
+PositionArray::Unit PositionArray::getUnit() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    return unit_;
+}
+
+Array<Position> PositionArray::getPositions() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    const ConstMatrix3XdMap coordinates = this->accessCoordinates();
+
+    Array<Position> positions = Array<Position>::Empty();
+    positions.reserve(this->getSize());
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        positions.add({coordinates.col(index), unit_, frameSPtr_});
+    }
+
+    return positions;
+}
+
+PositionArray PositionArray::inUnit(const PositionArray::Unit& aUnit) const
+{
+    if (aUnit == Position::Unit::Undefined)
+    {
+        throw ostk::core::error::runtime::Undefined("Unit");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    return {Matrix3Xd(this->accessCoordinates() * Length(1.0, unit_).in(aUnit)), aUnit, frameSPtr_};
+}
+
+PositionArray PositionArray::inMeters() const
+{
+    return this->inUnit(Position::Unit::Meter);
+}
+
+PositionArray PositionArray::inFrame(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    const Transform transform = frameSPtr_->getTransformTo(aFrameSPtr, anInstant);
+
+    // x_B = q_B_A * (x_A + t_B_A_in_A), with q_B_A applied as a rotation matrix to all columns at once
+
+    const Quaternion& q_B_A = transform.accessOrientation();
+
+    Eigen::Matrix3d dcm_B_A;
+    dcm_B_A.col(0) = q_B_A * Vector3d::UnitX();
+    dcm_B_A.col(1) = q_B_A * Vector3d::UnitY();
+    dcm_B_A.col(2) = q_B_A * Vector3d::UnitZ();
+
+    Matrix3Xd coordinates = dcm_B_A * (this->accessCoordinates().colwise() + transform.accessTranslation());
+
+    return {std::move(coordinates), unit_, aFrameSPtr};
+}
+
+PositionArray PositionArray::inFrame(const Shared<const Frame>& aFrameSPtr, const Array<Instant>& anInstantArray)
+    const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    if (anInstantArray.getSize() == 1)
+    {
+        return this->inFrame(aFrameSPtr, anInstantArray.accessFirst());
+    }
+
+    if (anInstantArray.getSize() != this->getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant array size [{}] differs from position array size [{}].", anInstantArray.getSize(), this->getSize()
+        );
+    }
+
+    const Array<Transform> transforms = frameSPtr_->getTransformsTo(aFrameSPtr, anInstantArray);
+
+    const ConstMatrix3XdMap coordinates = this->accessCoordinates();
+
+    Matrix3Xd transformedCoordinates(3, coordinates.cols());
+
+    for (Index index = 0; index < transforms.getSize(); ++index)
+    {
+        // x_B = q_B_A * (x_A + t_B_A_in_A)
+
+        transformedCoordinates.col(index) = transforms[index].accessOrientation() *
+                                            Vector3d(coordinates.col(index) + transforms[index].accessTranslation());
+    }
+
+    return {std::move(transformedCoordinates), unit_, aFrameSPtr};
+}
+
+PositionArray PositionArray::Undefined()
+{
+    return {Matrix3Xd(3, 0), Position::Unit::Undefined, nullptr};
+}
+
+PositionArray PositionArray::Meters(const Matrix3Xd& aCoordinateMatrix, const Shared<const Frame>& aFrameSPtr)
+{
+    return {aCoordinateMatrix, Position::Unit::Meter, aFrameSPtr};
+}
+
+PositionArray PositionArray::FromPositions(const Array<Position>& aPositionArray)
+{
+    if (aPositionArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    const Position& firstPosition = aPositionArray.accessFirst();
+
+    if (!firstPosition.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position");
+    }
+
+    const PositionArray::Unit unit = firstPosition.getUnit();
+    const Shared<const Frame> frameSPtr = firstPosition.accessFrame();
+
+    Matrix3Xd coordinates(3, aPositionArray.getSize());
+
+    for (Index index = 0; index < aPositionArray.getSize(); ++index)
+    {
+        const Position& position = aPositionArray[index];
+
+        if (!position.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Position");
+        }
+
+        if ((*position.accessFrame()) != (*frameSPtr))
+        {
+            throw ostk::core::error::RuntimeError("Positions are expressed in different frames.");
+        }
+
+        coordinates.col(index) =
+            (position.getUnit() == unit) ? position.accessCoordinates() : position.inUnit(unit).accessCoordinates();
+    }
+
+    return {std::move(coordinates), unit, frameSPtr};
+}
+
+PositionArray PositionArray::View(
+    const Matrix3Xd& aCoordinateMatrix, const PositionArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+)
+{
+    return {aCoordinateMatrix.data(), static_cast<Size>(aCoordinateMatrix.cols()), aUnit, aFrameSPtr};
+}
+
+PositionArray PositionArray::View(
+    const double* aCoordinateBuffer,
+    const Size& aSize,
+    const PositionArray::Unit& aUnit,
+    const Shared<const Frame>& aFrameSPtr
+)
+{
+    if ((aCoordinateBuffer == nullptr) && (aSize > 0))
+    {
+        throw ostk::core::error::runtime::Undefined("Coordinate buffer");
+    }
+
+    return {aCoordinateBuffer, aSize, aUnit, aFrameSPtr};
+}
+
+PositionArray::PositionArray(
+    const double* aCoordinateBuffer,
+    const Size& aSize,
+    const PositionArray::Unit& aUnit,
+    const Shared<const Frame>& aFrameSPtr
+)
+    : coordinates_(3, 0),
+      viewBufferPtr_(aCoordinateBuffer),
+      viewSize_(aSize),
+      unit_(aUnit),
+      frameSPtr_(aFrameSPtr)
+{
+}
+
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
@@ -164,6 +164,72 @@ Velocity Velocity::MetersPerSecond(const Vector3d& aCoordinateSet, const Shared<
     return {aCoordinateSet, Velocity::Unit::MeterPerSecond, aFrameSPtr};
 }
 
+Array<Velocity> Velocity::InFrame(
+    const Array<Velocity>& aVelocityArray,
+    const Array<Position>& aPositionArray,
+    const Shared<const Frame>& aFrameSPtr,
+    const Array<Instant>& anInstantArray
+)
+{
+    using ostk::core::type::Index;
+
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if ((aVelocityArray.getSize() != aPositionArray.getSize()) ||
+        (aVelocityArray.getSize() != anInstantArray.getSize()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Velocity array size [{}] differs from position array size [{}] or instant array size [{}].",
+            aVelocityArray.getSize(),
+            aPositionArray.getSize(),
+            anInstantArray.getSize()
+        );
+    }
+
+    if (aVelocityArray.isEmpty())
+    {
+        return Array<Velocity>::Empty();
+    }
+
+    const Shared<const Frame>& frameSPtr = aVelocityArray.accessFirst().frameSPtr_;
+
+    for (const auto& velocity : aVelocityArray)
+    {
+        if (!velocity.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Velocity");
+        }
+
+        if ((*velocity.frameSPtr_) != (*frameSPtr))
+        {
+            throw ostk::core::error::RuntimeError("Velocities are expressed in different frames.");
+        }
+    }
+
+    const Array<Position> positions = Position::InFrame(aPositionArray, frameSPtr, anInstantArray);
+
+    const Array<Transform> transforms = frameSPtr->getTransformsTo(aFrameSPtr, anInstantArray);
+
+    Array<Velocity> velocities = Array<Velocity>::Empty();
+    velocities.reserve(aVelocityArray.getSize());
+
+    for (Index index = 0; index < aVelocityArray.getSize(); ++index)
+    {
+        const Velocity& velocity = aVelocityArray[index];
+
+        velocities.add(
+            {transforms[index].applyToVelocity(positions[index].accessCoordinates(), velocity.coordinates_),
+             velocity.unit_,
+             aFrameSPtr}
+        );
+    }
+
+    return velocities;
+}
+
 String Velocity::StringFromUnit(const Velocity::Unit& aUnit)
 {
     switch (aUnit)
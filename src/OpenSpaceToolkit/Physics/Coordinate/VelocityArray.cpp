@@ -0,0 +1,405 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/VelocityArray.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace coordinate
+{
+
+VelocityArray::VelocityArray(
+    const Matrix3Xd& aCoordinateMatrix, const VelocityArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+)
+    : coordinates_(aCoordinateMatrix),
+      viewBufferPtr_(nullptr),
+      viewSize_(0),
+      unit_(aUnit),
+      frameSPtr_(aFrameSPtr)
+{
+}
+
+VelocityArray::VelocityArray(
+    Matrix3Xd&& aCoordinateMatrix, const VelocityArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+)
+    : coordinates_(std::move(aCoordinateMatrix)),
+      viewBufferPtr_(nullptr),
+      viewSize_(0),
+      unit_(aUnit),
+      frameSPtr_(aFrameSPtr)
+{
+}
+
+bool VelocityArray::operator==(const VelocityArray& aVelocityArray) const
+{
+    if ((!this->isDefined()) || (!aVelocityArray.isDefined()))
+    {
+        return false;
+    }
+
+    return (unit_ == aVelocityArray.unit_) && ((*frameSPtr_) == (*aVelocityArray.frameSPtr_)) &&
+           (this->getSize() == aVelocityArray.getSize()) &&
+           (this->accessCoordinates() == aVelocityArray.accessCoordinates());
+}
+
+bool VelocityArray::operator!=(const VelocityArray& aVelocityArray) const
+{
+    return !((*this) == aVelocityArray);
+}
+
+Velocity VelocityArray::operator[](const Index& anIndex) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::RuntimeError("Index [{}] out of bounds [{}].", anIndex, this->getSize());
+    }
+
+    return {this->accessCoordinates().col(anIndex), unit_, frameSPtr_};
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const VelocityArray& aVelocityArray)
+{
+    ostk::core::utils::Print::Header(anOutputStream, "Velocity Array");
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << aVelocityArray.getSize();
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Unit:"
+        << ((aVelocityArray.unit_ != Velocity::Unit::Undefined) ? Velocity::StringFromUnit(aVelocityArray.unit_)
+                                                                : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Frame:"
+        << (((aVelocityArray.frameSPtr_ != nullptr) && aVelocityArray.frameSPtr_->isDefined())
+                ? aVelocityArray.frameSPtr_->getName()
+                : "Undefined");
+    ostk::core::utils::Print::Line(anOutputStream) << "View:" << (aVelocityArray.isView() ? "True" : "False");
+
+    ostk::core::utils::Print::Footer(anOutputStream);
+
+    return anOutputStream;
+}
+
+bool VelocityArray::isDefined() const
+{
+    return (unit_ != Velocity::Unit::Undefined) && (frameSPtr_ != nullptr) && frameSPtr_->isDefined();
+}
+
+bool VelocityArray::isEmpty() const
+{
+    return this->getSize() == 0;
+}
+
+bool VelocityArray::isView() const
+{
+    return viewBufferPtr_ != nullptr;
+}
+
+Size VelocityArray::getSize() const
+{
+    return (viewBufferPtr_ != nullptr) ? viewSize_ : static_cast<Size>(coordinates_.cols());
+}
+
+VelocityArray::ConstMatrix3XdMap VelocityArray::accessCoordinates() const
+{
+    if (viewBufferPtr_ != nullptr)
+    {
+        return ConstMatrix3XdMap(viewBufferPtr_, 3, static_cast<Eigen::Index>(viewSize_));
+    }
+
+    return ConstMatrix3XdMap(coordinates_.data(), 3, coordinates_.cols());
+}
+
+Shared<const Frame> VelocityArray::accessFrame() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    return frameSPtr_;
+}
+
+VelocityArray::Matrix3Xd VelocityArray::getCoordinates() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    return this->accessCoordinates();
+}
+
+VelocityArray::Unit VelocityArray::getUnit() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    return unit_;
+}
+
+Array<Velocity> VelocityArray::getVelocities() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    const ConstMatrix3XdMap coordinates = this->accessCoordinates();
+
+    Array<Velocity> velocities = Array<Velocity>::Empty();
+    velocities.reserve(this->getSize());
+
+    for (Index index = 0; index < this->getSize(); ++index)
+    {
+        velocities.add({coordinates.col(index), unit_, frameSPtr_});
+    }
+
+    return velocities;
+}
+
+VelocityArray VelocityArray::inUnit(const VelocityArray::Unit& aUnit) const
+{
+    if (aUnit == Velocity::Unit::Undefined)
+    {
+        throw ostk::core::error::runtime::Undefined("Unit");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    const Real conversionFactor =
+        Derived(1.0, Velocity::DerivedUnitFromVelocityUnit(unit_)).in(Velocity::DerivedUnitFromVelocityUnit(aUnit));
+
+    return {Matrix3Xd(this->accessCoordinates() * conversionFactor), aUnit, frameSPtr_};
+}
+
+VelocityArray VelocityArray::inFrame(
+    const PositionArray& aPositionArray, const Shared<const Frame>& aFrameSPtr, const Instant& anInstant
+) const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!aPositionArray.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    if (aPositionArray.getSize() != this->getSize())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Position array size [{}] differs from velocity array size [{}].", aPositionArray.getSize(), this->getSize()
+        );
+    }
+
+    // Express positions in the velocity frame, viewing their coordinates when already the case
+
+    const PositionArray positionArray = ((*aPositionArray.accessFrame()) == (*frameSPtr_))
+                                          ? PositionArray::View(
+                                                aPositionArray.accessCoordinates().data(),
+                                                aPositionArray.getSize(),
+                                                aPositionArray.getUnit(),
+                                                frameSPtr_
+                                            )
+                                          : aPositionArray.inFrame(frameSPtr_, anInstant);
+
+    const Transform transform = frameSPtr_->getTransformTo(aFrameSPtr, anInstant);
+
+    // v_B_in_B = q_B_A * (v_A_in_A + v_B_A_in_A) - Ω_B_A_in_B x (q_B_A * (x_A + t_B_A_in_A)), with q_B_A applied as
+    // a rotation matrix to all columns at once
+
+    const Quaternion& q_B_A = transform.accessOrientation();
+
+    Eigen::Matrix3d dcm_B_A;
+    dcm_B_A.col(0) = q_B_A * Vector3d::UnitX();
+    dcm_B_A.col(1) = q_B_A * Vector3d::UnitY();
+    dcm_B_A.col(2) = q_B_A * Vector3d::UnitZ();
+
+    const Matrix3Xd positionCoordinates =
+        dcm_B_A * (positionArray.accessCoordinates().colwise() + transform.accessTranslation());
+
+    Matrix3Xd coordinates = dcm_B_A * (this->accessCoordinates().colwise() + transform.accessVelocity());
+    coordinates += positionCoordinates.colwise().cross(transform.accessAngularVelocity());
+
+    return {std::move(coordinates), unit_, aFrameSPtr};
+}
+
+VelocityArray VelocityArray::inFrame(
+    const PositionArray& aPositionArray, const Shared<const Frame>& aFrameSPtr, const Array<Instant>& anInstantArray
+) const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!aPositionArray.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    if (anInstantArray.getSize() == 1)
+    {
+        return this->inFrame(aPositionArray, aFrameSPtr, anInstantArray.accessFirst());
+    }
+
+    if ((aPositionArray.getSize() != this->getSize()) || (anInstantArray.getSize() != this->getSize()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Position array size [{}] or instant array size [{}] differs from velocity array size [{}].",
+            aPositionArray.getSize(),
+            anInstantArray.getSize(),
+            this->getSize()
+        );
+    }
+
+    // Express positions in the velocity frame, viewing their coordinates when already the case
+
+    const PositionArray positionArray = ((*aPositionArray.accessFrame()) == (*frameSPtr_))
+                                          ? PositionArray::View(
+                                                aPositionArray.accessCoordinates().data(),
+                                                aPositionArray.getSize(),
+                                                aPositionArray.getUnit(),
+                                                frameSPtr_
+                                            )
+                                          : aPositionArray.inFrame(frameSPtr_, anInstantArray);
+
+    const Array<Transform> transforms = frameSPtr_->getTransformsTo(aFrameSPtr, anInstantArray);
+
+    const ConstMatrix3XdMap positionCoordinates = positionArray.accessCoordinates();
+    const ConstMatrix3XdMap velocityCoordinates = this->accessCoordinates();
+
+    Matrix3Xd transformedCoordinates(3, velocityCoordinates.cols());
+
+    for (Index index = 0; index < transforms.getSize(); ++index)
+    {
+        // v_B_in_B = q_B_A * (v_A_in_A + v_B_A_in_A) - Ω_B_A_in_B x (q_B_A * (x_A + t_B_A_in_A))
+
+        const Transform& transform = transforms[index];
+
+        const Quaternion& q_B_A = transform.accessOrientation();
+
+        transformedCoordinates.col(index) =
+            q_B_A * Vector3d(velocityCoordinates.col(index) + transform.accessVelocity()) -
+            transform.accessAngularVelocity().cross(
+                q_B_A * Vector3d(positionCoordinates.col(index) + transform.accessTranslation())
+            );
+    }
+
+    return {std::move(transformedCoordinates), unit_, aFrameSPtr};
+}
+
+VelocityArray VelocityArray::Undefined()
+{
+    return {Matrix3Xd(3, 0), Velocity::Unit::Undefined, nullptr};
+}
+
+VelocityArray VelocityArray::MetersPerSecond(const Matrix3Xd& aCoordinateMatrix, const Shared<const Frame>& aFrameSPtr)
+{
+    return {aCoordinateMatrix, Velocity::Unit::MeterPerSecond, aFrameSPtr};
+}
+
+VelocityArray VelocityArray::FromVelocities(const Array<Velocity>& aVelocityArray)
+{
+    if (aVelocityArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity array");
+    }
+
+    const Velocity& firstVelocity = aVelocityArray.accessFirst();
+
+    if (!firstVelocity.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Velocity");
+    }
+
+    const VelocityArray::Unit unit = firstVelocity.getUnit();
+    const Shared<const Frame> frameSPtr = firstVelocity.accessFrame();
+
+    Matrix3Xd coordinates(3, aVelocityArray.getSize());
+
+    for (Index index = 0; index < aVelocityArray.getSize(); ++index)
+    {
+        const Velocity& velocity = aVelocityArray[index];
+
+        if (!velocity.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Velocity");
+        }
+
+        if ((*velocity.accessFrame()) != (*frameSPtr))
+        {
+            throw ostk::core::error::RuntimeError("Velocities are expressed in different frames.");
+        }
+
+        coordinates.col(index) =
+            (velocity.getUnit() == unit) ? velocity.accessCoordinates() : velocity.inUnit(unit).accessCoordinates();
+    }
+
+    return {std::move(coordinates), unit, frameSPtr};
+}
+
+VelocityArray VelocityArray::View(
+    const Matrix3Xd& aCoordinateMatrix, const VelocityArray::Unit& aUnit, const Shared<const Frame>& aFrameSPtr
+)
+{
+    return {aCoordinateMatrix.data(), static_cast<Size>(aCoordinateMatrix.cols()), aUnit, aFrameSPtr};
+}
+
+VelocityArray VelocityArray::View(
+    const double* aCoordinateBuffer,
+    const Size& aSize,
+    const VelocityArray::Unit& aUnit,
+    const Shared<const Frame>& aFrameSPtr
+)
+{
+    if ((aCoordinateBuffer == nullptr) && (aSize > 0))
+    {
+        throw ostk::core::error::runtime::Undefined("Coordinate buffer");
+    }
+
+    return {aCoordinateBuffer, aSize, aUnit, aFrameSPtr};
+}
+
+VelocityArray::VelocityArray(
+    const double* aCoordinateBuffer,
+    const Size& aSize,
+    const VelocityArray::Unit& aUnit,
+    const Shared<const Frame>& aFrameSPtr
+)
+    : coordinates_(3, 0),
+      viewBufferPtr_(aCoordinateBuffer),
+      viewSize_(aSize),
+      unit_(aUnit),
+      frameSPtr_(aFrameSPtr)
+{
+}
+
+}  // namespace coordinate
+}  // namespace physics
+}  // namespace ostk
@@ -0,0 +1,402 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <thread>
+#include <type_traits>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Data/Cache.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Parser.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace data
+{
+namespace cache
+{
+
+using ostk::core::filesystem::Path;
+using ostk::core::type::Uint16;
+using ostk::core::type::Uint8;
+
+using ostk::physics::data::parser::MappedFile;
+
+namespace
+{
+
+constexpr char cacheMagic[8] = {'O', 'S', 'T', 'K', 'C', 'A', 'C', 'H'};
+constexpr std::uint32_t cacheFormatVersion = 1;
+constexpr std::size_t contentTypeCapacity = 24;
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t formatVersion;
+    std::uint32_t contentVersion;
+    char contentType[contentTypeCapacity];
+    std::int64_t sourceModifiedSeconds;
+    std::int64_t sourceModifiedNanoseconds;
+    std::uint64_t sourceSize;
+    std::uint64_t payloadSize;
+    std::uint64_t payloadChecksum;
+};
+
+static_assert(std::is_trivially_copyable_v<Header>);
+
+// FNV-1a
+std::uint64_t checksumOf(const std::string_view& aBuffer)
+{
+    std::uint64_t checksum = 14695981039346656037ULL;
+
+    for (const char character : aBuffer)
+    {
+        checksum ^= static_cast<std::uint8_t>(character);
+        checksum *= 1099511628211ULL;
+    }
+
+    return checksum;
+}
+
+// Expected header of the cache of a source file, as it is now (payload fields are left empty)
+bool makeHeader(
+    const File& aSourceFile, const String& aContentType, const Uint32& aContentVersion, Header& aHeader
+)
+{
+    if (aContentType.getLength() > contentTypeCapacity)
+    {
+        throw ostk::core::error::runtime::Wrong("Content type");
+    }
+
+    struct stat sourceStatus;
+
+    if (::stat(aSourceFile.getPath().toString().c_str(), &sourceStatus) != 0)
+    {
+        return false;
+    }
+
+    std::memset(&aHeader, 0, sizeof(Header));
+
+    std::memcpy(aHeader.magic, cacheMagic, sizeof(cacheMagic));
+    aHeader.formatVersion = cacheFormatVersion;
+    aHeader.contentVersion = aContentVersion;
+    std::memcpy(aHeader.contentType, aContentType.data(), aContentType.getLength());
+    aHeader.sourceModifiedSeconds = static_cast<std::int64_t>(sourceStatus.st_mtim.tv_sec);
+    aHeader.sourceModifiedNanoseconds = static_cast<std::int64_t>(sourceStatus.st_mtim.tv_nsec);
+    aHeader.sourceSize = static_cast<std::uint64_t>(sourceStatus.st_size);
+
+    return true;
+}
+
+}  // namespace
+
+Writer::Writer()
+    : buffer_()
+{
+}
+
+void Writer::writeSize(const Size& aSize)
+{
+    const std::uint64_t size = static_cast<std::uint64_t>(aSize);
+
+    this->write(&size, sizeof(size));
+}
+
+void Writer::writeInteger(const Integer& anInteger)
+{
+    const std::uint8_t isDefined = anInteger.isDefined() ? 1 : 0;
+    const std::int32_t value = anInteger.isDefined() ? static_cast<std::int32_t>(anInteger) : 0;
+
+    this->write(&isDefined, sizeof(isDefined));
+    this->write(&value, sizeof(value));
+}
+
+void Writer::writeReal(const Real& aReal)
+{
+    const double value = aReal.isDefined() ? static_cast<double>(aReal) : std::numeric_limits<double>::quiet_NaN();
+
+    this->write(&value, sizeof(value));
+}
+
+void Writer::writeCharacter(const char aCharacter)
+{
+    this->write(&aCharacter, sizeof(aCharacter));
+}
+
+void Writer::writeString(const String& aString)
+{
+    this->writeSize(aString.getLength());
+    this->write(aString.data(), aString.getLength());
+}
+
+void Writer::writeDate(const Date& aDate)
+{
+    if (!aDate.isDefined())
+    {
+        this->writeInteger(Integer::Undefined());
+        this->writeInteger(Integer::Undefined());
+        this->writeInteger(Integer::Undefined());
+
+        return;
+    }
+
+    this->writeInteger(aDate.getYear());
+    this->writeInteger(aDate.getMonth());
+    this->writeInteger(aDate.getDay());
+}
+
+void Writer::writeColumn(const std::vector<double>& aColumn)
+{
+    this->writeSize(aColumn.size());
+    this->write(aColumn.data(), aColumn.size() * sizeof(double));
+}
+
+const std::string& Writer::accessBuffer() const
+{
+    return buffer_;
+}
+
+void Writer::write(const void* aValuePtr, const std::size_t aByteCount)
+{
+    buffer_.append(static_cast<const char*>(aValuePtr), aByteCount);
+}
+
+Reader::Reader(const std::string_view& aBuffer)
+    : buffer_(aBuffer),
+      position_(0)
+{
+}
+
+bool Reader::isEnd() const
+{
+    return position_ == buffer_.size();
+}
+
+Size Reader::readSize()
+{
+    std::uint64_t size = 0;
+
+    this->read(&size, sizeof(size));
+
+    return static_cast<Size>(size);
+}
+
+Integer Reader::readInteger()
+{
+    std::uint8_t isDefined = 0;
+    std::int32_t value = 0;
+
+    this->read(&isDefined, sizeof(isDefined));
+    this->read(&value, sizeof(value));
+
+    return (isDefined != 0) ? Integer(value) : Integer::Undefined();
+}
+
+Real Reader::readReal()
+{
+    double value = 0.0;
+
+    this->read(&value, sizeof(value));
+
+    return std::isnan(value) ? Real::Undefined() : Real(value);
+}
+
+char Reader::readCharacter()
+{
+    char character = '\0';
+
+    this->read(&character, sizeof(character));
+
+    return character;
+}
+
+String Reader::readString()
+{
+    const Size length = this->readSize();
+
+    if (length > (buffer_.size() - position_))
+    {
+        throw ostk::core::error::RuntimeError("Cache payload is truncated.");
+    }
+
+    const String string = String(std::string(buffer_.substr(position_, length)));
+
+    position_ += length;
+
+    return string;
+}
+
+Date Reader::readDate()
+{
+    const Integer year = this->readInteger();
+    const Integer month = this->readInteger();
+    const Integer day = this->readInteger();
+
+    if ((!year.isDefined()) || (!month.isDefined()) || (!day.isDefined()))
+    {
+        return Date::Undefined();
+    }
+
+    return Date(static_cast<Uint16>(year), static_cast<Uint8>(month), static_cast<Uint8>(day));
+}
+
+void Reader::readColumn(std::vector<double>& aColumn)
+{
+    const Size size = this->readSize();
+
+    if (size > ((buffer_.size() - position_) / sizeof(double)))
+    {
+        throw ostk::core::error::RuntimeError("Cache payload is truncated.");
+    }
+
+    aColumn.resize(size);
+
+    this->read(aColumn.data(), size * sizeof(double));
+}
+
+void Reader::read(void* aValuePtr, const std::size_t aByteCount)
+{
+    if (aByteCount > (buffer_.size() - position_))
+    {
+        throw ostk::core::error::RuntimeError("Cache payload is truncated.");
+    }
+
+    std::memcpy(aValuePtr, buffer_.data() + position_, aByteCount);
+
+    position_ += aByteCount;
+}
+
+File GetFile(const File& aSourceFile)
+{
+    if (!aSourceFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    return File::Path(Path::Parse(aSourceFile.getPath().toString() + ".cache"));
+}
+
+bool Load(
+    const File& aSourceFile,
+    const String& aContentType,
+    const Uint32& aContentVersion,
+    const std::function<void(Reader&)>& aDeserializer
+)
+{
+    const File cacheFile = GetFile(aSourceFile);
+
+    Header expectedHeader;
+
+    if ((!makeHeader(aSourceFile, aContentType, aContentVersion, expectedHeader)) || (!cacheFile.exists()))
+    {
+        return false;
+    }
+
+    try
+    {
+        const MappedFile mappedFile = {cacheFile};
+
+        const std::string_view content = mappedFile.accessContent();
+
+        if (content.size() < sizeof(Header))
+        {
+            return false;
+        }
+
+        Header header;
+
+        std::memcpy(&header, content.data(), sizeof(Header));
+
+        const std::string_view payload = content.substr(sizeof(Header));
+
+        // Everything but the payload fields must match (versions, content type and source stamp)
+
+        expectedHeader.payloadSize = header.payloadSize;
+        expectedHeader.payloadChecksum = header.payloadChecksum;
+
+        if ((std::memcmp(&header, &expectedHeader, sizeof(Header)) != 0) || (payload.size() != header.payloadSize) ||
+            (checksumOf(payload) != header.payloadChecksum))
+        {
+            return false;
+        }
+
+        Reader reader = {payload};
+
+        aDeserializer(reader);
+
+        return reader.isEnd();
+    }
+    catch (const std::exception&)
+    {
+        // An unreadable cache is rebuilt from the source file
+
+        return false;
+    }
+}
+
+bool Save(const File& aSourceFile, const String& aContentType, const Uint32& aContentVersion, const Writer& aWriter)
+{
+    const File cacheFile = GetFile(aSourceFile);
+
+    Header header;
+
+    if (!makeHeader(aSourceFile, aContentType, aContentVersion, header))
+    {
+        return false;
+    }
+
+    const std::string& payload = aWriter.accessBuffer();
+
+    header.payloadSize = static_cast<std::uint64_t>(payload.size());
+    header.payloadChecksum = checksumOf(payload);
+
+    const std::string cachePath = cacheFile.getPath().toString();
+    const std::string temporaryCachePath = cachePath + "." + std::to_string(::getpid()) + "." +
+                                           std::to_string(std::hash<std::thread::id> {}(std::this_thread::get_id())) +
+                                           ".tmp";
+
+    {
+        std::ofstream cacheStream {temporaryCachePath, std::ios::binary | std::ios::trunc};
+
+        if (!cacheStream)
+        {
+            return false;
+        }
+
+        cacheStream.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        cacheStream.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        cacheStream.close();
+
+        if (!cacheStream)
+        {
+            std::remove(temporaryCachePath.c_str());
+
+            return false;
+        }
+    }
+
+    if (std::rename(temporaryCachePath.c_str(), cachePath.c_str()) != 0)
+    {
+        std::remove(temporaryCachePath.c_str());
+
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace cache
+}  // namespace data
+}  // namespace physics
+}  // namespace ostk
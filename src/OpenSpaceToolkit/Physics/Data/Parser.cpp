@@ -0,0 +1,272 @@
+/// Apache License 2.0
+
+#include <charconv>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Data/Parser.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace data
+{
+namespace parser
+{
+
+namespace
+{
+
+bool isWhitespace(const char aCharacter)
+{
+    return (aCharacter == ' ') || (aCharacter == '\t') || (aCharacter == '\r') || (aCharacter == '\n');
+}
+
+}  // namespace
+
+MappedFile::MappedFile(const File& aFile)
+    : data_(nullptr),
+      size_(0)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    const std::string path = aFile.getPath().toString();
+
+    const int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+
+    if (fileDescriptor < 0)
+    {
+        throw ostk::core::error::RuntimeError("Cannot open file [{}].", path);
+    }
+
+    struct stat fileStatus;
+
+    if (::fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        ::close(fileDescriptor);
+
+        throw ostk::core::error::RuntimeError("Cannot get size of file [{}].", path);
+    }
+
+    size_ = static_cast<std::size_t>(fileStatus.st_size);
+
+    // Empty files cannot be mapped
+
+    if (size_ > 0)
+    {
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+        if (mapping == MAP_FAILED)
+        {
+            ::close(fileDescriptor);
+
+            throw ostk::core::error::RuntimeError("Cannot map file [{}].", path);
+        }
+
+        ::madvise(mapping, size_, MADV_SEQUENTIAL);
+
+        data_ = static_cast<const char*>(mapping);
+    }
+
+    // The mapping stays valid once the file descriptor is closed
+
+    ::close(fileDescriptor);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+}
+
+std::string_view MappedFile::accessContent() const
+{
+    return (data_ != nullptr) ? std::string_view(data_, size_) : std::string_view();
+}
+
+LineReader::LineReader(const std::string_view& aBuffer)
+    : buffer_(aBuffer),
+      position_(0)
+{
+}
+
+bool LineReader::readLine(std::string_view& aLine)
+{
+    if (position_ >= buffer_.size())
+    {
+        return false;
+    }
+
+    const std::size_t lineEnd = buffer_.find('\n', position_);
+
+    const std::size_t nextPosition = (lineEnd == std::string_view::npos) ? buffer_.size() : (lineEnd + 1);
+
+    aLine = buffer_.substr(position_, ((lineEnd == std::string_view::npos) ? buffer_.size() : lineEnd) - position_);
+
+    if (!aLine.empty() && (aLine.back() == '\r'))
+    {
+        aLine.remove_suffix(1);
+    }
+
+    position_ = nextPosition;
+
+    return true;
+}
+
+std::string_view trim(const std::string_view& aString)
+{
+    std::size_t start = 0;
+    std::size_t end = aString.size();
+
+    while ((start < end) && isWhitespace(aString[start]))
+    {
+        ++start;
+    }
+
+    while ((end > start) && isWhitespace(aString[end - 1]))
+    {
+        --end;
+    }
+
+    return aString.substr(start, end - start);
+}
+
+std::string_view fixedColumn(
+    const std::string_view& aLine, const Index& aStartColumnNumber, const Index& anEndColumnNumber
+)
+{
+    const std::size_t start = aStartColumnNumber - 1;
+
+    if (start >= aLine.size())
+    {
+        return std::string_view();
+    }
+
+    return trim(aLine.substr(start, anEndColumnNumber - aStartColumnNumber + 1));
+}
+
+Size splitDelimited(
+    const std::string_view& aLine, const char aDelimiter, std::string_view* aFieldArray, const Size aFieldCapacity
+)
+{
+    Size fieldCount = 0;
+    std::size_t fieldStart = 0;
+
+    while (true)
+    {
+        const std::size_t fieldEnd = aLine.find(aDelimiter, fieldStart);
+
+        const std::string_view field = aLine.substr(
+            fieldStart, ((fieldEnd == std::string_view::npos) ? aLine.size() : fieldEnd) - fieldStart
+        );
+
+        if (fieldCount < aFieldCapacity)
+        {
+            aFieldArray[fieldCount] = field;
+        }
+
+        ++fieldCount;
+
+        if (fieldEnd == std::string_view::npos)
+        {
+            break;
+        }
+
+        fieldStart = fieldEnd + 1;
+    }
+
+    return fieldCount;
+}
+
+Size splitWhitespace(const std::string_view& aLine, std::string_view* aWordArray, const Size aWordCapacity)
+{
+    Size wordCount = 0;
+    std::size_t position = 0;
+
+    while (position < aLine.size())
+    {
+        while ((position < aLine.size()) && isWhitespace(aLine[position]))
+        {
+            ++position;
+        }
+
+        if (position >= aLine.size())
+        {
+            break;
+        }
+
+        const std::size_t wordStart = position;
+
+        while ((position < aLine.size()) && !isWhitespace(aLine[position]))
+        {
+            ++position;
+        }
+
+        if (wordCount < aWordCapacity)
+        {
+            aWordArray[wordCount] = aLine.substr(wordStart, position - wordStart);
+        }
+
+        ++wordCount;
+    }
+
+    return wordCount;
+}
+
+bool parseInteger(const std::string_view& aString, int& anInteger)
+{
+    std::string_view string = trim(aString);
+
+    if ((string.size() > 1) && (string.front() == '+'))
+    {
+        string.remove_prefix(1);
+    }
+
+    if (string.empty())
+    {
+        return false;
+    }
+
+    const char* end = string.data() + string.size();
+
+    const std::from_chars_result result = std::from_chars(string.data(), end, anInteger);
+
+    return (result.ec == std::errc()) && (result.ptr == end);
+}
+
+bool parseReal(const std::string_view& aString, double& aReal)
+{
+    std::string_view string = trim(aString);
+
+    if ((string.size() > 1) && (string.front() == '+'))
+    {
+        string.remove_prefix(1);
+    }
+
+    if (string.empty())
+    {
+        return false;
+    }
+
+    const char* end = string.data() + string.size();
+
+    const std::from_chars_result result = std::from_chars(string.data(), end, aReal, std::chars_format::general);
+
+    return (result.ec == std::errc()) && (result.ptr == end);
+}
+
+}  // namespace parser
+}  // namespace data
+}  // namespace physics
+}  // namespace ostk
@@ -1,12 +1,16 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Exponential.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00Grid.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 
 namespace ostk
@@ -18,9 +22,14 @@ namespace environment
 namespace atmospheric
 {
 
+using ostk::core::type::Index;
+
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::environment::atmospheric::earth::Exponential;
+using ostk::physics::environment::atmospheric::earth::HarrisPriester;
 using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00Grid;
 using EarthCelestial = ostk::physics::environment::object::celestial::Earth;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
@@ -47,11 +56,21 @@ class Earth::Impl
 
     virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const = 0;
 
+    virtual VectorXd getDensitiesAt(
+        const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+    ) const;
+
+    Pair<Real, Vector3d> getDensityAndGradientAt(const Position& aPosition, const Instant& anInstant) const;
+
    protected:
     Shared<const Frame> earthFrameSPtr_;
     Length earthRadius_;
     Real earthFlattening_;
 
+    virtual Pair<Real, Vector3d> getDensityAndGradientInEarthFrameAt(
+        const Vector3d& aPosition, const Instant& anInstant
+    ) const;
+
    private:
     Earth::Type type_;
     Earth::InputDataType inputDataType_;
@@ -84,6 +103,85 @@ Earth::InputDataType Earth::Impl::getInputDataType() const
     return inputDataType_;
 }
 
+VectorXd Earth::Impl::getDensitiesAt(
+    const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, [[maybe_unused]] const Size& aThreadCount
+) const
+{
+    if (!aPositionArray.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant array");
+    }
+
+    const PositionArray positionArray = aPositionArray.inMeters().inFrame(earthFrameSPtr_, anInstantArray);
+    const PositionArray::ConstMatrix3XdMap coordinates = positionArray.accessCoordinates();
+
+    VectorXd densities(coordinates.cols());
+
+    for (Index index = 0; index < static_cast<Index>(coordinates.cols()); ++index)
+    {
+        const Instant& instant = (anInstantArray.getSize() == 1) ? anInstantArray.accessFirst() : anInstantArray[index];
+
+        densities(index) =
+            this->getDensityAt(LLA::Cartesian(coordinates.col(index), earthRadius_, earthFlattening_), instant);
+    }
+
+    return densities;
+}
+
+Pair<Real, Vector3d> Earth::Impl::getDensityAndGradientAt(const Position& aPosition, const Instant& anInstant) const
+{
+    if (!aPosition.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Transform transform = aPosition.accessFrame()->getTransformTo(earthFrameSPtr_, anInstant);
+
+    const auto [density, gradient] = this->getDensityAndGradientInEarthFrameAt(
+        transform.applyToPosition(aPosition.inMeters().accessCoordinates()), anInstant
+    );
+
+    return {density, transform.getInverse().applyToVector(gradient)};
+}
+
+Pair<Real, Vector3d> Earth::Impl::getDensityAndGradientInEarthFrameAt(
+    const Vector3d& aPosition, const Instant& anInstant
+) const
+{
+    // Central differences, evaluated in a single batch so that the model inputs are only computed once
+
+    PositionArray::Matrix3Xd coordinates = aPosition.replicate(1, 7);
+
+    for (Index axisIndex = 0; axisIndex < 3; ++axisIndex)
+    {
+        coordinates(axisIndex, 1 + 2 * axisIndex) += Model::gradientStep;
+        coordinates(axisIndex, 2 + 2 * axisIndex) -= Model::gradientStep;
+    }
+
+    const VectorXd densities =
+        this->getDensitiesAt(PositionArray::Meters(coordinates, earthFrameSPtr_), Array<Instant> {anInstant}, 1);
+
+    Vector3d gradient;
+
+    for (Index axisIndex = 0; axisIndex < 3; ++axisIndex)
+    {
+        gradient(axisIndex) =
+            (densities(1 + 2 * axisIndex) - densities(2 + 2 * axisIndex)) / (2.0 * Model::gradientStep);
+    }
+
+    return {densities(0), gradient};
+}
+
 class Earth::ExponentialImpl : public Earth::Impl
 {
    public:
@@ -103,6 +201,11 @@ class Earth::ExponentialImpl : public Earth::Impl
 
     virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const override;
 
+   protected:
+    virtual Pair<Real, Vector3d> getDensityAndGradientInEarthFrameAt(
+        const Vector3d& aPosition, const Instant& anInstant
+    ) const override;
+
    private:
     Exponential exponentialModel_;
 };
@@ -138,6 +241,15 @@ Real Earth::ExponentialImpl::getDensityAt(const Position& aPosition, const Insta
     );
 }
 
+Pair<Real, Vector3d> Earth::ExponentialImpl::getDensityAndGradientInEarthFrameAt(
+    const Vector3d& aPosition, const Instant& anInstant
+) const
+{
+    return this->exponentialModel_.getDensityAndGradientAt(
+        LLA::Cartesian(aPosition, earthRadius_, earthFlattening_), anInstant
+    );
+}
+
 class Earth::NRLMSISE00Impl : public Earth::Impl
 {
    public:
@@ -162,6 +274,10 @@ class Earth::NRLMSISE00Impl : public Earth::Impl
 
     virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const override;
 
+    virtual VectorXd getDensitiesAt(
+        const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+    ) const override;
+
    private:
     NRLMSISE00 NRLMSISE00Model_;
 };
@@ -212,6 +328,133 @@ Real Earth::NRLMSISE00Impl::getDensityAt(const Position& aPosition, const Instan
     );
 }
 
+VectorXd Earth::NRLMSISE00Impl::getDensitiesAt(
+    const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+) const
+{
+    return this->NRLMSISE00Model_.getDensitiesAt(aPositionArray, anInstantArray, aThreadCount);
+}
+
+class Earth::NRLMSISE00GridImpl : public Earth::Impl
+{
+   public:
+    NRLMSISE00GridImpl(
+        const Earth::Type& aType,
+        const Earth::InputDataType& anEarthInputDataType,
+        const NRLMSISE00& aNRLMSISE00Model,
+        const Shared<const Frame>& anEarthFrameSPtr,
+        const Length& anEarthRadius,
+        const Real& anEarthFlattening
+    );
+
+    ~NRLMSISE00GridImpl();
+
+    virtual NRLMSISE00GridImpl* clone() const override;
+
+    virtual Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const override;
+
+    virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const override;
+
+   private:
+    NRLMSISE00Grid NRLMSISE00GridModel_;
+};
+
+Earth::NRLMSISE00GridImpl::NRLMSISE00GridImpl(
+    const Earth::Type& aType,
+    const Earth::InputDataType& anEarthInputDataType,
+    const NRLMSISE00& aNRLMSISE00Model,
+    const Shared<const Frame>& anEarthFrameSPtr,
+    const Length& anEarthRadius,
+    const Real& anEarthFlattening
+)
+    : Earth::Impl(aType, anEarthInputDataType, anEarthFrameSPtr, anEarthRadius, anEarthFlattening),
+      NRLMSISE00GridModel_(aNRLMSISE00Model)
+{
+}
+
+Earth::NRLMSISE00GridImpl::~NRLMSISE00GridImpl() {}
+
+Earth::NRLMSISE00GridImpl* Earth::NRLMSISE00GridImpl::clone() const
+{
+    return new Earth::NRLMSISE00GridImpl(*this);
+}
+
+Real Earth::NRLMSISE00GridImpl::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
+{
+    return this->NRLMSISE00GridModel_.getDensityAt(aLLA, anInstant);
+}
+
+Real Earth::NRLMSISE00GridImpl::getDensityAt(const Position& aPosition, const Instant& anInstant) const
+{
+    return this->NRLMSISE00GridModel_.getDensityAt(
+        LLA::Cartesian(aPosition.inFrame(earthFrameSPtr_, anInstant).getCoordinates(), earthRadius_, earthFlattening_),
+        anInstant
+    );
+}
+
+class Earth::HarrisPriesterImpl : public Earth::Impl
+{
+   public:
+    HarrisPriesterImpl(
+        const Earth::Type& aType,
+        const Earth::InputDataType& anInputDataType,
+        const Shared<const Frame>& anEarthFrameSPtr,
+        const Length& anEarthRadius,
+        const Real& anEarthFlattening,
+        const Shared<Celestial>& aSunCelestialSPtr
+    );
+
+    ~HarrisPriesterImpl();
+
+    virtual HarrisPriesterImpl* clone() const override;
+
+    virtual Real getDensityAt(const LLA& aLLA, const Instant& anInstant) const override;
+
+    virtual Real getDensityAt(const Position& aPosition, const Instant& anInstant) const override;
+
+   private:
+    HarrisPriester harrisPriesterModel_;
+};
+
+Earth::HarrisPriesterImpl::HarrisPriesterImpl(
+    const Earth::Type& aType,
+    const Earth::InputDataType& anInputDataType,
+    const Shared<const Frame>& anEarthFrameSPtr,
+    const Length& anEarthRadius,
+    const Real& anEarthFlattening,
+    const Shared<Celestial>& aSunCelestialSPtr
+)
+    : Earth::Impl(aType, anInputDataType, anEarthFrameSPtr, anEarthRadius, anEarthFlattening),
+      harrisPriesterModel_(
+          4,  // Cosine power suited to intermediate inclinations
+          anEarthFrameSPtr,
+          anEarthRadius,
+          anEarthFlattening,
+          aSunCelestialSPtr
+      )
+{
+}
+
+Earth::HarrisPriesterImpl::~HarrisPriesterImpl() {}
+
+Earth::HarrisPriesterImpl* Earth::HarrisPriesterImpl::clone() const
+{
+    return new Earth::HarrisPriesterImpl(*this);
+}
+
+Real Earth::HarrisPriesterImpl::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
+{
+    return this->harrisPriesterModel_.getDensityAt(aLLA, anInstant);
+}
+
+Real Earth::HarrisPriesterImpl::getDensityAt(const Position& aPosition, const Instant& anInstant) const
+{
+    return this->harrisPriesterModel_.getDensityAt(
+        LLA::Cartesian(aPosition.inFrame(earthFrameSPtr_, anInstant).getCoordinates(), earthRadius_, earthFlattening_),
+        anInstant
+    );
+}
+
 Earth::Earth(
     const Earth::Type& aType,
     const Earth::InputDataType& anInputDataType,
@@ -316,6 +559,30 @@ Real Earth::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
     return implUPtr_->getDensityAt(aLLA, anInstant);
 }
 
+Pair<Real, Vector3d> Earth::getDensityAndGradientAt(const Position& aPosition, const Instant& anInstant) const
+{
+    return implUPtr_->getDensityAndGradientAt(aPosition, anInstant);
+}
+
+VectorXd Earth::getDensitiesAt(
+    const PositionArray& aPositionArray, const Instant& anInstant, const Size& aThreadCount
+) const
+{
+    return this->getDensitiesAt(aPositionArray, Array<Instant> {anInstant}, aThreadCount);
+}
+
+VectorXd Earth::getDensitiesAt(
+    const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+) const
+{
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    return implUPtr_->getDensitiesAt(aPositionArray, anInstantArray, aThreadCount);
+}
+
 Unique<Earth::Impl> Earth::ImplFromType(
     const Earth::Type& aType,
     const Earth::InputDataType& anInputDataType,
@@ -338,23 +605,20 @@ Unique<Earth::Impl> Earth::ImplFromType(
             aType, anInputDataType, anEarthFrameSPtr, anEarthRadius, anEarthFlattening
         );
     }
-    else if (aType == Earth::Type::NRLMSISE00)
+    else if (aType == Earth::Type::HarrisPriester)
     {
+        return std::make_unique<HarrisPriesterImpl>(
+            aType, anInputDataType, anEarthFrameSPtr, anEarthRadius, anEarthFlattening, aSunCelestialSPtr
+        );
+    }
+    else if ((aType == Earth::Type::NRLMSISE00) || (aType == Earth::Type::NRLMSISE00Grid))
+    {
+        NRLMSISE00::InputDataType NRLMSISE00InputDataType = NRLMSISE00::InputDataType::CSSISpaceWeatherFile;
+
         if (anInputDataType == Earth::InputDataType::Undefined ||
             anInputDataType == Earth::InputDataType::CSSISpaceWeatherFile)
         {
-            return std::make_unique<NRLMSISE00Impl>(
-                aType,
-                anInputDataType,
-                NRLMSISE00::InputDataType::CSSISpaceWeatherFile,
-                aF107ConstantValue,
-                aF107AConstantValue,
-                aKpConstantValue,
-                anEarthFrameSPtr,
-                anEarthRadius,
-                anEarthFlattening,
-                aSunCelestialSPtr
-            );
+            NRLMSISE00InputDataType = NRLMSISE00::InputDataType::CSSISpaceWeatherFile;
         }
         else if (anInputDataType == Earth::InputDataType::ConstantFluxAndGeoMag)
         {
@@ -371,19 +635,46 @@ Unique<Earth::Impl> Earth::ImplFromType(
                 throw ostk::core::error::runtime::Undefined("Kp constant value");
             }
 
-            return std::make_unique<NRLMSISE00Impl>(
+            NRLMSISE00InputDataType = NRLMSISE00::InputDataType::ConstantFluxAndGeoMag;
+        }
+        else
+        {
+            throw ostk::core::error::runtime::Wrong("Type");
+        }
+
+        if (aType == Earth::Type::NRLMSISE00Grid)
+        {
+            return std::make_unique<NRLMSISE00GridImpl>(
                 aType,
                 anInputDataType,
-                NRLMSISE00::InputDataType::ConstantFluxAndGeoMag,
-                aF107ConstantValue,
-                aF107AConstantValue,
-                aKpConstantValue,
+                NRLMSISE00(
+                    NRLMSISE00InputDataType,
+                    aF107ConstantValue,
+                    aF107AConstantValue,
+                    aKpConstantValue,
+                    anEarthFrameSPtr,
+                    anEarthRadius,
+                    anEarthFlattening,
+                    aSunCelestialSPtr
+                ),
                 anEarthFrameSPtr,
                 anEarthRadius,
-                anEarthFlattening,
-                aSunCelestialSPtr
+                anEarthFlattening
             );
         }
+
+        return std::make_unique<NRLMSISE00Impl>(
+            aType,
+            anInputDataType,
+            NRLMSISE00InputDataType,
+            aF107ConstantValue,
+            aF107AConstantValue,
+            aKpConstantValue,
+            anEarthFrameSPtr,
+            anEarthRadius,
+            anEarthFlattening,
+            aSunCelestialSPtr
+        );
     }
 
     throw ostk::core::error::runtime::Wrong("Type");
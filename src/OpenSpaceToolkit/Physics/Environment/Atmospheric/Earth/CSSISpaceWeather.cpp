@@ -1,19 +1,22 @@
 /// Apache License 2.0
 
-#include <fstream>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <sstream>
+#include <string>
+#include <string_view>
 
-#include <boost/algorithm/string/trim.hpp>
-#include <boost/lexical_cast.hpp>
-
-#include <OpenSpaceToolkit/Core/Container/Object.hpp>
-#include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Physics/Data/Cache.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Parser.hpp>
 #include <OpenSpaceToolkit/Physics/Data/Utility.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
 
@@ -28,13 +31,12 @@ namespace atmospheric
 namespace earth
 {
 
-using ostk::core::container::Object;
-using ostk::core::container::Table;
 using ostk::core::type::Index;
 using ostk::core::type::Real;
 using ostk::core::type::Size;
 using ostk::core::type::String;
 using ostk::core::type::Uint16;
+using ostk::core::type::Uint32;
 using ostk::core::type::Uint8;
 using ostk::core::utils::Print;
 
@@ -44,6 +46,151 @@ using ostk::physics::time::Time;
 
 using ostk::physics::data::utilities::getFileModifiedInstant;
 
+namespace cache = ostk::physics::data::cache;
+namespace parser = ostk::physics::data::parser;
+
+using parser::LineReader;
+using parser::MappedFile;
+
+namespace
+{
+
+// To be incremented whenever the cached content layout changes
+constexpr Uint32 cacheContentVersion = 1;
+
+constexpr Size apSlotsPerDay = 8;
+
+constexpr Size fieldCount = 5;
+
+constexpr Index undefinedIndex = std::numeric_limits<Index>::max();
+
+bool isFieldDefined(const CSSISpaceWeather::Reading& aReading, const CSSISpaceWeather::Field& aField)
+{
+    switch (aField)
+    {
+        case CSSISpaceWeather::Field::Kp3Hour:
+            return aReading.Kp1.isDefined() && aReading.Kp2.isDefined() && aReading.Kp3.isDefined() &&
+                   aReading.Kp4.isDefined() && aReading.Kp5.isDefined() && aReading.Kp6.isDefined() &&
+                   aReading.Kp7.isDefined() && aReading.Kp8.isDefined();
+
+        case CSSISpaceWeather::Field::Ap3Hour:
+            return aReading.Ap1.isDefined() && aReading.Ap2.isDefined() && aReading.Ap3.isDefined() &&
+                   aReading.Ap4.isDefined() && aReading.Ap5.isDefined() && aReading.Ap6.isDefined() &&
+                   aReading.Ap7.isDefined() && aReading.Ap8.isDefined();
+
+        case CSSISpaceWeather::Field::ApDaily:
+            return aReading.ApAvg.isDefined();
+
+        case CSSISpaceWeather::Field::F107Obs:
+            return aReading.F107Obs.isDefined();
+
+        case CSSISpaceWeather::Field::F107ObsCenter81:
+            return aReading.F107ObsCenter81.isDefined();
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Field");
+    }
+}
+
+// Modified Julian Day of a proleptic Gregorian calendar date (days from civil, offset from 1970-01-01)
+std::int64_t modifiedJulianDayOf(const std::int64_t aYear, const std::int64_t aMonth, const std::int64_t aDay)
+{
+    const std::int64_t year = aYear - ((aMonth <= 2) ? 1 : 0);
+    const std::int64_t era = ((year >= 0) ? year : (year - 399)) / 400;
+    const std::int64_t yearOfEra = year - era * 400;
+    const std::int64_t dayOfYear = (153 * (aMonth + ((aMonth > 2) ? -3 : 9)) + 2) / 5 + aDay - 1;
+    const std::int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * 146097 + dayOfEra - 719468 + 40587;
+}
+
+std::int64_t modifiedJulianDayOf(const Date& aDate)
+{
+    return modifiedJulianDayOf(aDate.getYear(), aDate.getMonth(), aDate.getDay());
+}
+
+// Number of months since year 0
+std::int64_t monthNumberOf(const Date& aDate)
+{
+    return static_cast<std::int64_t>(aDate.getYear()) * 12 + aDate.getMonth() - 1;
+}
+
+void writeReadings(
+    cache::Writer& aWriter,
+    const std::vector<CSSISpaceWeather::Reading>& aReadings,
+    const Index aFirstReadingIndex,
+    const Index anEndReadingIndex
+)
+{
+    aWriter.writeSize(anEndReadingIndex - aFirstReadingIndex);
+
+    for (Index readingIndex = aFirstReadingIndex; readingIndex < anEndReadingIndex; ++readingIndex)
+    {
+        const CSSISpaceWeather::Reading& reading = aReadings[readingIndex];
+
+        aWriter.writeInteger(Integer(static_cast<int>(modifiedJulianDayOf(reading.date))));
+
+        aWriter.writeDate(reading.date);
+        aWriter.writeInteger(reading.BSRN);
+        aWriter.writeInteger(reading.ND);
+        aWriter.writeInteger(reading.Kp1);
+        aWriter.writeInteger(reading.Kp2);
+        aWriter.writeInteger(reading.Kp3);
+        aWriter.writeInteger(reading.Kp4);
+        aWriter.writeInteger(reading.Kp5);
+        aWriter.writeInteger(reading.Kp6);
+        aWriter.writeInteger(reading.Kp7);
+        aWriter.writeInteger(reading.Kp8);
+        aWriter.writeInteger(reading.KpSum);
+        aWriter.writeInteger(reading.Ap1);
+        aWriter.writeInteger(reading.Ap2);
+        aWriter.writeInteger(reading.Ap3);
+        aWriter.writeInteger(reading.Ap4);
+        aWriter.writeInteger(reading.Ap5);
+        aWriter.writeInteger(reading.Ap6);
+        aWriter.writeInteger(reading.Ap7);
+        aWriter.writeInteger(reading.Ap8);
+        aWriter.writeInteger(reading.ApAvg);
+        aWriter.writeReal(reading.Cp);
+        aWriter.writeInteger(reading.C9);
+        aWriter.writeInteger(reading.ISN);
+        aWriter.writeReal(reading.F107Obs);
+        aWriter.writeReal(reading.F107Adj);
+        aWriter.writeString(reading.F107DataType);
+        aWriter.writeReal(reading.F107ObsCenter81);
+        aWriter.writeReal(reading.F107ObsLast81);
+        aWriter.writeReal(reading.F107AdjCenter81);
+        aWriter.writeReal(reading.F107AdjLast81);
+    }
+}
+
+void readReadings(cache::Reader& aReader, Map<Integer, CSSISpaceWeather::Reading>& aReadingMap)
+{
+    const Size readingCount = aReader.readSize();
+
+    for (Index readingIndex = 0; readingIndex < readingCount; ++readingIndex)
+    {
+        const Integer mjd = aReader.readInteger();
+
+        // Braced initializers are evaluated in order
+
+        const CSSISpaceWeather::Reading reading = {
+            aReader.readDate(),    aReader.readInteger(), aReader.readInteger(), aReader.readInteger(),
+            aReader.readInteger(), aReader.readInteger(), aReader.readInteger(), aReader.readInteger(),
+            aReader.readInteger(), aReader.readInteger(), aReader.readInteger(), aReader.readInteger(),
+            aReader.readInteger(), aReader.readInteger(), aReader.readInteger(), aReader.readInteger(),
+            aReader.readInteger(), aReader.readInteger(), aReader.readInteger(), aReader.readInteger(),
+            aReader.readInteger(), aReader.readReal(),    aReader.readInteger(), aReader.readInteger(),
+            aReader.readReal(),    aReader.readReal(),    aReader.readString(),  aReader.readReal(),
+            aReader.readReal(),    aReader.readReal(),    aReader.readReal(),
+        };
+
+        aReadingMap.insert({mjd, reading});
+    }
+}
+
+}  // namespace
+
 std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& aCSSISpaceWeather)
 {
     Print::Header(anOutputStream, "CSSI Space Weather");
@@ -69,9 +216,13 @@ std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& a
 
     Print::Separator(anOutputStream, "Observations");
     Print::Line(anOutputStream) << dataHeader;
-    for (const auto& observationIt : aCSSISpaceWeather.observations_)
+    const Index dailyPredictionStartIndex = aCSSISpaceWeather.observationCount_;
+    const Index monthlyPredictionStartIndex =
+        aCSSISpaceWeather.observationCount_ + aCSSISpaceWeather.dailyPredictionCount_;
+
+    for (Index readingIndex = 0; readingIndex < dailyPredictionStartIndex; ++readingIndex)
     {
-        const CSSISpaceWeather::Reading& observation = observationIt.second;
+        const CSSISpaceWeather::Reading& observation = aCSSISpaceWeather.readings_[readingIndex];
 
         Print::Line(anOutputStream) << String::Format(
             "{:04}-{:02}-{:02}  {:>4d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>4d} "
@@ -116,9 +267,9 @@ std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& a
     Print::Separator(anOutputStream, "Daily Predictions");
     Print::Line(anOutputStream) << dataHeader;
 
-    for (const auto& dailyPredictionIt : aCSSISpaceWeather.dailyPredictions_)
+    for (Index readingIndex = dailyPredictionStartIndex; readingIndex < monthlyPredictionStartIndex; ++readingIndex)
     {
-        const CSSISpaceWeather::Reading& dailyPrediction = dailyPredictionIt.second;
+        const CSSISpaceWeather::Reading& dailyPrediction = aCSSISpaceWeather.readings_[readingIndex];
 
         Print::Line(anOutputStream) << String::Format(
             "{:04}-{:02}-{:02}  {:>4d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>2d}  {:>4d} "
@@ -166,9 +317,10 @@ std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& a
         "F10.7AdjLast81"
     );
 
-    for (const auto& monthlyPredictionIt : aCSSISpaceWeather.monthlyPredictions_)
+    for (Index readingIndex = monthlyPredictionStartIndex; readingIndex < aCSSISpaceWeather.readings_.size();
+         ++readingIndex)
     {
-        const CSSISpaceWeather::Reading& monthlyPrediction = monthlyPredictionIt.second;
+        const CSSISpaceWeather::Reading& monthlyPrediction = aCSSISpaceWeather.readings_[readingIndex];
 
         Print::Line(anOutputStream) << String::Format(
             "{:04}-{:02}-{:02}  {:>4d}  {:>2d}  {:>4d}  {:6.2f}  {:6.2f}  {:s}  {:6.2f}  {:6.2f}  {:6.2f}  {:6.2f}",
@@ -195,8 +347,9 @@ std::ostream& operator<<(std::ostream& anOutputStream, const CSSISpaceWeather& a
 
 bool CSSISpaceWeather::isDefined() const
 {
-    return observationInterval_.isDefined() && (!observations_.empty()) && dailyPredictionInterval_.isDefined() &&
-           (!dailyPredictions_.empty()) && monthlyPredictionInterval_.isDefined() && (!monthlyPredictions_.empty());
+    return observationInterval_.isDefined() && (observationCount_ > 0) && dailyPredictionInterval_.isDefined() &&
+           (dailyPredictionCount_ > 0) && monthlyPredictionInterval_.isDefined() &&
+           (readings_.size() > (observationCount_ + dailyPredictionCount_));
 }
 
 const Date& CSSISpaceWeather::accessLastObservationDate() const
@@ -251,17 +404,13 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessObservationAt(const Ins
         );
     }
 
-    // Construct the MJD by only using the date component of the Instant, because an Instant just before
-    // the end of the observationInterval (within some nanoseconds) can have an MJD in the next day
-    // due to floating-point rounding error.
-    const Date date = anInstant.getDateTime(Scale::UTC).getDate();
-    const Integer mjd = DateTime(date, Time::Midnight()).getModifiedJulianDate().floor();
+    // Observations take precedence over predictions in the daily tables
 
-    const auto observationIt = observations_.find(mjd);
+    const Index timelineIndex = this->findTimelineIndexAt(anInstant);
 
-    if (observationIt != observations_.end())
+    if ((timelineIndex != undefinedIndex) && (timelineReadingIndices_[timelineIndex] < observationCount_))
     {
-        return observationIt->second;
+        return readings_[timelineReadingIndices_[timelineIndex]];
     }
 
     throw ostk::core::error::RuntimeError("Cannot find observation at [{}].", anInstant.toString(Scale::UTC));
@@ -299,17 +448,16 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessDailyPredictionAt(const
         );
     }
 
-    // Construct the MJD by only using the date component of the Instant, because an Instant just before
-    // the end of the dailyPredictionInterval (within some nanoseconds) can have an MJD in the next day
-    // due to floating-point rounding error.
-    const Date date = anInstant.getDateTime(Scale::UTC).getDate();
-    const Integer mjd = DateTime(date, Time::Midnight()).getModifiedJulianDate().floor();
-
-    const auto predictionIt = dailyPredictions_.find(mjd);
+    const Index timelineIndex = this->findTimelineIndexAt(anInstant);
 
-    if (predictionIt != dailyPredictions_.end())
+    if (timelineIndex != undefinedIndex)
     {
-        return predictionIt->second;
+        const Index readingIndex = timelineReadingIndices_[timelineIndex];
+
+        if ((readingIndex >= observationCount_) && (readingIndex < (observationCount_ + dailyPredictionCount_)))
+        {
+            return readings_[readingIndex];
+        }
     }
 
     throw ostk::core::error::RuntimeError("Cannot find daily prediction at [{}].", anInstant.toString(Scale::UTC));
@@ -347,18 +495,13 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessMonthlyPredictionAt(con
         );
     }
 
-    const Date date = anInstant.getDateTime(Scale::UTC).getDate();
-
-    const Integer year = date.getYear();
-    const Integer month = date.getMonth();
-
-    const Real monthMjd = DateTime(year, month, 1).getModifiedJulianDate();
+    const std::int64_t monthIndex =
+        monthNumberOf(anInstant.getDateTime(Scale::UTC).getDate()) - static_cast<int>(monthTableStart_);
 
-    const auto predictionIt = monthlyPredictions_.find(monthMjd.floor());
-
-    if (predictionIt != monthlyPredictions_.end())
+    if ((monthIndex >= 0) && (monthIndex < static_cast<std::int64_t>(monthReadingIndices_.size())) &&
+        (monthReadingIndices_[monthIndex] != undefinedIndex))
     {
-        return predictionIt->second;
+        return readings_[monthReadingIndices_[monthIndex]];
     }
 
     throw ostk::core::error::RuntimeError("Cannot find monthly prediction at [{}].", anInstant.toString(Scale::UTC));
@@ -366,17 +509,9 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessMonthlyPredictionAt(con
 
 const CSSISpaceWeather::Reading& CSSISpaceWeather::accessReadingAt(const Instant& anInstant) const
 {
-    if (observationInterval_.contains(anInstant))
-    {
-        return this->accessObservationAt(anInstant);
-    }
-    if (dailyPredictionInterval_.contains(anInstant))
+    if (this->isCovering(anInstant))
     {
-        return this->accessDailyPredictionAt(anInstant);
-    }
-    if (monthlyPredictionInterval_.contains(anInstant))
-    {
-        return this->accessMonthlyPredictionAt(anInstant);
+        return readings_[timelineReadingIndices_[this->getTimelineIndexAt(anInstant)]];
     }
 
     throw ostk::core::error::RuntimeError(
@@ -401,52 +536,137 @@ const CSSISpaceWeather::Reading& CSSISpaceWeather::accessLastReadingWhere(
         throw ostk::core::error::runtime::Undefined("CSSI Space Weather");
     }
 
-    Instant searchInstant = anInstant - Duration::Days(1);
+    const Instant searchInstant = anInstant - Duration::Days(1);
 
-    // Search monthly data backwards, skips if not relevant
-    while (monthlyPredictionInterval_.contains(searchInstant) && searchInstant > dailyPredictionInterval_.accessEnd())
+    if (this->isCovering(searchInstant))
     {
-        const CSSISpaceWeather::Reading& reading = this->accessMonthlyPredictionAt(searchInstant);
+        // Search readings backwards, up to the first missing day
 
-        if (aPredicate(reading))
+        for (Index timelineIndex = this->getTimelineIndexAt(searchInstant); timelineIndex != undefinedIndex;
+             timelineIndex = previousTimelineIndices_[timelineIndex])
         {
-            return reading;
+            const CSSISpaceWeather::Reading& reading = readings_[timelineReadingIndices_[timelineIndex]];
+
+            if (aPredicate(reading))
+            {
+                return reading;
+            }
         }
+    }
+
+    throw ostk::core::error::RuntimeError(
+        "Failed to extrapolate CSSI Space Weather Data to [{}].", anInstant.toString(Scale::UTC)
+    );
+}
+
+const CSSISpaceWeather::Reading& CSSISpaceWeather::accessLastReadingWithDefined(
+    const Field& aField, const Instant& anInstant
+) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
 
-        // Go back in time by approximately 1 month at a time, but not past the last daily prediction
-        searchInstant =
-            std::max(searchInstant - Duration::Days(30), dailyPredictionInterval_.accessEnd() - Duration::Days(1));
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("CSSI Space Weather");
     }
 
-    // Search daily predicton data backwards, skips if not relevant
-    while (dailyPredictionInterval_.contains(searchInstant))
+    const Instant searchInstant = anInstant - Duration::Days(1);
+
+    if (this->isCovering(searchInstant))
     {
-        const CSSISpaceWeather::Reading& reading = this->accessDailyPredictionAt(searchInstant);
+        const Index timelineIndex = lastDefinedTimelineIndices_
+            [this->getTimelineIndexAt(searchInstant) * fieldCount + static_cast<Index>(aField)];
 
-        if (aPredicate(reading))
+        if (timelineIndex != undefinedIndex)
         {
-            return reading;
+            return readings_[timelineReadingIndices_[timelineIndex]];
         }
+    }
+
+    throw ostk::core::error::RuntimeError(
+        "Failed to extrapolate CSSI Space Weather Data to [{}].", anInstant.toString(Scale::UTC)
+    );
+}
 
-        searchInstant -= Duration::Days(1);
+CSSISpaceWeather::NRLMSISE00Input CSSISpaceWeather::getNRLMSISE00InputAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    // Search observation data backwards, skips if not relevant
-    while (observationInterval_.contains(searchInstant))
+    if (!this->isDefined())
     {
-        const CSSISpaceWeather::Reading& reading = this->accessObservationAt(searchInstant);
+        throw ostk::core::error::runtime::Undefined("CSSI Space Weather");
+    }
+
+    const DateTime dateTime = anInstant.getDateTime(Scale::UTC);
+    const Date date = dateTime.getDate();
 
-        if (aPredicate(reading))
+    const std::int64_t dayIndex =
+        modifiedJulianDayOf(date.getYear(), date.getMonth(), date.getDay()) - static_cast<int>(tableStartMjd_);
+    const std::int64_t slotIndex =
+        dayIndex * static_cast<std::int64_t>(apSlotsPerDay) + (dateTime.getTime().getHour() / 3);
+
+    // The oldest slot is 57 hours (19 slots) before the instant, the F10.7 flux is taken from the previous day
+
+    if ((slotIndex < 19) || (dayIndex < 1) || (dayIndex >= static_cast<std::int64_t>(apDaily_.size())))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] out of range [{} - {}].",
+            anInstant.toString(Scale::UTC),
+            observationInterval_.accessStart().toString(Scale::UTC),
+            monthlyPredictionInterval_.accessEnd().toString(Scale::UTC)
+        );
+    }
+
+    const auto averageOf = [this](const std::int64_t aFirstSlotIndex) -> double
+    {
+        double sum = 0.0;
+
+        for (std::int64_t slotOffset = 0; slotOffset < static_cast<std::int64_t>(apSlotsPerDay); ++slotOffset)
         {
-            return reading;
+            sum += ap3Hour_[aFirstSlotIndex + slotOffset];
         }
 
-        searchInstant -= Duration::Days(1);
+        return sum / static_cast<double>(apSlotsPerDay);
+    };
+
+    const NRLMSISE00Input input = {
+        {
+            apDaily_[dayIndex],
+            ap3Hour_[slotIndex],
+            ap3Hour_[slotIndex - 1],
+            ap3Hour_[slotIndex - 2],
+            ap3Hour_[slotIndex - 3],
+            averageOf(slotIndex - 11),
+            averageOf(slotIndex - 19),
+        },
+        f107_[dayIndex - 1],
+        f107Center81_[dayIndex],
+    };
+
+    const bool isUndefined = std::any_of(
+                                 std::begin(input.ap),
+                                 std::end(input.ap),
+                                 [](const double aValue)
+                                 {
+                                     return std::isnan(aValue);
+                                 }
+                             ) ||
+                             std::isnan(input.f107) || std::isnan(input.f107Average);
+
+    if (isUndefined)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Failed to extrapolate CSSI Space Weather Data to [{}].", anInstant.toString(Scale::UTC)
+        );
     }
 
-    throw ostk::core::error::RuntimeError(
-        "Failed to extrapolate CSSI Space Weather Data to [{}].", anInstant.toString(Scale::UTC)
-    );
+    return input;
 }
 
 CSSISpaceWeather CSSISpaceWeather::Undefined()
@@ -469,54 +689,99 @@ CSSISpaceWeather CSSISpaceWeather::Load(const File& aFile)
     CSSISpaceWeather spaceWeather;
     spaceWeather.lastModifiedTimestamp_ = getFileModifiedInstant(aFile);
 
-    Table spaceWeatherTable = Table::Load(aFile, Table::Format::CSV, true);
+    Map<Integer, CSSISpaceWeather::Reading> observations;
+    Map<Integer, CSSISpaceWeather::Reading> dailyPredictions;
+    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictions;
+
+    const MappedFile mappedFile = {aFile};
+
+    LineReader lineReader = {mappedFile.accessContent()};
 
     // Helper functions to parse optional Integer/Real cells
-    const auto parseOptionalIntegerCell = [](const Object& obj) -> Integer
+    const auto parseOptionalIntegerCell = [](const std::string_view& aCell) -> Integer
     {
-        if (!obj.isDefined())
+        const std::string_view cell = parser::trim(aCell);
+
+        if (cell.empty())
             return Integer::Undefined();
 
-        if (obj.isInteger())
-            return obj.getInteger();
+        int integerValue = 0;
 
-        if (!obj.isString())
-            return Integer::Undefined();
+        if (parser::parseInteger(cell, integerValue))
+            return integerValue;
 
-        if (obj.getString().trim().empty())
+        // Non-integer numbers are not integer cells
+
+        double realValue = 0.0;
+
+        if (parser::parseReal(cell, realValue))
             return Integer::Undefined();
 
-        return Integer::Parse(obj.getString().trim());
+        throw ostk::core::error::RuntimeError("Cannot parse integer [{}].", std::string(cell));
     };
 
-    const auto parseOptionalRealCell = [](const Object& obj) -> Real
+    const auto parseOptionalRealCell = [](const std::string_view& aCell) -> Real
     {
-        if (!obj.isDefined())
+        const std::string_view cell = parser::trim(aCell);
+
+        if (cell.empty())
             return Real::Undefined();
 
-        if (obj.isReal())
-            return obj.getReal();
+        double realValue = 0.0;
 
-        if (obj.isInteger())
-            return Real::Integer(obj.getInteger());
+        if (parser::parseReal(cell, realValue))
+            return realValue;
 
-        if (!obj.isString())
-            return Real::Undefined();
+        throw ostk::core::error::RuntimeError("Cannot parse real [{}].", std::string(cell));
+    };
 
-        if (obj.getString().trim().empty())
-            return Real::Undefined();
+    // Dates are in the standard format (YYYY-MM-DD)
+    const auto parseDateCell = [](const std::string_view& aCell) -> Date
+    {
+        std::string_view dateParts[3];
+
+        int year = 0;
+        int month = 0;
+        int day = 0;
+
+        if ((parser::splitDelimited(parser::trim(aCell), '-', dateParts, 3) != 3) ||
+            (!parser::parseInteger(dateParts[0], year)) || (!parser::parseInteger(dateParts[1], month)) ||
+            (!parser::parseInteger(dateParts[2], day)))
+        {
+            throw ostk::core::error::RuntimeError("Cannot parse date [{}].", std::string(aCell));
+        }
 
-        return Real::Parse(obj.getString().trim());
+        return Date(static_cast<Uint16>(year), static_cast<Uint8>(month), static_cast<Uint8>(day));
     };
 
-    for (const auto& row : spaceWeatherTable)
+    static constexpr Size columnCount = 31;
+
+    std::string_view line;
+    std::string_view row[columnCount];
+
+    // Skip header
+    lineReader.readLine(line);
+
+    while (lineReader.readLine(line))
     {
-        if (row.isEmpty() || !row[0].isDefined())
+        if (parser::trim(line).empty())
+        {
+            continue;
+        }
+
+        const Size cellCount = parser::splitDelimited(line, ',', row, columnCount);
+
+        if (parser::trim(row[0]).empty())
         {
             continue;
         }
 
-        const Date date = Date::Parse(row[0].getString(), Date::Format::Standard);
+        if (cellCount < columnCount)
+        {
+            throw ostk::core::error::RuntimeError("CSSISpaceWeather failed to parse line: {}", std::string(line));
+        }
+
+        const Date date = parseDateCell(row[0]);
 
         // [TBR] Toss data past 2030 due to this restriction in the Instant class
         if (date.getYear() > 2030)
@@ -551,7 +816,7 @@ CSSISpaceWeather CSSISpaceWeather::Load(const File& aFile)
         const Integer ISN = parseOptionalIntegerCell(row[23]);
         const Real F107Obs = parseOptionalRealCell(row[24]);
         const Real F107Adj = parseOptionalRealCell(row[25]);
-        const String F107DataType = row[26].getString();
+        const String F107DataType = String(std::string(parser::trim(row[26])));
         const Real F107ObsCenter81 = parseOptionalRealCell(row[27]);
         const Real F107ObsLast81 = parseOptionalRealCell(row[28]);
         const Real F107AdjCenter81 = parseOptionalRealCell(row[29]);
@@ -593,7 +858,7 @@ CSSISpaceWeather CSSISpaceWeather::Load(const File& aFile)
 
         if (F107DataType == "OBS" || F107DataType == "INT")
         {
-            spaceWeather.observations_.insert({mjd, reading});
+            observations.insert({mjd, reading});
         }
         else if (F107DataType == "PRD" || (F107DataType == "PRM" && date.getDay() != 1))
         {
@@ -601,46 +866,19 @@ CSSISpaceWeather CSSISpaceWeather::Load(const File& aFile)
             // Upstream feeds occasionally emit a PRM row on a non-1st date to fill the gap between
             // the last observation and the first daily prediction; treat those as daily predictions
             // so the monthly-lookup invariant (keyed by 1st-of-month) holds.
-            spaceWeather.dailyPredictions_.insert({mjd, reading});
+            dailyPredictions.insert({mjd, reading});
         }
         else
         {
-            spaceWeather.monthlyPredictions_.insert({mjd, reading});
+            monthlyPredictions.insert({mjd, reading});
         }
     }
 
-    if (!spaceWeather.observations_.empty())
-    {
-        spaceWeather.lastObservationDate_ = spaceWeather.observations_.rbegin()->second.date;
-
-        const Instant observationStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.begin()->first), Scale::UTC);
-
-        // End at the end of the day
-        const Instant observationEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.rbegin()->first), Scale::UTC) +
-            Duration::Days(1);
-
-        spaceWeather.observationInterval_ =
-            Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
-    }
-
-    if (!spaceWeather.dailyPredictions_.empty())
+    if (!dailyPredictions.empty())
     {
-        const Instant dailyPredictionStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.begin()->first), Scale::UTC);
-
-        // End at the end of the day
-        const Instant dailyPredictionEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.rbegin()->first), Scale::UTC) +
-            Duration::Days(1);
-
-        spaceWeather.dailyPredictionInterval_ =
-            Interval(dailyPredictionStartInstant, dailyPredictionEndInstant, Interval::Type::HalfOpenRight);
-
         // Use the last daily prediction to make an artificial first monthly prediction
         // so that the data Intervals overlap
-        const CSSISpaceWeather::Reading& lastDailyPrediction = spaceWeather.dailyPredictions_.rbegin()->second;
+        const CSSISpaceWeather::Reading& lastDailyPrediction = dailyPredictions.rbegin()->second;
 
         Date monthBeginningDate = lastDailyPrediction.date;
         monthBeginningDate.setDay(1);
@@ -650,22 +888,74 @@ CSSISpaceWeather CSSISpaceWeather::Load(const File& aFile)
         overlapMonthlyReading.F107DataType = "PRM";
 
         const Integer monthMjd = DateTime(monthBeginningDate, Time::Midnight()).getModifiedJulianDate().floor();
-        spaceWeather.monthlyPredictions_.insert({monthMjd, overlapMonthlyReading});
+        monthlyPredictions.insert({monthMjd, overlapMonthlyReading});
     }
 
-    if (!spaceWeather.monthlyPredictions_.empty())
+    spaceWeather.setReadings(observations, dailyPredictions, monthlyPredictions);
+
+    spaceWeather.setIntervals();
+
+    spaceWeather.setDailyTables();
+
+    return spaceWeather;
+}
+
+CSSISpaceWeather CSSISpaceWeather::LoadCached(const File& aFile)
+{
+    if (!aFile.isDefined())
     {
-        const Instant monthlyPredictionStartInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.monthlyPredictions_.begin()->first), Scale::UTC);
+        throw ostk::core::error::runtime::Undefined("File");
+    }
 
-        // End at the end of the day
-        const Instant monthlyPredictionEndInstant =
-            Instant::ModifiedJulianDate(Real::Integer(spaceWeather.monthlyPredictions_.rbegin()->first), Scale::UTC);
+    if (!aFile.exists())
+    {
+        throw ostk::core::error::RuntimeError("File [{}] does not exist.", aFile.toString());
+    }
+
+    Map<Integer, CSSISpaceWeather::Reading> observations;
+    Map<Integer, CSSISpaceWeather::Reading> dailyPredictions;
+    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictions;
+
+    const bool isCacheLoaded = cache::Load(
+        aFile,
+        "CSSISpaceWeather",
+        cacheContentVersion,
+        [&observations, &dailyPredictions, &monthlyPredictions](cache::Reader& aReader) -> void
+        {
+            readReadings(aReader, observations);
+            readReadings(aReader, dailyPredictions);
+            readReadings(aReader, monthlyPredictions);
+        }
+    );
+
+    if (!isCacheLoaded)
+    {
+        const CSSISpaceWeather spaceWeather = CSSISpaceWeather::Load(aFile);
 
-        spaceWeather.monthlyPredictionInterval_ =
-            Interval::Closed(monthlyPredictionStartInstant, monthlyPredictionEndInstant);
+        const Index dailyPredictionStartIndex = spaceWeather.observationCount_;
+        const Index monthlyPredictionStartIndex = spaceWeather.observationCount_ + spaceWeather.dailyPredictionCount_;
+
+        cache::Writer writer;
+
+        writeReadings(writer, spaceWeather.readings_, 0, dailyPredictionStartIndex);
+        writeReadings(writer, spaceWeather.readings_, dailyPredictionStartIndex, monthlyPredictionStartIndex);
+        writeReadings(writer, spaceWeather.readings_, monthlyPredictionStartIndex, spaceWeather.readings_.size());
+
+        cache::Save(aFile, "CSSISpaceWeather", cacheContentVersion, writer);
+
+        return spaceWeather;
     }
 
+    CSSISpaceWeather spaceWeather;
+
+    spaceWeather.lastModifiedTimestamp_ = getFileModifiedInstant(aFile);
+
+    spaceWeather.setReadings(observations, dailyPredictions, monthlyPredictions);
+
+    spaceWeather.setIntervals();
+
+    spaceWeather.setDailyTables();
+
     return spaceWeather;
 }
 
@@ -695,79 +985,88 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
 
     spaceWeather.lastModifiedTimestamp_ = getFileModifiedInstant(aFile);
 
-    std::ifstream fileStream {aFile.getPath().toString()};
+    Map<Integer, CSSISpaceWeather::Reading> observations;
+    Map<Integer, CSSISpaceWeather::Reading> dailyPredictions;
+    Map<Integer, CSSISpaceWeather::Reading> monthlyPredictions;
+
+    const MappedFile mappedFile = {aFile};
+
+    LineReader lineReader = {mappedFile.accessContent()};
 
     bool readingObserved = false;
     bool readingDailyPredicted = false;
     bool readingMonthlyPredicted = false;
 
-    String line;
-
-    auto split_spaces = [](std::string s) -> Array<String>
+    const auto parseInteger = [](const std::string_view& aWord) -> Integer
     {
-        Array<String> results;
-        const String delimiter = " ";
+        int value = 0;
 
-        size_t last = 0;
-        size_t next = 0;
-        while ((next = s.find(delimiter, last)) != std::string::npos)
+        if (!parser::parseInteger(aWord, value))
         {
-            // account for multiple consecutive delimiters
-            String token = s.substr(last, next - last);
-            if (token != delimiter)
-            {
-                results.add(token);
-            }
-            last = next + 1;
+            throw ostk::core::error::RuntimeError("Cannot parse integer [{}].", std::string(aWord));
         }
-        results.add(s.substr(last));
-        return results;
+
+        return value;
     };
 
-    while (std::getline(fileStream, line))
+    const auto parseReal = [](const std::string_view& aWord) -> Real
     {
-        Array<String> lineParts = split_spaces(line);
+        double value = 0.0;
+
+        if (!parser::parseReal(aWord, value))
+        {
+            throw ostk::core::error::RuntimeError("Cannot parse real [{}].", std::string(aWord));
+        }
+
+        return value;
+    };
+
+    static constexpr Size wordCapacity = 33;
 
-        // TBI: this is hacky, removes any whitespace strings
-        lineParts.remove({"", " ", "  ", "   "});
+    std::string_view line;
+    std::string_view lineParts[wordCapacity];
 
-        if (lineParts.empty())
+    while (lineReader.readLine(line))
+    {
+        const Size linePartCount = parser::splitWhitespace(line, lineParts, wordCapacity);
+
+        if (linePartCount == 0)
         {
             continue;
         }
 
         // Intepret BEGIN tags
-        if (lineParts.getSize() >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "OBSERVED")
+        if (linePartCount >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "OBSERVED")
         {
             readingObserved = true;
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "DAILY_PREDICTED")
+        if (linePartCount >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "DAILY_PREDICTED")
         {
             readingDailyPredicted = true;
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "MONTHLY_PREDICTED")
+        if (linePartCount >= 2 && lineParts[0] == "BEGIN" && lineParts[1] == "MONTHLY_PREDICTED")
         {
             readingMonthlyPredicted = true;
             continue;
         }
 
         // Intepret END tags
-        if (lineParts.getSize() >= 2 && lineParts[0] == "END" && lineParts[1] == "OBSERVED")
+        if (linePartCount >= 2 && lineParts[0] == "END" && lineParts[1] == "OBSERVED")
         {
             readingObserved = false;
 
-            spaceWeather.lastObservationDate_ = spaceWeather.observations_.rbegin()->second.date;
+            spaceWeather.lastObservationDate_ = observations.rbegin()->second.date;
 
             const Instant observationStartInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.begin()->first), Scale::UTC);
+                Instant::ModifiedJulianDate(Real::Integer(observations.begin()->first), Scale::UTC);
 
             // End at the end of the day
             const Instant observationEndInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.observations_.rbegin()->first), Scale::UTC) +
+                Instant::ModifiedJulianDate(Real::Integer(observations.rbegin()->first), Scale::UTC) +
                 Duration::Days(1);
 
             spaceWeather.observationInterval_ =
@@ -776,16 +1075,16 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "END" && lineParts[1] == "DAILY_PREDICTED")
+        if (linePartCount >= 2 && lineParts[0] == "END" && lineParts[1] == "DAILY_PREDICTED")
         {
             readingDailyPredicted = false;
 
             const Instant dailyPredictionStartInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.begin()->first), Scale::UTC);
+                Instant::ModifiedJulianDate(Real::Integer(dailyPredictions.begin()->first), Scale::UTC);
 
             // End at the end of the day
             const Instant dailyPredictionEndInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.dailyPredictions_.rbegin()->first), Scale::UTC) +
+                Instant::ModifiedJulianDate(Real::Integer(dailyPredictions.rbegin()->first), Scale::UTC) +
                 Duration::Days(1);
 
             spaceWeather.dailyPredictionInterval_ =
@@ -793,7 +1092,7 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
 
             // Use the last daily prediction to make an artificial first monthly prediction
             // so that the data Intervals overlap
-            const CSSISpaceWeather::Reading& lastDailyPrediction = spaceWeather.dailyPredictions_.rbegin()->second;
+            const CSSISpaceWeather::Reading& lastDailyPrediction = dailyPredictions.rbegin()->second;
 
             Date monthBeginningDate = lastDailyPrediction.date;
             monthBeginningDate.setDay(1);
@@ -803,21 +1102,20 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
             overlapMonthlyReading.F107DataType = "PRM";
 
             const Integer monthMjd = DateTime(monthBeginningDate, Time::Midnight()).getModifiedJulianDate().floor();
-            spaceWeather.monthlyPredictions_.insert({monthMjd, overlapMonthlyReading});
+            monthlyPredictions.insert({monthMjd, overlapMonthlyReading});
 
             continue;
         }
 
-        if (lineParts.getSize() >= 2 && lineParts[0] == "END" && lineParts[1] == "MONTHLY_PREDICTED")
+        if (linePartCount >= 2 && lineParts[0] == "END" && lineParts[1] == "MONTHLY_PREDICTED")
         {
             readingMonthlyPredicted = false;
 
             const Instant monthlyPredictionStartInstant =
-                Instant::ModifiedJulianDate(Real::Integer(spaceWeather.monthlyPredictions_.begin()->first), Scale::UTC);
+                Instant::ModifiedJulianDate(Real::Integer(monthlyPredictions.begin()->first), Scale::UTC);
 
-            const Instant monthlyPredictionEndInstant = Instant::ModifiedJulianDate(
-                Real::Integer(spaceWeather.monthlyPredictions_.rbegin()->first), Scale::UTC
-            );
+            const Instant monthlyPredictionEndInstant =
+                Instant::ModifiedJulianDate(Real::Integer(monthlyPredictions.rbegin()->first), Scale::UTC);
 
             spaceWeather.monthlyPredictionInterval_ =
                 Interval::Closed(monthlyPredictionStartInstant, monthlyPredictionEndInstant);
@@ -827,40 +1125,45 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
         {
             try
             {
-                Integer DATE_YEAR = boost::lexical_cast<int>(lineParts[0]);
-                Integer DATE_MONT = boost::lexical_cast<int>(lineParts[1]);
-                Integer DATE_DAY = boost::lexical_cast<int>(lineParts[2]);
-                Integer BSRN = boost::lexical_cast<int>(lineParts[3]);
-                Integer ND = boost::lexical_cast<int>(lineParts[4]);
-                Integer Kp1 = boost::lexical_cast<int>(lineParts[5]);
-                Integer Kp2 = boost::lexical_cast<int>(lineParts[6]);
-                Integer Kp3 = boost::lexical_cast<int>(lineParts[7]);
-                Integer Kp4 = boost::lexical_cast<int>(lineParts[8]);
-                Integer Kp5 = boost::lexical_cast<int>(lineParts[9]);
-                Integer Kp6 = boost::lexical_cast<int>(lineParts[10]);
-                Integer Kp7 = boost::lexical_cast<int>(lineParts[11]);
-                Integer Kp8 = boost::lexical_cast<int>(lineParts[12]);
-                Integer KpSum = boost::lexical_cast<int>(lineParts[13]);
-                Integer Ap1 = boost::lexical_cast<int>(lineParts[14]);
-                Integer Ap2 = boost::lexical_cast<int>(lineParts[15]);
-                Integer Ap3 = boost::lexical_cast<int>(lineParts[16]);
-                Integer Ap4 = boost::lexical_cast<int>(lineParts[17]);
-                Integer Ap5 = boost::lexical_cast<int>(lineParts[18]);
-                Integer Ap6 = boost::lexical_cast<int>(lineParts[19]);
-                Integer Ap7 = boost::lexical_cast<int>(lineParts[20]);
-                Integer Ap8 = boost::lexical_cast<int>(lineParts[21]);
-                Integer ApAvg = boost::lexical_cast<int>(lineParts[22]);
-                Real Cp = boost::lexical_cast<double>(lineParts[23]);
-                Integer C9 = boost::lexical_cast<int>(lineParts[24]);
-                Integer ISN = boost::lexical_cast<int>(lineParts[25]);
-                Real F107Adj = boost::lexical_cast<double>(lineParts[26]);
-                // Real Q = boost::lexical_cast<double>(lineParts[27]); // This isn't in the CSV format, so let's ignore
+                if (linePartCount < wordCapacity)
+                {
+                    throw ostk::core::error::RuntimeError("Missing columns.");
+                }
+
+                Integer DATE_YEAR = parseInteger(lineParts[0]);
+                Integer DATE_MONT = parseInteger(lineParts[1]);
+                Integer DATE_DAY = parseInteger(lineParts[2]);
+                Integer BSRN = parseInteger(lineParts[3]);
+                Integer ND = parseInteger(lineParts[4]);
+                Integer Kp1 = parseInteger(lineParts[5]);
+                Integer Kp2 = parseInteger(lineParts[6]);
+                Integer Kp3 = parseInteger(lineParts[7]);
+                Integer Kp4 = parseInteger(lineParts[8]);
+                Integer Kp5 = parseInteger(lineParts[9]);
+                Integer Kp6 = parseInteger(lineParts[10]);
+                Integer Kp7 = parseInteger(lineParts[11]);
+                Integer Kp8 = parseInteger(lineParts[12]);
+                Integer KpSum = parseInteger(lineParts[13]);
+                Integer Ap1 = parseInteger(lineParts[14]);
+                Integer Ap2 = parseInteger(lineParts[15]);
+                Integer Ap3 = parseInteger(lineParts[16]);
+                Integer Ap4 = parseInteger(lineParts[17]);
+                Integer Ap5 = parseInteger(lineParts[18]);
+                Integer Ap6 = parseInteger(lineParts[19]);
+                Integer Ap7 = parseInteger(lineParts[20]);
+                Integer Ap8 = parseInteger(lineParts[21]);
+                Integer ApAvg = parseInteger(lineParts[22]);
+                Real Cp = parseReal(lineParts[23]);
+                Integer C9 = parseInteger(lineParts[24]);
+                Integer ISN = parseInteger(lineParts[25]);
+                Real F107Adj = parseReal(lineParts[26]);
+                // Real Q = parseReal(lineParts[27]); // This isn't in the CSV format, so let's ignore
                 // it
-                Real F107AdjCenter81 = boost::lexical_cast<double>(lineParts[28]);
-                Real F107AdjLast81 = boost::lexical_cast<double>(lineParts[29]);
-                Real F107Obs = boost::lexical_cast<double>(lineParts[30]);
-                Real F107ObsCenter81 = boost::lexical_cast<double>(lineParts[31]);
-                Real F107ObsLast81 = boost::lexical_cast<double>(lineParts[32]);
+                Real F107AdjCenter81 = parseReal(lineParts[28]);
+                Real F107AdjLast81 = parseReal(lineParts[29]);
+                Real F107Obs = parseReal(lineParts[30]);
+                Real F107ObsCenter81 = parseReal(lineParts[31]);
+                Real F107ObsLast81 = parseReal(lineParts[32]);
 
                 Date date = Date(DATE_YEAR, DATE_MONT, DATE_DAY);
 
@@ -923,26 +1226,30 @@ CSSISpaceWeather CSSISpaceWeather::LoadLegacy(const File& aFile)
 
                 if (readingObserved)
                 {
-                    spaceWeather.observations_.insert({mjd, reading});
+                    observations.insert({mjd, reading});
                 }
                 else if (readingDailyPredicted)
                 {
-                    spaceWeather.dailyPredictions_.insert({mjd, reading});
+                    dailyPredictions.insert({mjd, reading});
                 }
                 else if (readingMonthlyPredicted)
                 {
-                    spaceWeather.monthlyPredictions_.insert({mjd, reading});
+                    monthlyPredictions.insert({mjd, reading});
                 }
 
                 continue;
             }
             catch (...)
             {
-                throw ostk::core::error::RuntimeError("CSSISpaceWeather failed to parse line: {}", line);
+                throw ostk::core::error::RuntimeError("CSSISpaceWeather failed to parse line: {}", std::string(line));
             }
         }
     }
 
+    spaceWeather.setReadings(observations, dailyPredictions, monthlyPredictions);
+
+    spaceWeather.setDailyTables();
+
     return spaceWeather;
 }
 
@@ -950,14 +1257,373 @@ CSSISpaceWeather::CSSISpaceWeather()
     : lastObservationDate_(Date::Undefined()),
       lastModifiedTimestamp_(Instant::Undefined()),
       observationInterval_(Interval::Undefined()),
-      observations_(Map<Integer, CSSISpaceWeather::Reading>()),
-
       dailyPredictionInterval_(Interval::Undefined()),
-      dailyPredictions_(Map<Integer, CSSISpaceWeather::Reading>()),
-
       monthlyPredictionInterval_(Interval::Undefined()),
-      monthlyPredictions_(Map<Integer, CSSISpaceWeather::Reading>())
+      readings_(),
+      observationCount_(0),
+      dailyPredictionCount_(0),
+      timelineReadingIndices_(),
+      previousTimelineIndices_(),
+      lastDefinedTimelineIndices_(),
+      tableStartMjd_(Integer::Undefined()),
+      dayTimelineIndices_(),
+      ap3Hour_(),
+      apDaily_(),
+      f107_(),
+      f107Center81_(),
+      monthTableStart_(Integer::Undefined()),
+      monthReadingIndices_()
+{
+}
+
+bool CSSISpaceWeather::isCovering(const Instant& anInstant) const
+{
+    return observationInterval_.contains(anInstant) || dailyPredictionInterval_.contains(anInstant) ||
+           monthlyPredictionInterval_.contains(anInstant);
+}
+
+Index CSSISpaceWeather::findTimelineIndexAt(const Instant& anInstant) const
+{
+    // Only use the date component of the Instant, as an Instant just before the end of a day (within some
+    // nanoseconds) can have an MJD in the next day due to floating-point rounding error.
+    const Date date = anInstant.getDateTime(Scale::UTC).getDate();
+
+    const std::int64_t dayIndex = modifiedJulianDayOf(date) - static_cast<int>(tableStartMjd_);
+
+    if ((dayIndex >= 0) && (dayIndex < static_cast<std::int64_t>(dayTimelineIndices_.size())))
+    {
+        return dayTimelineIndices_[dayIndex];
+    }
+
+    return undefinedIndex;
+}
+
+Index CSSISpaceWeather::getTimelineIndexAt(const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("CSSI Space Weather");
+    }
+
+    const Index timelineIndex = this->findTimelineIndexAt(anInstant);
+
+    if (timelineIndex != undefinedIndex)
+    {
+        return timelineIndex;
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot find reading at [{}].", anInstant.toString(Scale::UTC));
+}
+
+void CSSISpaceWeather::setReadings(
+    const Map<Integer, Reading>& anObservationMap,
+    const Map<Integer, Reading>& aDailyPredictionMap,
+    const Map<Integer, Reading>& aMonthlyPredictionMap
+)
+{
+    readings_.clear();
+    readings_.reserve(anObservationMap.size() + aDailyPredictionMap.size() + aMonthlyPredictionMap.size());
+
+    for (const Map<Integer, Reading>* readingMapPtr : {&anObservationMap, &aDailyPredictionMap, &aMonthlyPredictionMap})
+    {
+        for (const auto& readingIt : *readingMapPtr)
+        {
+            readings_.push_back(readingIt.second);
+        }
+    }
+
+    observationCount_ = anObservationMap.size();
+    dailyPredictionCount_ = aDailyPredictionMap.size();
+
+    monthReadingIndices_.clear();
+
+    if (aMonthlyPredictionMap.empty())
+    {
+        monthTableStart_ = Integer::Undefined();
+
+        return;
+    }
+
+    // Monthly predictions are looked up by the first day of their month
+
+    const Index monthlyPredictionStartIndex = observationCount_ + dailyPredictionCount_;
+
+    const std::int64_t firstMonthNumber = monthNumberOf(readings_[monthlyPredictionStartIndex].date);
+    const std::int64_t lastMonthNumber = monthNumberOf(readings_.back().date);
+
+    monthTableStart_ = Integer(static_cast<int>(firstMonthNumber));
+    monthReadingIndices_.assign(static_cast<Size>(lastMonthNumber - firstMonthNumber) + 1, undefinedIndex);
+
+    for (Index readingIndex = monthlyPredictionStartIndex; readingIndex < readings_.size(); ++readingIndex)
+    {
+        const Date& date = readings_[readingIndex].date;
+
+        if (date.getDay() == 1)
+        {
+            monthReadingIndices_[monthNumberOf(date) - firstMonthNumber] = readingIndex;
+        }
+    }
+}
+
+void CSSISpaceWeather::setIntervals()
 {
+    const auto modifiedJulianDateOf = [this](const Index aReadingIndex) -> Instant
+    {
+        return Instant::ModifiedJulianDate(
+            Real::Integer(static_cast<int>(modifiedJulianDayOf(readings_[aReadingIndex].date))), Scale::UTC
+        );
+    };
+
+    const Index dailyPredictionStartIndex = observationCount_;
+    const Index monthlyPredictionStartIndex = observationCount_ + dailyPredictionCount_;
+
+    if (observationCount_ > 0)
+    {
+        lastObservationDate_ = readings_[dailyPredictionStartIndex - 1].date;
+
+        const Instant observationStartInstant = modifiedJulianDateOf(0);
+
+        // End at the end of the day
+        const Instant observationEndInstant = modifiedJulianDateOf(dailyPredictionStartIndex - 1) + Duration::Days(1);
+
+        observationInterval_ = Interval(observationStartInstant, observationEndInstant, Interval::Type::HalfOpenRight);
+    }
+
+    if (dailyPredictionCount_ > 0)
+    {
+        const Instant dailyPredictionStartInstant = modifiedJulianDateOf(dailyPredictionStartIndex);
+
+        // End at the end of the day
+        const Instant dailyPredictionEndInstant =
+            modifiedJulianDateOf(monthlyPredictionStartIndex - 1) + Duration::Days(1);
+
+        dailyPredictionInterval_ =
+            Interval(dailyPredictionStartInstant, dailyPredictionEndInstant, Interval::Type::HalfOpenRight);
+    }
+
+    if (readings_.size() > monthlyPredictionStartIndex)
+    {
+        const Instant monthlyPredictionStartInstant = modifiedJulianDateOf(monthlyPredictionStartIndex);
+
+        const Instant monthlyPredictionEndInstant = modifiedJulianDateOf(readings_.size() - 1);
+
+        monthlyPredictionInterval_ = Interval::Closed(monthlyPredictionStartInstant, monthlyPredictionEndInstant);
+    }
+}
+
+void CSSISpaceWeather::setDailyTables()
+{
+    timelineReadingIndices_.clear();
+    previousTimelineIndices_.clear();
+    lastDefinedTimelineIndices_.clear();
+    dayTimelineIndices_.clear();
+    ap3Hour_.clear();
+    apDaily_.clear();
+    f107_.clear();
+    f107Center81_.clear();
+
+    if (!this->isDefined())
+    {
+        tableStartMjd_ = Integer::Undefined();
+
+        return;
+    }
+
+    // Each day is resolved to a reading (observations, then daily predictions, then monthly predictions), and each
+    // field to the last reading that defines it, from which undefined values are carried over in the value tables.
+    // Days without a reading (gaps in the file) are left undefined, and cannot be extrapolated across.
+
+    const Index dailyPredictionStartIndex = observationCount_;
+    const Index monthlyPredictionStartIndex = observationCount_ + dailyPredictionCount_;
+    const Index readingCount = readings_.size();
+
+    const auto mjdOf = [this](const Index aReadingIndex) -> std::int64_t
+    {
+        return modifiedJulianDayOf(readings_[aReadingIndex].date);
+    };
+
+    const std::int64_t firstObservationMjd = mjdOf(0);
+    const std::int64_t lastObservationMjd = mjdOf(dailyPredictionStartIndex - 1);
+    const std::int64_t firstDailyPredictionMjd = mjdOf(dailyPredictionStartIndex);
+    const std::int64_t lastDailyPredictionMjd = mjdOf(monthlyPredictionStartIndex - 1);
+    const std::int64_t lastMonthlyPredictionMjd = mjdOf(readingCount - 1);
+
+    const std::int64_t firstMjd = firstObservationMjd;
+    const std::int64_t lastMjd = std::max({lastObservationMjd, lastDailyPredictionMjd, lastMonthlyPredictionMjd});
+
+    const double undefinedValue = std::numeric_limits<double>::quiet_NaN();
+
+    const Size dayCount = static_cast<Size>(lastMjd - firstMjd) + 1;
+
+    tableStartMjd_ = Integer(static_cast<int>(firstMjd));
+    dayTimelineIndices_.assign(dayCount, undefinedIndex);
+    ap3Hour_.assign(dayCount * apSlotsPerDay, undefinedValue);
+    apDaily_.assign(dayCount, undefinedValue);
+    f107_.assign(dayCount, undefinedValue);
+    f107Center81_.assign(dayCount, undefinedValue);
+
+    std::vector<Index> dayReadingIndices(dayCount, undefinedIndex);
+
+    const auto setDayReadingIndices =
+        [&](const std::int64_t aFirstMjd, const std::int64_t aLastMjd, const Index aReadingIndex) -> void
+    {
+        for (std::int64_t mjd = std::max(aFirstMjd, firstMjd); mjd <= std::min(aLastMjd, lastMjd); ++mjd)
+        {
+            dayReadingIndices[mjd - firstMjd] = aReadingIndex;
+        }
+    };
+
+    // A monthly prediction applies from its day to the end of its month, up to the next monthly prediction and up to
+    // the last one
+
+    for (Index readingIndex = monthlyPredictionStartIndex; readingIndex < readingCount; ++readingIndex)
+    {
+        const Date& monthDate = readings_[readingIndex].date;
+
+        const std::int64_t nextMonthMjd = (monthDate.getMonth() == 12)
+                                              ? modifiedJulianDayOf(monthDate.getYear() + 1, 1, 1)
+                                              : modifiedJulianDayOf(monthDate.getYear(), monthDate.getMonth() + 1, 1);
+        const std::int64_t nextReadingMjd =
+            ((readingIndex + 1) < readingCount) ? mjdOf(readingIndex + 1) : (lastMonthlyPredictionMjd + 1);
+
+        setDayReadingIndices(mjdOf(readingIndex), std::min(nextMonthMjd, nextReadingMjd) - 1, readingIndex);
+    }
+
+    // Daily predictions, then observations, take precedence over their whole range, including missing days
+
+    setDayReadingIndices(firstDailyPredictionMjd, lastDailyPredictionMjd, undefinedIndex);
+
+    for (Index readingIndex = dailyPredictionStartIndex; readingIndex < monthlyPredictionStartIndex; ++readingIndex)
+    {
+        setDayReadingIndices(mjdOf(readingIndex), mjdOf(readingIndex), readingIndex);
+    }
+
+    setDayReadingIndices(firstObservationMjd, lastObservationMjd, undefinedIndex);
+
+    for (Index readingIndex = 0; readingIndex < dailyPredictionStartIndex; ++readingIndex)
+    {
+        setDayReadingIndices(mjdOf(readingIndex), mjdOf(readingIndex), readingIndex);
+    }
+
+    // The monthly prediction overlapping the daily predictions is a copy of the last daily prediction: searching
+    // backwards from later months goes straight to the latter
+
+    Index overlapReadingIndex = undefinedIndex;
+
+    for (Index readingIndex = monthlyPredictionStartIndex;
+         (readingIndex < readingCount) && (mjdOf(readingIndex) <= lastDailyPredictionMjd);
+         ++readingIndex)
+    {
+        overlapReadingIndex = readingIndex;
+    }
+
+    Index previousReadingIndex = undefinedIndex;
+
+    for (Index dayIndex = 0; dayIndex < dayCount; ++dayIndex)
+    {
+        const Index readingIndex = dayReadingIndices[dayIndex];
+
+        if (readingIndex == undefinedIndex)
+        {
+            previousReadingIndex = undefinedIndex;
+
+            continue;
+        }
+
+        // Consecutive days of a monthly prediction share the same timeline entry
+
+        if (readingIndex != previousReadingIndex)
+        {
+            const Index timelineIndex = timelineReadingIndices_.size();
+
+            Index previousTimelineIndex =
+                (previousReadingIndex != undefinedIndex) ? (timelineIndex - 1) : undefinedIndex;
+
+            if ((previousReadingIndex != undefinedIndex) && (previousReadingIndex == overlapReadingIndex))
+            {
+                previousTimelineIndex = previousTimelineIndices_[previousTimelineIndex];
+            }
+
+            timelineReadingIndices_.push_back(readingIndex);
+            previousTimelineIndices_.push_back(previousTimelineIndex);
+
+            for (Index fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex)
+            {
+                if (isFieldDefined(readings_[readingIndex], static_cast<CSSISpaceWeather::Field>(fieldIndex)))
+                {
+                    lastDefinedTimelineIndices_.push_back(timelineIndex);
+                }
+                else if (previousTimelineIndex != undefinedIndex)
+                {
+                    lastDefinedTimelineIndices_.push_back(
+                        lastDefinedTimelineIndices_[previousTimelineIndex * fieldCount + fieldIndex]
+                    );
+                }
+                else
+                {
+                    lastDefinedTimelineIndices_.push_back(undefinedIndex);
+                }
+            }
+
+            previousReadingIndex = readingIndex;
+        }
+
+        const Index timelineIndex = timelineReadingIndices_.size() - 1;
+
+        dayTimelineIndices_[dayIndex] = timelineIndex;
+
+        const auto lastReadingWithDefined = [&, this](const CSSISpaceWeather::Field& aField
+                                            ) -> const CSSISpaceWeather::Reading*
+        {
+            const Index lastTimelineIndex =
+                lastDefinedTimelineIndices_[timelineIndex * fieldCount + static_cast<Index>(aField)];
+
+            return (lastTimelineIndex != undefinedIndex) ? &readings_[timelineReadingIndices_[lastTimelineIndex]]
+                                                         : nullptr;
+        };
+
+        // The 8 3-hour indices of a day are only used together
+
+        if (const CSSISpaceWeather::Reading* apReadingPtr = lastReadingWithDefined(CSSISpaceWeather::Field::Ap3Hour))
+        {
+            const Integer ap3Hour[apSlotsPerDay] = {
+                apReadingPtr->Ap1,
+                apReadingPtr->Ap2,
+                apReadingPtr->Ap3,
+                apReadingPtr->Ap4,
+                apReadingPtr->Ap5,
+                apReadingPtr->Ap6,
+                apReadingPtr->Ap7,
+                apReadingPtr->Ap8,
+            };
+
+            std::transform(
+                std::begin(ap3Hour),
+                std::end(ap3Hour),
+                ap3Hour_.begin() + dayIndex * apSlotsPerDay,
+                [](const Integer& anAp)
+                {
+                    return static_cast<double>(anAp);
+                }
+            );
+        }
+
+        if (const CSSISpaceWeather::Reading* apReadingPtr = lastReadingWithDefined(CSSISpaceWeather::Field::ApDaily))
+        {
+            apDaily_[dayIndex] = static_cast<double>(apReadingPtr->ApAvg);
+        }
+
+        if (const CSSISpaceWeather::Reading* f107ReadingPtr = lastReadingWithDefined(CSSISpaceWeather::Field::F107Obs))
+        {
+            f107_[dayIndex] = static_cast<double>(f107ReadingPtr->F107Obs);
+        }
+
+        if (const CSSISpaceWeather::Reading* f107ReadingPtr =
+                lastReadingWithDefined(CSSISpaceWeather::Field::F107ObsCenter81))
+        {
+            f107Center81_[dayIndex] = static_cast<double>(f107ReadingPtr->F107ObsCenter81);
+        }
+    }
 }
 
 }  // namespace earth
@@ -51,6 +51,26 @@ Real Exponential::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
     return rho;
 }
 
+Pair<Real, Vector3d> Exponential::getDensityAndGradientAt(const LLA& aLLA, const Instant& anInstant) const
+{
+    const double density = this->getDensityAt(aLLA, anInstant);
+
+    const double H_0 = std::get<2>(Exponential::DensityBandValues(aLLA.getAltitude()));
+
+    const double latitude_rad = aLLA.getLatitude().inRadians();
+    const double longitude_rad = aLLA.getLongitude().inRadians();
+
+    const Vector3d verticalDirection(
+        std::cos(latitude_rad) * std::cos(longitude_rad),
+        std::cos(latitude_rad) * std::sin(longitude_rad),
+        std::sin(latitude_rad)
+    );
+
+    // d(rho)/dh = -rho / H_0, with H_0 in [km]
+
+    return {density, -(density / (H_0 * 1000.0)) * verticalDirection};
+}
+
 Tuple<Real, Real, Real> Exponential::DensityBandValues(const Length& anAltitude)
 {
     // Reference values defined in Fundamentals of Astrodynamics and Applications by Vallado p. 534
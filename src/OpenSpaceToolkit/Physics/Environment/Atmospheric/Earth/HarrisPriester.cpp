@@ -0,0 +1,212 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace atmospheric
+{
+namespace earth
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::String;
+
+using ostk::physics::time::Scale;
+using ostk::physics::time::Time;
+
+namespace
+{
+
+// Mean solar activity densities, from Montenbruck & Gill, Satellite Orbits, Table 3.8
+
+constexpr std::size_t bandCount = 50;
+
+// [km]
+constexpr std::array<double, bandCount> heights = {
+    100.0, 120.0, 130.0, 140.0, 150.0, 160.0, 170.0, 180.0, 190.0, 200.0, 210.0, 220.0, 230.0,
+    240.0, 250.0, 260.0, 270.0, 280.0, 290.0, 300.0, 320.0, 340.0, 360.0, 380.0, 400.0, 420.0,
+    440.0, 460.0, 480.0, 500.0, 520.0, 540.0, 560.0, 580.0, 600.0, 620.0, 640.0, 660.0, 680.0,
+    700.0, 720.0, 740.0, 760.0, 780.0, 800.0, 840.0, 880.0, 920.0, 960.0, 1000.0
+};
+
+// [kg/m^3]
+constexpr std::array<double, bandCount> minimumDensities = {
+    4.974e-07, 2.490e-08, 8.377e-09, 3.899e-09, 2.122e-09, 1.263e-09, 8.008e-10, 5.283e-10, 3.617e-10, 2.557e-10,
+    1.839e-10, 1.341e-10, 9.949e-11, 7.488e-11, 5.709e-11, 4.403e-11, 3.430e-11, 2.697e-11, 2.139e-11, 1.708e-11,
+    1.099e-11, 7.214e-12, 4.824e-12, 3.274e-12, 2.249e-12, 1.558e-12, 1.091e-12, 7.701e-13, 5.474e-13, 3.916e-13,
+    2.819e-13, 2.042e-13, 1.488e-13, 1.092e-13, 8.070e-14, 6.012e-14, 4.519e-14, 3.430e-14, 2.632e-14, 2.043e-14,
+    1.607e-14, 1.281e-14, 1.036e-14, 8.496e-15, 7.069e-15, 4.680e-15, 3.200e-15, 2.210e-15, 1.560e-15, 1.150e-15
+};
+
+// [kg/m^3]
+constexpr std::array<double, bandCount> maximumDensities = {
+    4.974e-07, 2.490e-08, 8.710e-09, 4.059e-09, 2.215e-09, 1.344e-09, 8.758e-10, 6.010e-10, 4.297e-10, 3.162e-10,
+    2.396e-10, 1.853e-10, 1.455e-10, 1.157e-10, 9.308e-11, 7.555e-11, 6.182e-11, 5.095e-11, 4.226e-11, 3.526e-11,
+    2.511e-11, 1.819e-11, 1.337e-11, 9.955e-12, 7.492e-12, 5.684e-12, 4.355e-12, 3.362e-12, 2.612e-12, 2.042e-12,
+    1.605e-12, 1.267e-12, 1.005e-12, 7.997e-13, 6.390e-13, 5.123e-13, 4.121e-13, 3.325e-13, 2.691e-13, 2.185e-13,
+    1.779e-13, 1.452e-13, 1.190e-13, 9.776e-14, 8.059e-14, 5.741e-14, 4.210e-14, 3.130e-14, 2.360e-14, 1.810e-14
+};
+
+constexpr double bulgeLag = 30.0 * M_PI / 180.0;  // [rad]
+
+// Exponential interpolation between two tabulated densities
+
+double InterpolateDensity(
+    const double& anAltitude, const Index& aBandIndex, const std::array<double, bandCount>& aDensityTable
+)
+{
+    const double scaleHeight = (heights[aBandIndex] - heights[aBandIndex + 1]) /
+                               std::log(aDensityTable[aBandIndex + 1] / aDensityTable[aBandIndex]);
+
+    return aDensityTable[aBandIndex] * std::exp((heights[aBandIndex] - anAltitude) / scaleHeight);
+}
+
+}  // namespace
+
+HarrisPriester::HarrisPriester(
+    const Integer& aCosinePower,
+    const Shared<const Frame>& anEarthFrameSPtr,
+    const Length& anEarthRadius,
+    const Real& anEarthFlattening,
+    const Shared<Celestial>& aSunCelestialSPtr
+)
+    : cosinePower_(aCosinePower),
+      earthFrameSPtr_(anEarthFrameSPtr),
+      earthRadius_(anEarthRadius),
+      earthFlattening_(anEarthFlattening),
+      sunCelestialSPtr_(aSunCelestialSPtr)
+{
+    if (!aCosinePower.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cosine power");
+    }
+
+    if ((aCosinePower < 2) || (aCosinePower > 6))
+    {
+        throw ostk::core::error::RuntimeError("Cosine power [{}] is not in [2, 6].", aCosinePower.toString());
+    }
+
+    if ((anEarthFrameSPtr == nullptr) || (!anEarthFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Earth frame");
+    }
+}
+
+HarrisPriester* HarrisPriester::clone() const
+{
+    return new HarrisPriester(*this);
+}
+
+bool HarrisPriester::isDefined() const
+{
+    return cosinePower_.isDefined() && earthRadius_.isDefined() && earthFlattening_.isDefined();
+}
+
+Integer HarrisPriester::getCosinePower() const
+{
+    return cosinePower_;
+}
+
+Real HarrisPriester::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
+{
+    if (!aLLA.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("LLA");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const double altitude = aLLA.getAltitude().inKilometers();
+
+    if ((altitude < heights.front()) || (altitude > heights.back()))
+    {
+        throw ostk::core::error::RuntimeError(String::Format(
+            "Harris-Priester density model is not valid for altitudes outside of [100, 1000] km. Altitude = {}",
+            aLLA.getAltitude().toString()
+        ));
+    }
+
+    const Index bandIndex = std::min<Index>(
+        static_cast<Index>(std::upper_bound(heights.begin(), heights.end(), altitude) - heights.begin()) - 1,
+        bandCount - 2
+    );
+
+    const double minimumDensity = InterpolateDensity(altitude, bandIndex, minimumDensities);
+    const double maximumDensity = InterpolateDensity(altitude, bandIndex, maximumDensities);
+
+    // Diurnal bulge apex, lagging the Sun in longitude
+
+    const Vector3d sunDirection = this->computeSunDirectionAt(anInstant);
+    const Vector3d apexDirection(
+        std::cos(bulgeLag) * sunDirection.x() - std::sin(bulgeLag) * sunDirection.y(),
+        std::sin(bulgeLag) * sunDirection.x() + std::cos(bulgeLag) * sunDirection.y(),
+        sunDirection.z()
+    );
+
+    const Vector3d positionDirection = aLLA.toCartesian(earthRadius_, earthFlattening_).normalized();
+
+    // cos^n(psi / 2) = ((1 + cos(psi)) / 2)^(n / 2)
+
+    const double cosineApexAngle = std::clamp(apexDirection.dot(positionDirection), -1.0, 1.0);
+    const double bulgeWeight =
+        std::pow((1.0 + cosineApexAngle) / 2.0, static_cast<double>(static_cast<int>(cosinePower_)) / 2.0);
+
+    return minimumDensity + (maximumDensity - minimumDensity) * bulgeWeight;
+}
+
+Vector3d HarrisPriester::computeSunDirectionAt(const Instant& anInstant) const
+{
+    if (sunCelestialSPtr_ != nullptr)
+    {
+        return sunCelestialSPtr_->getPositionIn(earthFrameSPtr_, anInstant).getCoordinates().normalized();
+    }
+
+    // Mean Sun longitude, and low precision solar declination from the Astronomical Almanac
+
+    const Time timeOfDay = anInstant.getDateTime(Scale::UTC).getTime();
+    const double secondsOfDay = timeOfDay.getTotalFloatingSeconds();
+
+    const double sunLongitude = (180.0 - secondsOfDay / 240.0) * M_PI / 180.0;
+
+    const double daysSinceJ2000 = (anInstant - Instant::J2000()).inDays();
+
+    const double meanAnomaly = (357.529 + 0.98560028 * daysSinceJ2000) * M_PI / 180.0;
+    const double meanLongitude = (280.459 + 0.98564736 * daysSinceJ2000) * M_PI / 180.0;
+    const double eclipticLongitude =
+        meanLongitude + (1.915 * std::sin(meanAnomaly) + 0.020 * std::sin(2.0 * meanAnomaly)) * M_PI / 180.0;
+    const double obliquity = (23.439 - 0.00000036 * daysSinceJ2000) * M_PI / 180.0;
+
+    const double sunDeclination = std::asin(std::sin(obliquity) * std::sin(eclipticLongitude));
+
+    return Vector3d(
+        std::cos(sunDeclination) * std::cos(sunLongitude),
+        std::cos(sunDeclination) * std::sin(sunLongitude),
+        std::sin(sunDeclination)
+    );
+}
+
+}  // namespace earth
+}  // namespace atmospheric
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
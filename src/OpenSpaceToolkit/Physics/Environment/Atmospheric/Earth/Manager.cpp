@@ -16,6 +16,7 @@
 #include <OpenSpaceToolkit/IO/IP/TCP/HTTP/Client.hpp>
 
 #include <OpenSpaceToolkit/Physics/Data/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Utility.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Date.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
@@ -49,6 +50,8 @@ using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::time::Time;
 
+using ostk::physics::data::utilities::getFileModifiedInstant;
+
 using ManifestManager = ostk::physics::data::Manager;
 
 const String CSSISpaceWeatherFileName = "SW-Last5Years.csv";
@@ -56,6 +59,11 @@ const String CSSISpaceWeatherManifestName = "space-weather-CSSI";
 
 const String temporaryDirectoryName = "tmp";
 
+Manager::~Manager()
+{
+    this->stopBackgroundRefresh();
+}
+
 Directory Manager::getCSSISpaceWeatherDirectory() const
 {
     return Directory::Path(localRepository_.getPath() + Path::Parse("CSSISpaceWeather"));
@@ -63,20 +71,16 @@ Directory Manager::getCSSISpaceWeatherDirectory() const
 
 CSSISpaceWeather Manager::getLoadedCSSISpaceWeather() const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    return CSSISpaceWeather_;
+    return *CSSISpaceWeather_.load();
 }
 
 CSSISpaceWeather Manager::getCSSISpaceWeatherAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt_(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt_(anInstant);
 
-    if (CSSISpaceWeatherPtr != nullptr)
+    if (CSSISpaceWeatherSPtr != nullptr)
     {
-        return *CSSISpaceWeatherPtr;
+        return *CSSISpaceWeatherSPtr;
     }
 
     throw ostk::core::error::RuntimeError("Cannot obtain CSSI Space Weather File at [{}].", anInstant.toString());
@@ -84,8 +88,7 @@ CSSISpaceWeather Manager::getCSSISpaceWeatherAt(const Instant& anInstant) const
 
 Array<Integer> Manager::getKp3HourSolarIndicesAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt_(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt_(anInstant);
 
     static auto getKpArray = [](const CSSISpaceWeather::Reading& aReading) -> Array<Integer>
     {
@@ -114,7 +117,7 @@ Array<Integer> Manager::getKp3HourSolarIndicesAt(const Instant& anInstant) const
         );
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -122,14 +125,15 @@ Array<Integer> Manager::getKp3HourSolarIndicesAt(const Instant& anInstant) const
     }
     else
     {
-        return getKpArray(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getKpArray(
+            CSSISpaceWeatherSPtr->accessLastReadingWithDefined(CSSISpaceWeather::Field::Kp3Hour, anInstant)
+        );
     }
 }
 
 Array<Integer> Manager::getAp3HourSolarIndicesAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt_(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt_(anInstant);
 
     static auto getApArray = [](const CSSISpaceWeather::Reading& aReading) -> Array<Integer>
     {
@@ -158,7 +162,7 @@ Array<Integer> Manager::getAp3HourSolarIndicesAt(const Instant& anInstant) const
         );
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -166,14 +170,15 @@ Array<Integer> Manager::getAp3HourSolarIndicesAt(const Instant& anInstant) const
     }
     else
     {
-        return getApArray(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getApArray(
+            CSSISpaceWeatherSPtr->accessLastReadingWithDefined(CSSISpaceWeather::Field::Ap3Hour, anInstant)
+        );
     }
 }
 
 Integer Manager::getApDailyIndexAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt_(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt_(anInstant);
 
     static auto getApDaily = [](const CSSISpaceWeather::Reading& aReading) -> Integer
     {
@@ -185,7 +190,7 @@ Integer Manager::getApDailyIndexAt(const Instant& anInstant) const
         return aReading.ApAvg.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -193,14 +198,15 @@ Integer Manager::getApDailyIndexAt(const Instant& anInstant) const
     }
     else
     {
-        return getApDaily(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getApDaily(
+            CSSISpaceWeatherSPtr->accessLastReadingWithDefined(CSSISpaceWeather::Field::ApDaily, anInstant)
+        );
     }
 }
 
 Real Manager::getF107SolarFluxAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt_(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt_(anInstant);
 
     static auto getF107Obs = [](const CSSISpaceWeather::Reading& aReading) -> Real
     {
@@ -212,7 +218,7 @@ Real Manager::getF107SolarFluxAt(const Instant& anInstant) const
         return aReading.F107Obs.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -220,14 +226,15 @@ Real Manager::getF107SolarFluxAt(const Instant& anInstant) const
     }
     else
     {
-        return getF107Obs(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getF107Obs(
+            CSSISpaceWeatherSPtr->accessLastReadingWithDefined(CSSISpaceWeather::Field::F107Obs, anInstant)
+        );
     }
 }
 
 Real Manager::getF107SolarFlux81DayAvgAt(const Instant& anInstant) const
 {
-    std::lock_guard<std::mutex> lock {mutex_};
-    const CSSISpaceWeather* CSSISpaceWeatherPtr = this->accessCSSISpaceWeatherAt_(anInstant);
+    const Shared<const CSSISpaceWeather> CSSISpaceWeatherSPtr = this->accessCSSISpaceWeatherAt_(anInstant);
 
     static auto getF107ObsCenter81 = [](const CSSISpaceWeather::Reading& aReading) -> Real
     {
@@ -239,7 +246,7 @@ Real Manager::getF107SolarFlux81DayAvgAt(const Instant& anInstant) const
         return aReading.F107ObsCenter81.isDefined();
     };
 
-    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherPtr->accessReadingAt(anInstant);
+    const CSSISpaceWeather::Reading& reading = CSSISpaceWeatherSPtr->accessReadingAt(anInstant);
 
     if (outputIsDefined(reading))
     {
@@ -247,10 +254,17 @@ Real Manager::getF107SolarFlux81DayAvgAt(const Instant& anInstant) const
     }
     else
     {
-        return getF107ObsCenter81(CSSISpaceWeatherPtr->accessLastReadingWhere(outputIsDefined, anInstant));
+        return getF107ObsCenter81(
+            CSSISpaceWeatherSPtr->accessLastReadingWithDefined(CSSISpaceWeather::Field::F107ObsCenter81, anInstant)
+        );
     }
 }
 
+CSSISpaceWeather::NRLMSISE00Input Manager::getNRLMSISE00InputAt(const Instant& anInstant) const
+{
+    return this->accessCSSISpaceWeatherAt_(anInstant)->getNRLMSISE00InputAt(anInstant);
+}
+
 void Manager::loadCSSISpaceWeather(const CSSISpaceWeather& aCSSISpaceWeather)
 {
     if (!aCSSISpaceWeather.isDefined())
@@ -274,7 +288,11 @@ void Manager::reset()
 {
     BaseManager::reset();
 
-    CSSISpaceWeather_ = CSSISpaceWeather::Undefined();
+    {
+        std::lock_guard<std::mutex> lock {mutex_};
+
+        CSSISpaceWeather_.store(std::make_shared<const CSSISpaceWeather>(CSSISpaceWeather::Undefined()));
+    }
 }
 
 Manager& Manager::Get()
@@ -292,31 +310,51 @@ Manager::Manager()
           Path::Parse("environment/atmospheric/earth"),
           "OSTK_PHYSICS_ENVIRONMENT_ATMOSPHERIC_EARTH_MANAGER_LOCAL_REPOSITORY_LOCK_TIMEOUT"
       ),
-      CSSISpaceWeather_(CSSISpaceWeather::Undefined())
+      CSSISpaceWeather_(std::make_shared<const CSSISpaceWeather>(CSSISpaceWeather::Undefined()))
 {
     this->setup_();
 }
 
-const CSSISpaceWeather* Manager::accessCSSISpaceWeatherAt_(const Instant& anInstant) const
+Shared<const CSSISpaceWeather> Manager::accessCSSISpaceWeatherAt_(const Instant& anInstant) const
 {
     if (!anInstant.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Instant");
     }
 
-    // Try currently loaded
-    if (CSSISpaceWeather_.isDefined())
+    const auto validSpaceWeatherOrThrow =
+        [&anInstant](const Shared<const CSSISpaceWeather>& aCSSISpaceWeatherSPtr) -> Shared<const CSSISpaceWeather>
     {
-        if (CSSISpaceWeather_.accessObservationInterval().contains(anInstant) ||
-            CSSISpaceWeather_.accessDailyPredictionInterval().contains(anInstant) ||
-            CSSISpaceWeather_.accessMonthlyPredictionInterval().contains(anInstant))
+        if (aCSSISpaceWeatherSPtr->accessObservationInterval().contains(anInstant) ||
+            aCSSISpaceWeatherSPtr->accessDailyPredictionInterval().contains(anInstant) ||
+            aCSSISpaceWeatherSPtr->accessMonthlyPredictionInterval().contains(anInstant))
         {
-            return &CSSISpaceWeather_;
+            return aCSSISpaceWeatherSPtr;
         }
 
         throw ostk::core::error::RuntimeError(
             "Loaded CSSI Space Weather file is not valid for [{}].", anInstant.toString()
         );
+    };
+
+    // Try currently loaded, without the manager mutex
+
+    const Shared<const CSSISpaceWeather> loadedCSSISpaceWeatherSPtr = CSSISpaceWeather_.load();
+
+    if (loadedCSSISpaceWeatherSPtr->isDefined())
+    {
+        return validSpaceWeatherOrThrow(loadedCSSISpaceWeatherSPtr);
+    }
+
+    std::lock_guard<std::mutex> lock {mutex_};
+
+    // Another thread may have loaded space weather while this one was waiting for the mutex
+
+    const Shared<const CSSISpaceWeather> lockedCSSISpaceWeatherSPtr = CSSISpaceWeather_.load();
+
+    if (lockedCSSISpaceWeatherSPtr->isDefined())
+    {
+        return validSpaceWeatherOrThrow(lockedCSSISpaceWeatherSPtr);
     }
 
     // Try loading or fetching latest Space Weather file
@@ -334,9 +372,9 @@ const CSSISpaceWeather* Manager::accessCSSISpaceWeatherAt_(const Instant& anInst
                 );
             }
 
-            const_cast<Manager*>(this)->loadCSSISpaceWeather_(CSSISpaceWeather::Load(latestCSSISpaceWeatherFile));
+            const_cast<Manager*>(this)->loadCSSISpaceWeather_(CSSISpaceWeather::LoadCached(latestCSSISpaceWeatherFile));
 
-            return &CSSISpaceWeather_;
+            return CSSISpaceWeather_.load();
         }
 
         case Manager::Mode::Manual:
@@ -359,9 +397,9 @@ const CSSISpaceWeather* Manager::accessCSSISpaceWeatherAt_(const Instant& anInst
                 );
             }
 
-            const_cast<Manager*>(this)->loadCSSISpaceWeather_(CSSISpaceWeather::Load(localCSSISpaceWeatherFile));
+            const_cast<Manager*>(this)->loadCSSISpaceWeather_(CSSISpaceWeather::LoadCached(localCSSISpaceWeatherFile));
 
-            return &CSSISpaceWeather_;
+            return CSSISpaceWeather_.load();
         }
 
         default:
@@ -384,7 +422,7 @@ File Manager::getLatestCSSISpaceWeatherFile_() const
         File::Path(this->getCSSISpaceWeatherDirectory().getPath() + Path::Parse(CSSISpaceWeatherFileName));
 
     // Load local file to access its timestamp
-    const CSSISpaceWeather localSpaceWeather = CSSISpaceWeather::Load(localCSSISpaceWeatherFile);
+    const CSSISpaceWeather localSpaceWeather = CSSISpaceWeather::LoadCached(localCSSISpaceWeatherFile);
 
     // Get the Data Manager instance to query manifest
     ManifestManager& manifestManager = ManifestManager::Get();
@@ -414,9 +452,55 @@ void Manager::setup_()
     }
 }
 
+void Manager::refresh_()
+{
+    if (this->getMode() != Manager::Mode::Automatic)
+    {
+        return;
+    }
+
+    // Space weather is refreshed if it is not loaded yet or older than its remote. The local file is used if it is up
+    // to date, otherwise the latest file is fetched. Fetching and loading happen without the manager mutex held:
+    // queries keep using the loaded space weather until the refreshed one is published.
+
+    const auto isOutdated = [](const Instant& aLocalUpdateTimestamp, const Instant& aRemoteUpdateTimestamp) -> bool
+    {
+        return (!aLocalUpdateTimestamp.isDefined()) || (aRemoteUpdateTimestamp > aLocalUpdateTimestamp);
+    };
+
+    const Instant remoteUpdateTimestamp =
+        ManifestManager::Get().getLastUpdateTimestampFor(CSSISpaceWeatherManifestName);
+
+    const Shared<const CSSISpaceWeather> loadedCSSISpaceWeatherSPtr = CSSISpaceWeather_.load();
+
+    const Instant loadedUpdateTimestamp = loadedCSSISpaceWeatherSPtr->isDefined()
+                                            ? loadedCSSISpaceWeatherSPtr->accessLastModifiedTimestamp()
+                                            : Instant::Undefined();
+
+    if (!isOutdated(loadedUpdateTimestamp, remoteUpdateTimestamp))
+    {
+        return;
+    }
+
+    const File localCSSISpaceWeatherFile =
+        File::Path(this->getCSSISpaceWeatherDirectory().getPath() + Path::Parse(CSSISpaceWeatherFileName));
+
+    const File CSSISpaceWeatherFile =
+        (localCSSISpaceWeatherFile.exists() &&
+         (!isOutdated(getFileModifiedInstant(localCSSISpaceWeatherFile), remoteUpdateTimestamp)))
+            ? localCSSISpaceWeatherFile
+            : this->fetchLatestCSSISpaceWeather_();
+
+    const CSSISpaceWeather spaceWeather = CSSISpaceWeather::LoadCached(CSSISpaceWeatherFile);
+
+    std::lock_guard<std::mutex> lock {mutex_};
+
+    this->loadCSSISpaceWeather_(spaceWeather);
+}
+
 void Manager::loadCSSISpaceWeather_(const CSSISpaceWeather& aCSSISpaceWeather)
 {
-    CSSISpaceWeather_ = aCSSISpaceWeather;
+    CSSISpaceWeather_.store(std::make_shared<const CSSISpaceWeather>(aCSSISpaceWeather));
 }
 
 File Manager::fetchLatestCSSISpaceWeather_()
@@ -2,6 +2,7 @@
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Real.hpp>
 #include <OpenSpaceToolkit/Core/Type/Size.hpp>
@@ -22,7 +23,16 @@ extern "C"
 }
 }  // namespace NRLMSISE00_c
 
+#include <sofa/sofa.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <iterator>
+#include <exception>
+#include <thread>
+#include <vector>
 
 namespace ostk
 {
@@ -36,11 +46,15 @@ namespace earth
 {
 
 using ostk::core::container::Array;
+using ostk::core::type::Index;
 using ostk::core::type::Integer;
 using ostk::core::type::Real;
 using ostk::core::type::Size;
+using ostk::core::type::Uint64;
 using ostk::core::type::Unique;
 
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::time::Date;
 using ostk::physics::time::DateTime;
@@ -52,6 +66,69 @@ using EarthCelestial = ostk::physics::environment::object::celestial::Earth;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 using ostk::physics::environment::atmospheric::earth::Manager;
 
+namespace
+{
+
+// Number of memoized Sun positions per thread, enough for a few interleaved instants (e.g. integrator stages)
+constexpr Size sunPositionCapacity = 8;
+
+// Sun positions memoized by the calling thread, tagged with the identifier of the model that computed them. Identifiers
+// are never reused, so that an entry cannot be mistaken for one of a later model.
+
+struct SunPositionEntry
+{
+    Uint64 modelId = 0;
+    Instant instant = Instant::Undefined();
+    Vector3d position = Vector3d::Zero();
+};
+
+struct SunPositionMemo
+{
+    std::array<SunPositionEntry, sunPositionCapacity> entries;
+    Index nextEntryIndex = 0;
+};
+
+thread_local SunPositionMemo sunPositionMemo;
+
+std::atomic<Uint64> nextSunPositionMemoId = {1};
+
+struct TimeOfYear
+{
+    Integer year;
+    Integer dayOfYear;
+    Integer secondsInDay;
+};
+
+TimeOfYear TimeOfYearAt(const Instant& anInstant)
+{
+    const DateTime currentDateTime = anInstant.getDateTime(Scale::UTC);
+
+    const Integer year = currentDateTime.getDate().getYear();
+
+    const Instant startOfYear = Instant::DateTime(DateTime(Date(year, 1, 1), Time::Midnight()), Scale::UTC);
+
+    const Time timeOfDay = currentDateTime.getTime();
+
+    return {
+        year,
+        (anInstant - startOfYear).getDays() + 1,
+        timeOfDay.getHour() * 3600 + timeOfDay.getMinute() * 60 + timeOfDay.getSecond(),
+    };
+}
+
+// Local solar time [hours], from the Sun and the position expressed in the Earth frame
+
+double LocalSolarTimeAt(const Vector3d& aSunPosition, const Vector3d& aPosition)
+{
+    return (Real::Pi() + std::atan2(
+                             aSunPosition[0] * aPosition[1] - aSunPosition[1] * aPosition[0],
+                             aSunPosition[0] * aPosition[0] + aSunPosition[1] * aPosition[1]
+                         )) *
+           12.0 / Real::Pi();
+}
+
+}  // namespace
+
 NRLMSISE00::NRLMSISE00(
     const InputDataType& anInputDataType,
     const Real& aF107ConstantValue,
@@ -69,7 +146,8 @@ NRLMSISE00::NRLMSISE00(
       earthFrameSPtr_(anEarthFrameSPtr),
       earthRadius_(anEarthRadius),
       earthFlattening_(anEarthFlattening),
-      sunCelestialSPtr_(aSunCelestialSPtr)
+      sunCelestialSPtr_(aSunCelestialSPtr),
+      sunPositionMemoId_(nextSunPositionMemoId.fetch_add(1, std::memory_order_relaxed))
 {
 }
 
@@ -104,86 +182,13 @@ Unique<NRLMSISE00::ap_array> NRLMSISE00::computeApArray(const Instant& anInstant
         {
             // Use historical and predicted values for F10.7, F10.7a and Kp NRLMSISE00 input parameters
             //
-            // Algorithm:
-            //
-            // Ap readings are given on a daily basis.
-            // We first create a timestamp in each day for which we will need data.
-            // Sometimes "now" and "now-9hr" land on the same day.
-            //
-            //  now-57hr                 now
-            //     v                      v
-            //     *        *        *    *
-            //     |--------|--------|----|
-            //        24hr     24hr   9hr
-            //
-            // Then, we fetch the Ap data for each of those days
-            // For each day, we get 8 3-hourly readings, starting at 00:00 UTC.
-            // They usually do not line up with the 24-hour periods.
-            //
-            //     *        *        *    *
-            //     |--------|--------|----|
-            //|........|........|........|........|
-            //   day1     day2     day3     day4
-            //
-            // We stack the data into a single array then find which data point
-            // on day 1 lines up with the "now-57hr" timestamp
-            //
-            //     *        *        *    *
-            //     |--------|--------|----|
-            //|........|........|........|........|
-            //     ^
-            //  this one
-            //
-            // Then use that as a starting index to find the correct data points and averages.
-
-            const Manager& spaceWeatherManager = Manager::Get();
+            // The space weather is flattened at load time into a timeline of 3-hour Ap slots (8 per UTC day,
+            // starting at 00:00 UTC), so the slots 3, 6 and 9 hours before the instant, and the two 8-slot windows
+            // from 12 to 33 and from 36 to 57 hours before it, are read at fixed offsets from the instant slot.
 
-            // Fetch AP parameters for each day up to 57 hours ago
-            const Instant instant57HrPrevious = anInstant - Duration::Hours(57);
-            const Instant instant33HrPrevious = anInstant - Duration::Hours(33);
-            const Instant instant9HrPrevious = anInstant - Duration::Hours(9);
+            const CSSISpaceWeather::NRLMSISE00Input input = Manager::Get().getNRLMSISE00InputAt(anInstant);
 
-            // Fetch daily AP array for each day and stack end-to-end
-            Array<Instant> fetchDays = {instant57HrPrevious, instant33HrPrevious, instant9HrPrevious};
-
-            // add today if not already covered by instant9HrPrevious
-            if (instant9HrPrevious.getDateTime(Scale::UTC).getDate().getDay() !=
-                anInstant.getDateTime(Scale::UTC).getDate().getDay())
-            {
-                fetchDays.add(anInstant);
-            }
-
-            // Fetch AP indices for all days. Stack them into one continuous array.
-            Array<Integer> apMultiDayArray = Array<Integer>::Empty();
-            apMultiDayArray.reserve(fetchDays.getSize());
-
-            for (const Instant& fetchDay : fetchDays)
-            {
-                apMultiDayArray.add(spaceWeatherManager.getAp3HourSolarIndicesAt(fetchDay));
-            }
-
-            // Find correct index to start at based on time of day of the first day
-            // [00:00 - 03:00) == 0, [03:00 - 06:00) == 1, etc.
-            const Time startTime = instant57HrPrevious.getDateTime(Scale::UTC).getTime();
-            const Size startIndex = (startTime.getHour() / 3);
-
-            const Array<Integer>::ConstIterator startIterator = apMultiDayArray.begin() + startIndex;
-
-            // Average of 8 AP values from 57 hours ago to 36 hours ago
-            const Real apAvg36HrTo57Hr =
-                Real(Array<Integer>(startIterator, startIterator + 8).reduce(std::plus<Integer>())) / 8.0;
-
-            // Average of 8 AP values from 36 hours ago to 12 hours ago
-            const Real apAvg12HrTo36Hr =
-                Real(Array<Integer>(startIterator + 8, startIterator + 16).reduce(std::plus<Integer>())) / 8.0;
-
-            outputStruct->a[0] = spaceWeatherManager.getApDailyIndexAt(anInstant);
-            outputStruct->a[1] = apMultiDayArray[startIndex + 19];  // now
-            outputStruct->a[2] = apMultiDayArray[startIndex + 18];  // now - 3 hours
-            outputStruct->a[3] = apMultiDayArray[startIndex + 17];  // now - 6 hours
-            outputStruct->a[4] = apMultiDayArray[startIndex + 16];  // now - 9 hours
-            outputStruct->a[5] = apAvg12HrTo36Hr;
-            outputStruct->a[6] = apAvg36HrTo57Hr;
+            std::copy(std::begin(input.ap), std::end(input.ap), std::begin(outputStruct->a));
 
             break;
         }
@@ -218,58 +223,40 @@ Unique<NRLMSISE00::nrlmsise_input> NRLMSISE00::computeNRLMSISE00Input(
             // Input reference is in the NRLMSISE header file
             // https://github.com/magnific0/nrlmsise-00/blob/master/nrlmsise-00.h
 
-            const Manager& spaceWeatherManager = Manager::Get();
+            const CSSISpaceWeather::NRLMSISE00Input input = Manager::Get().getNRLMSISE00InputAt(anInstant);
 
             // Solar flux values
-            f107Previous = spaceWeatherManager.getF107SolarFluxAt(anInstant - Duration::Days(1));
-            f107Average = spaceWeatherManager.getF107SolarFlux81DayAvgAt(anInstant);
+            f107Previous = input.f107;
+            f107Average = input.f107Average;
 
             break;
         }
     }
 
-    const DateTime currentDateTime = anInstant.getDateTime(Scale::UTC);
-
     // current year/doy/sec
-    const Integer year = currentDateTime.getDate().getYear();
-
-    const Instant startOfYear = Instant::DateTime(DateTime(Date(year, 1, 1), Time::Midnight()), Scale::UTC);
-    const Integer dayOfYear = (anInstant - startOfYear).getDays() + 1;
-
-    const Time timeOfDay = currentDateTime.getTime();
-    const Integer secondsInDay = timeOfDay.getHour() * 3600 + timeOfDay.getMinute() * 60 + timeOfDay.getSecond();
+    const TimeOfYear timeOfYear = TimeOfYearAt(anInstant);
 
     Real lst = Real::Undefined();
 
     // Use actual sun position to compute local solar time if provided
     if (sunCelestialSPtr_)
     {
-        const Position position = {
-            aLLA.toCartesian(earthRadius_, earthFlattening_), Position::Unit::Meter, earthFrameSPtr_
-        };
-
-        const Position sunPositionInFrame = sunCelestialSPtr_->getPositionIn(earthFrameSPtr_, anInstant);
-
-        lst = (Real::Pi() + std::atan2(
-                                sunPositionInFrame.accessCoordinates()[0] * position.accessCoordinates()[1] -
-                                    sunPositionInFrame.accessCoordinates()[1] * position.accessCoordinates()[0],
-                                sunPositionInFrame.accessCoordinates()[0] * position.accessCoordinates()[0] +
-                                    sunPositionInFrame.accessCoordinates()[1] * position.accessCoordinates()[1]
-                            )) *
-              12.0 / Real::Pi();
+        lst = LocalSolarTimeAt(
+            this->computeSunPositionAt(anInstant), aLLA.toCartesian(earthRadius_, earthFlattening_)
+        );
     }
     else
     {
         // This is the preferred method per the NRLMSISE documentation
         // https://github.com/magnific0/nrlmsise-00/blob/master/nrlmsise-00.h#L103
-        lst = Real::Integer(secondsInDay) / 3600.0 + aLLA.getLongitude().inDegrees() / 15.0;
+        lst = Real::Integer(timeOfYear.secondsInDay) / 3600.0 + aLLA.getLongitude().inDegrees() / 15.0;
     }
 
     Unique<NRLMSISE00::nrlmsise_input> input = std::make_unique<NRLMSISE00::nrlmsise_input>();
 
-    input->doy = dayOfYear;
-    input->year = year;
-    input->sec = secondsInDay;
+    input->doy = timeOfYear.dayOfYear;
+    input->year = timeOfYear.year;
+    input->sec = timeOfYear.secondsInDay;
     input->alt = aLLA.getAltitude().inKilometers();
     input->g_lat = aLLA.getLatitude().inDegrees();
     input->g_long = aLLA.getLongitude().inDegrees();
@@ -323,6 +310,26 @@ Real NRLMSISE00::getKpConstantValue() const
     return this->kpConstantValue_;
 }
 
+Shared<const Frame> NRLMSISE00::getEarthFrame() const
+{
+    return this->earthFrameSPtr_;
+}
+
+Length NRLMSISE00::getEarthRadius() const
+{
+    return this->earthRadius_;
+}
+
+Real NRLMSISE00::getEarthFlattening() const
+{
+    return this->earthFlattening_;
+}
+
+Shared<Celestial> NRLMSISE00::getSunCelestial() const
+{
+    return this->sunCelestialSPtr_;
+}
+
 Real NRLMSISE00::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
 {
     Unique<NRLMSISE00::ap_array> apValues = nullptr;
@@ -337,6 +344,97 @@ Real NRLMSISE00::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
     return NRLMSISE00::GetDensityAt(*input);
 }
 
+VectorXd NRLMSISE00::getDensitiesAt(
+    const PositionArray& aPositionArray, const Instant& anInstant, const Size& aThreadCount
+) const
+{
+    return this->getDensitiesAt(aPositionArray, Array<Instant> {anInstant}, aThreadCount);
+}
+
+VectorXd NRLMSISE00::getDensitiesAt(
+    const PositionArray& aPositionArray, const Array<Instant>& anInstantArray, const Size& aThreadCount
+) const
+{
+    if (!aPositionArray.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position array");
+    }
+
+    if (anInstantArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant array");
+    }
+
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count");
+    }
+
+    const PositionArray positionArray = aPositionArray.inMeters().inFrame(earthFrameSPtr_, anInstantArray);
+    const PositionArray::ConstMatrix3XdMap coordinates = positionArray.accessCoordinates();
+
+    const Size positionCount = coordinates.cols();
+
+    VectorXd densities(positionCount);
+
+    // Sequential by default. Otherwise, each thread evaluates a contiguous range of positions, with its own NRLMSISE-00
+    // working state.
+
+    const Size threadCount = std::max<Size>(1, std::min<Size>(aThreadCount, positionCount));
+
+    if (threadCount == 1)
+    {
+        this->computeDensities(coordinates, anInstantArray, 0, positionCount, densities);
+
+        return densities;
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(threadCount);
+
+    const auto computeRange = [&](const Index aThreadIndex)
+    {
+        try
+        {
+            this->computeDensities(
+                coordinates,
+                anInstantArray,
+                aThreadIndex * positionCount / threadCount,
+                (aThreadIndex + 1) * positionCount / threadCount,
+                densities
+            );
+        }
+        catch (...)
+        {
+            exceptions[aThreadIndex] = std::current_exception();
+        }
+    };
+
+    for (Index threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back(computeRange, threadIndex);
+    }
+
+    computeRange(0);
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Rethrow the error of the first failing position, as a sequential evaluation would
+
+    for (const std::exception_ptr& exception : exceptions)
+    {
+        if (exception != nullptr)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    return densities;
+}
+
 Real NRLMSISE00::GetDensityAt(NRLMSISE00::nrlmsise_input& input)
 {
     // Included from https://github.com/magnific0/nrlmsise-00/blob/master/nrlmsise-00.h
@@ -350,11 +448,126 @@ Real NRLMSISE00::GetDensityAt(NRLMSISE00::nrlmsise_input& input)
     }
 
     NRLMSISE00_c::nrlmsise_input* input_c = reinterpret_cast<NRLMSISE00_c::nrlmsise_input*>(&input);
+
+    // The library is built with its working state thread-local (see thirdparty/nrlmsise-00), so no lock is needed
     NRLMSISE00_c::gtd7d(input_c, &flags, &output);
 
     return output.d[5];
 }
 
+void NRLMSISE00::computeDensities(
+    const PositionArray::ConstMatrix3XdMap& aCoordinateMatrix,
+    const Array<Instant>& anInstantArray,
+    const Index aBeginIndex,
+    const Index anEndIndex,
+    VectorXd& aDensityVector
+) const
+{
+    const double equatorialRadius_m = earthRadius_.inMeters();
+    const double flattening = earthFlattening_;
+
+    NRLMSISE00::ap_array apValues;
+    NRLMSISE00::nrlmsise_input input;
+    Vector3d sunPosition = Vector3d::Zero();
+
+    const Instant* previousInstantPtr = nullptr;
+
+    for (Index index = aBeginIndex; index < anEndIndex; ++index)
+    {
+        const Instant& instant = (anInstantArray.getSize() == 1) ? anInstantArray.accessFirst() : anInstantArray[index];
+
+        // Instant dependent inputs, shared by consecutive positions at the same instant
+
+        if ((previousInstantPtr == nullptr) || ((previousInstantPtr != &instant) && (instant != *previousInstantPtr)))
+        {
+            if (!instant.isDefined())
+            {
+                throw ostk::core::error::runtime::Undefined("Instant");
+            }
+
+            const TimeOfYear timeOfYear = TimeOfYearAt(instant);
+
+            input.year = timeOfYear.year;
+            input.doy = timeOfYear.dayOfYear;
+            input.sec = timeOfYear.secondsInDay;
+
+            switch (this->inputDataType_)
+            {
+                case InputDataType::ConstantFluxAndGeoMag:
+                {
+                    input.f107 = this->f107ConstantValue_;
+                    input.f107A = this->f107AConstantValue_;
+                    input.ap = this->convertKpToAp(this->kpConstantValue_);
+                    input.ap_a = nullptr;
+
+                    break;
+                }
+
+                case InputDataType::CSSISpaceWeatherFile:
+                {
+                    const CSSISpaceWeather::NRLMSISE00Input spaceWeatherInput =
+                        Manager::Get().getNRLMSISE00InputAt(instant);
+
+                    std::copy(std::begin(spaceWeatherInput.ap), std::end(spaceWeatherInput.ap), std::begin(apValues.a));
+
+                    input.f107 = spaceWeatherInput.f107;
+                    input.f107A = spaceWeatherInput.f107Average;
+                    input.ap = apValues.a[0];
+                    input.ap_a = &apValues;
+
+                    break;
+                }
+            }
+
+            if (sunCelestialSPtr_)
+            {
+                sunPosition = this->computeSunPositionAt(instant);
+            }
+
+            previousInstantPtr = &instant;
+        }
+
+        // Position dependent inputs, converted to geodetic coordinates without intermediate LLA objects
+
+        Vector3d position = aCoordinateMatrix.col(index);
+
+        double latitude_rad;
+        double longitude_rad;
+        double altitude_m;
+
+        if (iauGc2gde(equatorialRadius_m, flattening, position.data(), &longitude_rad, &latitude_rad, &altitude_m) != 0)
+        {
+            throw ostk::core::error::RuntimeError("Cannot convert Cartesian to LLA.");
+        }
+
+        input.alt = altitude_m / 1000.0;
+        input.g_lat = latitude_rad * 180.0 / M_PI;
+        input.g_long = longitude_rad * 180.0 / M_PI;
+        input.lst = sunCelestialSPtr_ ? LocalSolarTimeAt(sunPosition, position)
+                                      : input.sec / 3600.0 + input.g_long / 15.0;
+
+        aDensityVector(index) = NRLMSISE00::GetDensityAt(input);
+    }
+}
+
+Vector3d NRLMSISE00::computeSunPositionAt(const Instant& anInstant) const
+{
+    for (const SunPositionEntry& entry : sunPositionMemo.entries)
+    {
+        if ((entry.modelId == sunPositionMemoId_) && (entry.instant == anInstant))
+        {
+            return entry.position;
+        }
+    }
+
+    const Vector3d sunPosition = sunCelestialSPtr_->getPositionIn(earthFrameSPtr_, anInstant).getCoordinates();
+
+    sunPositionMemo.entries[sunPositionMemo.nextEntryIndex] = {sunPositionMemoId_, anInstant, sunPosition};
+    sunPositionMemo.nextEntryIndex = (sunPositionMemo.nextEntryIndex + 1) % sunPositionCapacity;
+
+    return sunPosition;
+}
+
 }  // namespace earth
 }  // namespace atmospheric
 }  // namespace environment
@@ -0,0 +1,753 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00Grid.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+namespace ostk
+{
+namespace physics
+{
+namespace environment
+{
+namespace atmospheric
+{
+namespace earth
+{
+
+using ostk::core::type::Index;
+
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
+using ostk::physics::coordinate::PositionArray;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Scale;
+using ostk::physics::time::Time;
+
+namespace
+{
+
+// Fractions of the bucket at which both grids are evaluated, within the bucket so that they share its space weather
+constexpr std::array<double, 2> gridTimeFractions = {0.25, 0.75};
+
+const Instant& ReferenceInstant()
+{
+    static const Instant referenceInstant = Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC);
+
+    return referenceInstant;
+}
+
+Size NodeCount(const double& aRange, const double& aStep)
+{
+    return static_cast<Size>(std::ceil((aRange / aStep) - 1e-9)) + 1;
+}
+
+// Lagrange interpolation weights of equally spaced nodes, at a position relative to the first node [step]
+
+std::array<double, 4> LagrangeWeights(const double& aLocalPosition, const Size& aNodeCount)
+{
+    std::array<double, 4> weights = {0.0, 0.0, 0.0, 0.0};
+
+    for (Index nodeIndex = 0; nodeIndex < aNodeCount; ++nodeIndex)
+    {
+        double weight = 1.0;
+
+        for (Index otherNodeIndex = 0; otherNodeIndex < aNodeCount; ++otherNodeIndex)
+        {
+            if (otherNodeIndex != nodeIndex)
+            {
+                weight *= (aLocalPosition - static_cast<double>(otherNodeIndex)) /
+                          (static_cast<double>(nodeIndex) - static_cast<double>(otherNodeIndex));
+            }
+        }
+
+        weights[nodeIndex] = weight;
+    }
+
+    return weights;
+}
+
+}  // namespace
+
+NRLMSISE00Grid::NRLMSISE00Grid(
+    const NRLMSISE00& aNRLMSISE00Model,
+    const Length& aMinimumAltitude,
+    const Length& aMaximumAltitude,
+    const Length& anAltitudeStep,
+    const Angle& aLatitudeStep,
+    const Duration& aLocalSolarTimeStep,
+    const Duration& aBucketDuration,
+    const Size& aCapacity
+)
+    : NRLMSISE00Model_(aNRLMSISE00Model),
+      minimumAltitude_(0.0),
+      altitudeStep_(0.0),
+      latitudeStep_(0.0),
+      localSolarTimeStep_(0.0),
+      bucketDuration_(0.0),
+      altitudeCount_(0),
+      latitudeCount_(0),
+      localSolarTimeCount_(0),
+      capacity_(aCapacity),
+      mutex_(),
+      cache_(std::make_shared<const CacheMap>()),
+      bucketIndices_()
+{
+    if (!aMinimumAltitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Minimum altitude");
+    }
+
+    if (!aMaximumAltitude.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum altitude");
+    }
+
+    if (!anAltitudeStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Altitude step");
+    }
+
+    if (!aLatitudeStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Latitude step");
+    }
+
+    if (!aLocalSolarTimeStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Local solar time step");
+    }
+
+    if (!aBucketDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Bucket duration");
+    }
+
+    const double minimumAltitude = aMinimumAltitude.inKilometers();
+    const double maximumAltitude = aMaximumAltitude.inKilometers();
+    const double altitudeStep = anAltitudeStep.inKilometers();
+    const double latitudeStep = aLatitudeStep.inDegrees();
+    const double localSolarTimeStep = aLocalSolarTimeStep.inHours();
+    const double bucketDuration = aBucketDuration.inSeconds();
+
+    if ((minimumAltitude < 0.0) || (minimumAltitude >= maximumAltitude))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Altitude range [{}, {}] [km] is not valid.", minimumAltitude, maximumAltitude
+        );
+    }
+
+    if (altitudeStep <= 0.0)
+    {
+        throw ostk::core::error::runtime::Wrong("Altitude step");
+    }
+
+    if ((latitudeStep <= 0.0) || (latitudeStep > 180.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Latitude step");
+    }
+
+    if ((localSolarTimeStep <= 0.0) || (localSolarTimeStep > 24.0))
+    {
+        throw ostk::core::error::runtime::Wrong("Local solar time step");
+    }
+
+    if ((bucketDuration < 1.0) || (bucketDuration != std::round(bucketDuration)) ||
+        (std::fmod(86400.0, bucketDuration) != 0.0))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Bucket duration [{}] [s] does not divide a day in whole seconds.", bucketDuration
+        );
+    }
+
+    if (aCapacity == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Capacity");
+    }
+
+    // Steps are shrunk so that nodes span the full ranges
+
+    altitudeCount_ = NodeCount(maximumAltitude - minimumAltitude, altitudeStep);
+    latitudeCount_ = NodeCount(180.0, latitudeStep);
+    localSolarTimeCount_ = NodeCount(24.0, localSolarTimeStep);
+
+    minimumAltitude_ = minimumAltitude;
+    altitudeStep_ = (maximumAltitude - minimumAltitude) / static_cast<double>(altitudeCount_ - 1);
+    latitudeStep_ = 180.0 / static_cast<double>(latitudeCount_ - 1);
+    localSolarTimeStep_ = 24.0 / static_cast<double>(localSolarTimeCount_ - 1);
+    bucketDuration_ = bucketDuration;
+}
+
+NRLMSISE00Grid::NRLMSISE00Grid(const NRLMSISE00Grid& aNRLMSISE00Grid)
+    : NRLMSISE00Model_(aNRLMSISE00Grid.NRLMSISE00Model_),
+      minimumAltitude_(aNRLMSISE00Grid.minimumAltitude_),
+      altitudeStep_(aNRLMSISE00Grid.altitudeStep_),
+      latitudeStep_(aNRLMSISE00Grid.latitudeStep_),
+      localSolarTimeStep_(aNRLMSISE00Grid.localSolarTimeStep_),
+      bucketDuration_(aNRLMSISE00Grid.bucketDuration_),
+      altitudeCount_(aNRLMSISE00Grid.altitudeCount_),
+      latitudeCount_(aNRLMSISE00Grid.latitudeCount_),
+      localSolarTimeCount_(aNRLMSISE00Grid.localSolarTimeCount_),
+      capacity_(aNRLMSISE00Grid.capacity_),
+      mutex_(),
+      cache_(std::make_shared<const CacheMap>()),
+      bucketIndices_()
+{
+    const std::lock_guard<std::mutex> lock {aNRLMSISE00Grid.mutex_};
+
+    this->copyCache(aNRLMSISE00Grid);
+}
+
+NRLMSISE00Grid& NRLMSISE00Grid::operator=(const NRLMSISE00Grid& aNRLMSISE00Grid)
+{
+    if (this != &aNRLMSISE00Grid)
+    {
+        const std::scoped_lock lock {mutex_, aNRLMSISE00Grid.mutex_};
+
+        NRLMSISE00Model_ = aNRLMSISE00Grid.NRLMSISE00Model_;
+        minimumAltitude_ = aNRLMSISE00Grid.minimumAltitude_;
+        altitudeStep_ = aNRLMSISE00Grid.altitudeStep_;
+        latitudeStep_ = aNRLMSISE00Grid.latitudeStep_;
+        localSolarTimeStep_ = aNRLMSISE00Grid.localSolarTimeStep_;
+        bucketDuration_ = aNRLMSISE00Grid.bucketDuration_;
+        altitudeCount_ = aNRLMSISE00Grid.altitudeCount_;
+        latitudeCount_ = aNRLMSISE00Grid.latitudeCount_;
+        localSolarTimeCount_ = aNRLMSISE00Grid.localSolarTimeCount_;
+        capacity_ = aNRLMSISE00Grid.capacity_;
+
+        this->copyCache(aNRLMSISE00Grid);
+    }
+
+    return *this;
+}
+
+NRLMSISE00Grid* NRLMSISE00Grid::clone() const
+{
+    return new NRLMSISE00Grid(*this);
+}
+
+bool NRLMSISE00Grid::isDefined() const
+{
+    return NRLMSISE00Model_.isDefined();
+}
+
+const NRLMSISE00& NRLMSISE00Grid::accessNRLMSISE00Model() const
+{
+    return NRLMSISE00Model_;
+}
+
+Size NRLMSISE00Grid::getCachedBucketCount() const
+{
+    return cache_.load()->size();
+}
+
+Size NRLMSISE00Grid::getEvaluatedNodeCount() const
+{
+    const Shared<const CacheMap> cacheSPtr = cache_.load();
+
+    Size nodeCount = 0;
+
+    for (const auto& cacheEntry : *cacheSPtr)
+    {
+        for (const std::atomic<double>& logDensity : cacheEntry.second->bucketSPtr->logDensities)
+        {
+            if (!std::isnan(logDensity.load(std::memory_order_relaxed)))
+            {
+                ++nodeCount;
+            }
+        }
+    }
+
+    return nodeCount;
+}
+
+Real NRLMSISE00Grid::getDensityAt(const LLA& aLLA, const Instant& anInstant) const
+{
+    if (!aLLA.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("LLA");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const double altitude = aLLA.getAltitude().inKilometers();
+    const double maximumAltitude = minimumAltitude_ + altitudeStep_ * static_cast<double>(altitudeCount_ - 1);
+
+    if ((altitude < minimumAltitude_) || (altitude > maximumAltitude))
+    {
+        return NRLMSISE00Model_.getDensityAt(aLLA, anInstant);
+    }
+
+    const Shared<const Bucket> bucketSPtr = this->accessBucketAt(anInstant);
+
+    const double elapsedTime = (anInstant - bucketSPtr->startInstant).inSeconds();
+    const double longitude = aLLA.getLongitude().inDegrees();
+    const double latitude = aLLA.getLatitude().inDegrees();
+
+    const double sunLongitude = bucketSPtr->sunLongitudeAtStart + bucketSPtr->sunLongitudeRate * elapsedTime;
+    const double localSolarTime = 12.0 + (longitude - sunLongitude) / 15.0;
+
+    return std::exp(this->interpolateLogDensity(*bucketSPtr, altitude, latitude, localSolarTime, elapsedTime));
+}
+
+Real NRLMSISE00Grid::computeMaximumRelativeErrorAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Shared<const Bucket> bucketSPtr = this->accessBucketAt(anInstant);
+
+    const double middleElapsedTime = bucketDuration_ / 2.0;
+    const double sunLongitude = bucketSPtr->sunLongitudeAtStart + bucketSPtr->sunLongitudeRate * middleElapsedTime;
+
+    const Length earthRadius = NRLMSISE00Model_.getEarthRadius();
+    const Real earthFlattening = NRLMSISE00Model_.getEarthFlattening();
+
+    const Size cellCount = (altitudeCount_ - 1) * (latitudeCount_ - 1) * (localSolarTimeCount_ - 1);
+
+    PositionArray::Matrix3Xd coordinates(3, cellCount);
+    Array<Vector3d> cellCenters = Array<Vector3d>::Empty();
+    cellCenters.reserve(cellCount);
+
+    for (Index altitudeIndex = 0; altitudeIndex < altitudeCount_ - 1; ++altitudeIndex)
+    {
+        const double altitude = minimumAltitude_ + (altitudeIndex + 0.5) * altitudeStep_;
+
+        for (Index latitudeIndex = 0; latitudeIndex < latitudeCount_ - 1; ++latitudeIndex)
+        {
+            const double latitude = -90.0 + (latitudeIndex + 0.5) * latitudeStep_;
+
+            for (Index localSolarTimeIndex = 0; localSolarTimeIndex < localSolarTimeCount_ - 1; ++localSolarTimeIndex)
+            {
+                const double localSolarTime = (localSolarTimeIndex + 0.5) * localSolarTimeStep_;
+                const double longitude = std::remainder(sunLongitude + 15.0 * (localSolarTime - 12.0), 360.0);
+
+                coordinates.col(cellCenters.getSize()) =
+                    LLA(Angle::Degrees(latitude), Angle::Degrees(longitude), Length::Kilometers(altitude))
+                        .toCartesian(earthRadius, earthFlattening);
+
+                cellCenters.add(Vector3d(altitude, latitude, localSolarTime));
+            }
+        }
+    }
+
+    const VectorXd densities = NRLMSISE00Model_.getDensitiesAt(
+        PositionArray::Meters(coordinates, NRLMSISE00Model_.getEarthFrame()),
+        bucketSPtr->startInstant + Duration::Seconds(middleElapsedTime)
+    );
+
+    double maximumRelativeError = 0.0;
+
+    for (Index index = 0; index < cellCenters.getSize(); ++index)
+    {
+        const Vector3d& cellCenter = cellCenters[index];
+
+        const double interpolatedDensity = std::exp(this->interpolateLogDensity(
+            *bucketSPtr, cellCenter(0), cellCenter(1), cellCenter(2), middleElapsedTime
+        ));
+
+        maximumRelativeError = std::max(maximumRelativeError, std::abs(interpolatedDensity / densities(index) - 1.0));
+    }
+
+    return maximumRelativeError;
+}
+
+void NRLMSISE00Grid::clearCache()
+{
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    cache_.store(std::make_shared<const CacheMap>());
+    bucketIndices_.clear();
+}
+
+Shared<const NRLMSISE00Grid::Bucket> NRLMSISE00Grid::accessBucketAt(const Instant& anInstant) const
+{
+    const double elapsedTime = (anInstant - ReferenceInstant()).inSeconds();
+    const std::int64_t bucketIndex = static_cast<std::int64_t>(std::floor(elapsedTime / bucketDuration_));
+
+    const auto accessCachedBucket = [&bucketIndex](const CacheMap& aCache) -> Shared<const Bucket>
+    {
+        const auto cacheIt = aCache.find(bucketIndex);
+
+        if (cacheIt == aCache.end())
+        {
+            return nullptr;
+        }
+
+        // Only written when not set yet, so that concurrent queries in the same bucket do not contend on the entry
+
+        const CacheEntry& cacheEntry = *cacheIt->second;
+
+        if (!cacheEntry.isRecentlyUsed.load(std::memory_order_relaxed))
+        {
+            cacheEntry.isRecentlyUsed.store(true, std::memory_order_relaxed);
+        }
+
+        return cacheEntry.bucketSPtr;
+    };
+
+    const Shared<const Bucket> cachedBucketSPtr = accessCachedBucket(*cache_.load());
+
+    if (cachedBucketSPtr != nullptr)
+    {
+        return cachedBucketSPtr;
+    }
+
+    // Buckets are built outside of the lock, so that queries in cached buckets are not blocked. Concurrent misses on
+    // the same bucket may build it more than once, the first inserted bucket is kept.
+
+    const Shared<const Bucket> bucketSPtr = this->buildBucket(bucketIndex);
+
+    const std::lock_guard<std::mutex> lock {mutex_};
+
+    const Shared<const CacheMap> cacheSPtr = cache_.load();
+
+    const Shared<const Bucket> insertedBucketSPtr = accessCachedBucket(*cacheSPtr);
+
+    if (insertedBucketSPtr != nullptr)
+    {
+        return insertedBucketSPtr;
+    }
+
+    // The map is copied on insertion, which is negligible next to building the bucket
+
+    CacheMap cache = *cacheSPtr;
+
+    // The oldest bucket is evicted, unless it was used since it was last considered: it is then moved to the back of
+    // the list. Second chances are bounded, so that queries marking buckets concurrently cannot hold up eviction.
+
+    Size secondChanceCount = 0;
+
+    while (cache.size() >= capacity_)
+    {
+        const std::int64_t oldestBucketIndex = bucketIndices_.front();
+
+        bucketIndices_.pop_front();
+
+        const auto oldestCacheIt = cache.find(oldestBucketIndex);
+
+        if ((secondChanceCount < capacity_) &&
+            oldestCacheIt->second->isRecentlyUsed.exchange(false, std::memory_order_relaxed))
+        {
+            bucketIndices_.push_back(oldestBucketIndex);
+
+            ++secondChanceCount;
+        }
+        else
+        {
+            cache.erase(oldestCacheIt);
+        }
+    }
+
+    cache.emplace(bucketIndex, std::make_shared<const CacheEntry>(bucketSPtr));
+    bucketIndices_.push_back(bucketIndex);
+
+    cache_.store(std::make_shared<const CacheMap>(std::move(cache)));
+
+    return bucketSPtr;
+}
+
+Shared<const NRLMSISE00Grid::Bucket> NRLMSISE00Grid::buildBucket(const std::int64_t& aBucketIndex) const
+{
+    const Instant startInstant =
+        ReferenceInstant() + Duration::Seconds(bucketDuration_ * static_cast<double>(aBucketIndex));
+    const Instant endInstant = startInstant + Duration::Seconds(bucketDuration_);
+
+    // The Sun drifts westward by about 15 deg per hour in the Earth frame: its longitude change over the bucket is
+    // unwrapped around that nominal drift, which also holds for buckets lasting more than half a day
+
+    const double nominalSunLongitudeChange = -bucketDuration_ / 240.0;
+
+    const double sunLongitudeAtStart = this->computeSunLongitudeAt(startInstant);
+    const double sunLongitudeChange =
+        nominalSunLongitudeChange +
+        std::remainder(
+            this->computeSunLongitudeAt(endInstant) - sunLongitudeAtStart - nominalSunLongitudeChange, 360.0
+        );
+
+    // Nodes are evaluated on first use (see evaluateNodes). The last local solar time node wraps onto the first
+    // one, and is not stored.
+
+    std::vector<std::atomic<double>> logDensities(
+        gridTimeFractions.size() * altitudeCount_ * latitudeCount_ * (localSolarTimeCount_ - 1)
+    );
+
+    for (std::atomic<double>& logDensity : logDensities)
+    {
+        logDensity.store(std::numeric_limits<double>::quiet_NaN(), std::memory_order_relaxed);
+    }
+
+    return std::make_shared<const Bucket>(Bucket {
+        startInstant,
+        sunLongitudeAtStart,
+        sunLongitudeChange / bucketDuration_,
+        std::move(logDensities),
+    });
+}
+
+double NRLMSISE00Grid::computeSunLongitudeAt(const Instant& anInstant) const
+{
+    const Shared<Celestial> sunCelestialSPtr = NRLMSISE00Model_.getSunCelestial();
+
+    if (sunCelestialSPtr != nullptr)
+    {
+        const Vector3d sunPosition =
+            sunCelestialSPtr->getPositionIn(NRLMSISE00Model_.getEarthFrame(), anInstant).getCoordinates();
+
+        return std::atan2(sunPosition.y(), sunPosition.x()) * 180.0 / M_PI;
+    }
+
+    // Mean Sun, consistent with the standard local solar time of the NRLMSISE00 model
+
+    const Time timeOfDay = anInstant.getDateTime(Scale::UTC).getTime();
+
+    return 180.0 - (timeOfDay.getHour() * 3600.0 + timeOfDay.getMinute() * 60.0 + timeOfDay.getSecond()) / 240.0;
+}
+
+void NRLMSISE00Grid::evaluateNodes(
+    const Bucket& aBucket,
+    const Stencil& anAltitudeStencil,
+    const Stencil& aLatitudeStencil,
+    const Stencil& aLocalSolarTimeStencil
+) const
+{
+    // Missing nodes are gathered on the stack: queries whose nodes are all evaluated do not allocate
+
+    struct Node
+    {
+        Size index;
+        Index timeIndex;
+        Index altitudeIndex;
+        Index latitudeIndex;
+        Index localSolarTimeIndex;
+    };
+
+    static constexpr Size maximumNodeCount = gridTimeFractions.size() * 2 * 4 * 4;
+
+    std::array<Node, maximumNodeCount> missingNodes;
+    Size missingNodeCount = 0;
+
+    for (Index timeIndex = 0; timeIndex < gridTimeFractions.size(); ++timeIndex)
+    {
+        for (Index altitudeIndex = anAltitudeStencil.firstIndex;
+             altitudeIndex < anAltitudeStencil.firstIndex + anAltitudeStencil.nodeCount;
+             ++altitudeIndex)
+        {
+            for (Index latitudeIndex = aLatitudeStencil.firstIndex;
+                 latitudeIndex < aLatitudeStencil.firstIndex + aLatitudeStencil.nodeCount;
+                 ++latitudeIndex)
+            {
+                for (Index localSolarTimeIndex = aLocalSolarTimeStencil.firstIndex;
+                     localSolarTimeIndex < aLocalSolarTimeStencil.firstIndex + aLocalSolarTimeStencil.nodeCount;
+                     ++localSolarTimeIndex)
+                {
+                    const Size nodeIndex = this->getIndex(timeIndex, altitudeIndex, latitudeIndex, localSolarTimeIndex);
+
+                    if (std::isnan(aBucket.logDensities[nodeIndex].load(std::memory_order_relaxed)))
+                    {
+                        missingNodes[missingNodeCount++] = {
+                            nodeIndex, timeIndex, altitudeIndex, latitudeIndex, localSolarTimeIndex
+                        };
+                    }
+                }
+            }
+        }
+    }
+
+    if (missingNodeCount == 0)
+    {
+        return;
+    }
+
+    const Length earthRadius = NRLMSISE00Model_.getEarthRadius();
+    const Real earthFlattening = NRLMSISE00Model_.getEarthFlattening();
+
+    PositionArray::Matrix3Xd coordinates(3, missingNodeCount);
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(missingNodeCount);
+
+    for (Index index = 0; index < missingNodeCount; ++index)
+    {
+        const Node& node = missingNodes[index];
+
+        const double elapsedTime = gridTimeFractions[node.timeIndex] * bucketDuration_;
+        const double sunLongitude = aBucket.sunLongitudeAtStart + aBucket.sunLongitudeRate * elapsedTime;
+
+        const double localSolarTime =
+            static_cast<double>(node.localSolarTimeIndex % (localSolarTimeCount_ - 1)) * localSolarTimeStep_;
+        const double longitude = std::remainder(sunLongitude + 15.0 * (localSolarTime - 12.0), 360.0);
+
+        coordinates.col(index) = LLA(Angle::Degrees(std::min(-90.0 + node.latitudeIndex * latitudeStep_, 90.0)),
+                                     Angle::Degrees(longitude),
+                                     Length::Kilometers(minimumAltitude_ + node.altitudeIndex * altitudeStep_))
+                                     .toCartesian(earthRadius, earthFlattening);
+
+        instants.add(aBucket.startInstant + Duration::Seconds(elapsedTime));
+    }
+
+    const VectorXd densities =
+        NRLMSISE00Model_.getDensitiesAt(PositionArray::Meters(coordinates, NRLMSISE00Model_.getEarthFrame()), instants);
+
+    for (Index index = 0; index < missingNodeCount; ++index)
+    {
+        aBucket.logDensities[missingNodes[index].index].store(std::log(densities(index)), std::memory_order_relaxed);
+    }
+}
+
+double NRLMSISE00Grid::interpolateLogDensity(
+    const Bucket& aBucket,
+    const double& anAltitude,
+    const double& aLatitude,
+    const double& aLocalSolarTime,
+    const double& anElapsedTime
+) const
+{
+    // The log density varies smoothly with altitude, and is interpolated linearly along it. Diurnal and latitudinal
+    // variations are interpolated cubically, as they bend too much over a cell for linear interpolation to be accurate.
+
+    const Stencil altitudeStencil = Locate(anAltitude, minimumAltitude_, altitudeStep_, altitudeCount_, 2);
+    const Stencil latitudeStencil = Locate(aLatitude, -90.0, latitudeStep_, latitudeCount_, 4);
+    const Stencil localSolarTimeStencil =
+        Locate(aLocalSolarTime, 0.0, localSolarTimeStep_, localSolarTimeCount_, 4, true);
+
+    this->evaluateNodes(aBucket, altitudeStencil, latitudeStencil, localSolarTimeStencil);
+
+    // Linear in time between both grids, and extrapolated over the first and last quarters of the bucket
+
+    const double timeFraction = (anElapsedTime / bucketDuration_ - gridTimeFractions[0]) /
+                                (gridTimeFractions[1] - gridTimeFractions[0]);
+
+    double logDensity = 0.0;
+
+    for (Index timeIndex = 0; timeIndex < gridTimeFractions.size(); ++timeIndex)
+    {
+        const double timeWeight = (timeIndex == 0) ? (1.0 - timeFraction) : timeFraction;
+
+        for (Index altitudeOffset = 0; altitudeOffset < altitudeStencil.nodeCount; ++altitudeOffset)
+        {
+            for (Index latitudeOffset = 0; latitudeOffset < latitudeStencil.nodeCount; ++latitudeOffset)
+            {
+                const double weight =
+                    timeWeight * altitudeStencil.weights[altitudeOffset] * latitudeStencil.weights[latitudeOffset];
+
+                for (Index localSolarTimeOffset = 0; localSolarTimeOffset < localSolarTimeStencil.nodeCount;
+                     ++localSolarTimeOffset)
+                {
+                    logDensity += weight * localSolarTimeStencil.weights[localSolarTimeOffset] *
+                                  aBucket.logDensities[this->getIndex(
+                                                           timeIndex,
+                                                           altitudeStencil.firstIndex + altitudeOffset,
+                                                           latitudeStencil.firstIndex + latitudeOffset,
+                                                           localSolarTimeStencil.firstIndex + localSolarTimeOffset
+                                                       )]
+                                      .load(std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    return logDensity;
+}
+
+Size NRLMSISE00Grid::getIndex(
+    const Size& aTimeIndex,
+    const Size& anAltitudeIndex,
+    const Size& aLatitudeIndex,
+    const Size& aLocalSolarTimeIndex
+) const
+{
+    // The last local solar time node wraps onto the first one
+
+    const Size storedLocalSolarTimeCount = localSolarTimeCount_ - 1;
+
+    return ((aTimeIndex * altitudeCount_ + anAltitudeIndex) * latitudeCount_ + aLatitudeIndex) *
+               storedLocalSolarTimeCount +
+           (aLocalSolarTimeIndex % storedLocalSolarTimeCount);
+}
+
+void NRLMSISE00Grid::copyCache(const NRLMSISE00Grid& aNRLMSISE00Grid)
+{
+    // Buckets are shared with the copied grid, cache entries are not: recency is tracked separately in both grids
+
+    CacheMap cache;
+
+    for (const auto& cacheEntry : *aNRLMSISE00Grid.cache_.load())
+    {
+        cache.emplace(cacheEntry.first, std::make_shared<const CacheEntry>(cacheEntry.second->bucketSPtr));
+    }
+
+    cache_.store(std::make_shared<const CacheMap>(std::move(cache)));
+    bucketIndices_ = aNRLMSISE00Grid.bucketIndices_;
+}
+
+NRLMSISE00Grid::Stencil NRLMSISE00Grid::Locate(
+    const double& aValue,
+    const double& aMinimum,
+    const double& aStep,
+    const Size& aCount,
+    const Size& aNodeCount,
+    const bool& isPeriodic
+)
+{
+    if (isPeriodic)
+    {
+        // The last node wraps onto the first one: the value is wrapped over the period, and the stencil is always
+        // centered on its cell. Node indices start a period later so as not to be negative, and are wrapped on use.
+
+        const Size periodNodeCount = aCount - 1;
+        const double period = static_cast<double>(periodNodeCount);
+
+        double position = std::fmod((aValue - aMinimum) / aStep, period);
+
+        if (position < 0.0)
+        {
+            position += period;
+        }
+
+        const Size cellIndex = std::min(static_cast<Size>(position), periodNodeCount - 1);
+        const Size firstIndex = cellIndex + periodNodeCount - ((aNodeCount / 2) - 1);
+
+        return NRLMSISE00Grid::Stencil {
+            firstIndex,
+            aNodeCount,
+            LagrangeWeights(position + period - static_cast<double>(firstIndex), aNodeCount),
+        };
+    }
+
+    // The value is clamped to the grid, and the stencil is centered on its cell, shifted inwards at the grid edges
+
+    const Size nodeCount = std::min(aNodeCount, aCount);
+
+    const double position = std::clamp((aValue - aMinimum) / aStep, 0.0, static_cast<double>(aCount - 1));
+    const Size cellIndex = std::min(static_cast<Size>(position), aCount - 2);
+    const Size firstIndex = std::min(cellIndex - std::min(cellIndex, (nodeCount / 2) - 1), aCount - nodeCount);
+
+    return NRLMSISE00Grid::Stencil {
+        firstIndex,
+        nodeCount,
+        LagrangeWeights(position - static_cast<double>(firstIndex), nodeCount),
+    };
+}
+
+}  // namespace earth
+}  // namespace atmospheric
+}  // namespace environment
+}  // namespace physics
+}  // namespace ostk
@@ -1,5 +1,8 @@
 /// Apache License 2.0
 
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Model.hpp>
 
 namespace ostk
@@ -11,10 +14,42 @@ namespace environment
 namespace atmospheric
 {
 
+using ostk::core::type::Index;
+
 Model::Model() {}
 
 Model::~Model() {}
 
+Pair<Real, Vector3d> Model::getDensityAndGradientAt(const Position& aPosition, const Instant& anInstant) const
+{
+    if (!aPosition.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position");
+    }
+
+    const Position position = aPosition.inMeters();
+    const Vector3d coordinates = position.accessCoordinates();
+
+    const Real density = this->getDensityAt(position, anInstant);
+
+    Vector3d gradient = Vector3d::Zero();
+
+    for (Index axisIndex = 0; axisIndex < 3; ++axisIndex)
+    {
+        Vector3d offset = Vector3d::Zero();
+        offset(axisIndex) = gradientStep;
+
+        const double forwardDensity =
+            this->getDensityAt(Position::Meters(coordinates + offset, position.accessFrame()), anInstant);
+        const double backwardDensity =
+            this->getDensityAt(Position::Meters(coordinates - offset, position.accessFrame()), anInstant);
+
+        gradient(axisIndex) = (forwardDensity - backwardDensity) / (2.0 * gradientStep);
+    }
+
+    return {density, gradient};
+}
+
 }  // namespace atmospheric
 }  // namespace environment
 }  // namespace physics
@@ -29,6 +29,11 @@ namespace physics
 using ostk::core::filesystem::Path;
 using ostk::core::type::String;
 
+Manager::~Manager()
+{
+    this->stopBackgroundRefresh();
+}
+
 Manager::Mode Manager::getMode() const
 {
     std::lock_guard<std::mutex> lock {mutex_};
@@ -88,6 +93,92 @@ void Manager::clearLocalRepository()
     setup_();
 }
 
+bool Manager::isBackgroundRefreshActive() const
+{
+    std::lock_guard<std::mutex> lock {refreshMutex_};
+
+    return refreshThread_.joinable();
+}
+
+void Manager::refresh()
+{
+    this->refresh_();
+}
+
+void Manager::startBackgroundRefresh(const Duration& aPeriod)
+{
+    if (!aPeriod.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Period");
+    }
+
+    if (!aPeriod.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Period");
+    }
+
+    this->stopBackgroundRefresh();
+
+    const std::chrono::duration<double> period {static_cast<double>(aPeriod.inSeconds())};
+
+    std::lock_guard<std::mutex> lock {refreshMutex_};
+
+    isRefreshStopRequested_ = false;
+
+    refreshThread_ = std::thread(
+        [this, period]() -> void
+        {
+            std::unique_lock<std::mutex> refreshLock {refreshMutex_};
+
+            while (!isRefreshStopRequested_)
+            {
+                refreshLock.unlock();
+
+                try
+                {
+                    this->refresh_();
+                }
+                catch (const std::exception& anException)
+                {
+                    std::cerr << String::Format("Error caught during background refresh: [{}].", anException.what())
+                              << std::endl;
+                }
+
+                refreshLock.lock();
+
+                refreshCondition_.wait_for(
+                    refreshLock,
+                    period,
+                    [this]() -> bool
+                    {
+                        return isRefreshStopRequested_;
+                    }
+                );
+            }
+        }
+    );
+}
+
+void Manager::stopBackgroundRefresh()
+{
+    std::thread refreshThread;
+
+    {
+        std::lock_guard<std::mutex> lock {refreshMutex_};
+
+        isRefreshStopRequested_ = true;
+
+        refreshThread = std::move(refreshThread_);
+    }
+
+    refreshCondition_.notify_all();
+
+    if (refreshThread.joinable())
+    {
+        refreshThread.join();
+    }
+}
+
 Manager::Manager(
     const String& aManagerModeEnvironmentVariableName,
     const Directory& aDefaultLocalRepositoryDirectory,
@@ -102,7 +193,11 @@ Manager::Manager(
       localRepositoryLockTimeoutEnvironmentVariableName_(aLocalRepositoryLockTimeoutEnvironmentVariableName),
       mode_(Manager::Mode::Automatic),
       localRepository_(Directory::Undefined()),
-      localRepositoryLockTimeout_(Duration::Undefined())
+      localRepositoryLockTimeout_(Duration::Undefined()),
+      refreshThread_(),
+      refreshMutex_(),
+      refreshCondition_(),
+      isRefreshStopRequested_(false)
 {
     reset();
     setup_();
@@ -116,6 +211,11 @@ void Manager::setup_()
     }
 }
 
+void Manager::refresh_()
+{
+    // Nothing to refresh by default
+}
+
 bool Manager::isLocalRepositoryLocked_() const
 {
     return getLocalRepositoryLockFile_().exists();
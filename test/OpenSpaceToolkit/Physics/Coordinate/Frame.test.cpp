@@ -6,15 +6,19 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Static.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 
 #include <Global.test.hpp>
 
 namespace iau = ostk::physics::coordinate::frame::provider::iau;
 
+using ostk::core::container::Array;
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
+using ostk::core::type::Uint64;
 
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
 using ostk::mathematics::geometry::d3::transformation::rotation::RotationMatrix;
@@ -30,6 +34,7 @@ using ostk::physics::coordinate::Position;
 using ostk::physics::coordinate::Transform;
 using ostk::physics::coordinate::Velocity;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Angle;
@@ -352,6 +357,34 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, AccessParent)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetId)
+{
+    {
+        EXPECT_EQ(customFrameSPtr_->getId(), customFrameSPtr_->getId());
+        EXPECT_NE(customFrameSPtr_->getId(), Frame::GCRF()->getId());
+    }
+
+    {
+        EXPECT_EQ(Frame::GCRF()->getId(), Frame::GCRF()->getId());
+        EXPECT_EQ(Frame::ITRF()->getId(), Frame::ITRF()->getId());
+        EXPECT_NE(Frame::GCRF()->getId(), Frame::ITRF()->getId());
+    }
+
+    {
+        const Uint64 previousId = customFrameSPtr_->getId();
+
+        Frame::Destruct(name_);
+
+        customFrameSPtr_ = Frame::Construct(name_, isQuasiInertial_, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_NE(previousId, customFrameSPtr_->getId());
+    }
+
+    {
+        EXPECT_ANY_THROW(Frame::Undefined()->getId());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetName)
 {
     {
@@ -617,6 +650,28 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetTransformTo)
         ));
     }
 
+    {
+        // Time invariant chain, folded into a single transform
+
+        const Instant epoch = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Shared<const Frame> modSPtr = Frame::MOD(epoch);
+        const Shared<const Frame> todSPtr = Frame::TOD(epoch, iau::Theory::IAU_2006);
+
+        const Quaternion q_TOD_MOD = todSPtr->accessProvider()->getTransformAt(epoch).getOrientation() *
+                                     modSPtr->accessProvider()->getTransformAt(epoch).getOrientation().toConjugate();
+
+        for (const Instant& instant : {epoch, epoch + Duration::Days(365.0)})
+        {
+            const Transform transform = modSPtr->getTransformTo(todSPtr, instant);
+
+            EXPECT_EQ(instant, transform.getInstant());
+
+            EXPECT_TRUE(transform.getOrientation().isNear(q_TOD_MOD, Angle::Degrees(1e-12)));
+            EXPECT_TRUE(transform.getAngularVelocity().isNear(Vector3d::Zero(), Real::Epsilon()));
+        }
+    }
+
     {
         EXPECT_ANY_THROW(Frame::Undefined()->getTransformTo(Frame::GCRF(), Instant::J2000()));
         EXPECT_ANY_THROW(Frame::GCRF()->getTransformTo(Frame::Undefined(), Instant::J2000()));
@@ -624,6 +679,72 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetTransformTo)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, GetTransformsTo)
+{
+    const Instant startInstant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (int index = 0; index < 10; ++index)
+    {
+        instants.add(startInstant + Duration::Minutes(10.0 * index));
+    }
+
+    {
+        const Array<Transform> transforms = Frame::GCRF()->getTransformsTo(Frame::GCRF(), instants);
+
+        ASSERT_EQ(instants.getSize(), transforms.getSize());
+
+        for (const auto& transform : transforms)
+        {
+            EXPECT_TRUE(transform.isIdentity());
+        }
+    }
+
+    {
+        EXPECT_TRUE(Frame::ITRF()->getTransformsTo(Frame::GCRF(), Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        const Array<std::pair<Shared<const Frame>, Shared<const Frame>>> framePairs = {
+            {Frame::ITRF(), Frame::GCRF()},
+            {Frame::GCRF(), Frame::ITRF()},
+            {Frame::TEME(), Frame::ITRF()},
+            {customFrameSPtr_, Frame::TIRF()},
+            {Frame::MOD(startInstant), Frame::TOD(startInstant, iau::Theory::IAU_2006)},
+        };
+
+        for (const auto& [fromFrameSPtr, toFrameSPtr] : framePairs)
+        {
+            const Array<Transform> transforms = fromFrameSPtr->getTransformsTo(toFrameSPtr, instants);
+
+            ASSERT_EQ(instants.getSize(), transforms.getSize());
+
+            for (Size index = 0; index < instants.getSize(); ++index)
+            {
+                const Transform referenceTransform = fromFrameSPtr->getTransformTo(toFrameSPtr, instants[index]);
+
+                EXPECT_EQ(instants[index], transforms[index].getInstant());
+
+                EXPECT_TRUE(transforms[index].getTranslation().isNear(referenceTransform.getTranslation(), 1e-9));
+                EXPECT_TRUE(transforms[index].getVelocity().isNear(referenceTransform.getVelocity(), 1e-9));
+                EXPECT_TRUE(transforms[index].getOrientation().isNear(
+                    referenceTransform.getOrientation(), Angle::Degrees(1e-12)
+                ));
+                EXPECT_TRUE(
+                    transforms[index].getAngularVelocity().isNear(referenceTransform.getAngularVelocity(), 1e-15)
+                );
+            }
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(Frame::Undefined()->getTransformsTo(Frame::GCRF(), instants));
+        EXPECT_ANY_THROW(Frame::GCRF()->getTransformsTo(Frame::Undefined(), instants));
+        EXPECT_ANY_THROW(Frame::GCRF()->getTransformsTo(Frame::ITRF(), {Instant::J2000(), Instant::Undefined()}));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, Undefined)
 {
     {
@@ -651,6 +772,16 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, MOD)
     {
         EXPECT_TRUE(Frame::MOD(Instant::J2000())->isDefined());
     }
+
+    {
+        const Instant epoch = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Shared<const Frame> frameSPtr = Frame::MOD(epoch);
+
+        EXPECT_EQ(frameSPtr, Frame::MOD(epoch));
+        EXPECT_EQ(frameSPtr, Frame::WithName(frameSPtr->getName()));
+        EXPECT_NE((*frameSPtr), (*Frame::MOD(epoch + Duration::Days(1.0))));
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, TOD)
@@ -658,6 +789,31 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, TOD)
     {
         EXPECT_TRUE(Frame::TOD(Instant::J2000(), iau::Theory::IAU_2000A)->isDefined());
     }
+
+    {
+        const Instant epoch = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Shared<const Frame> frameSPtr = Frame::TOD(epoch, iau::Theory::IAU_2006);
+
+        EXPECT_EQ(frameSPtr, Frame::TOD(epoch, iau::Theory::IAU_2006));
+        EXPECT_EQ(frameSPtr, Frame::WithName(frameSPtr->getName()));
+        EXPECT_NE((*frameSPtr), (*Frame::TOD(epoch, iau::Theory::IAU_2000A)));
+    }
+
+    {
+        const Instant epoch = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Shared<const Frame> frameSPtr = Frame::TOD(epoch, iau::Theory::IAU_2006);
+
+        Frame::Destruct(frameSPtr->getName());
+
+        EXPECT_FALSE(Frame::Exists(frameSPtr->getName()));
+
+        const Shared<const Frame> reconstructedFrameSPtr = Frame::TOD(epoch, iau::Theory::IAU_2006);
+
+        EXPECT_NE(frameSPtr, reconstructedFrameSPtr);
+        EXPECT_TRUE(Frame::Exists(reconstructedFrameSPtr->getName()));
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, TEME)
@@ -693,6 +849,23 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, ITRF)
     {
         EXPECT_TRUE(Frame::ITRF()->isDefined());
     }
+
+    {
+        EXPECT_EQ(Frame::ITRF(), Frame::ITRF());
+        EXPECT_EQ(Frame::ITRF(), Frame::WithName("ITRF"));
+    }
+
+    {
+        const Shared<const Frame> frameSPtr = Frame::ITRF();
+
+        Frame::Destruct("ITRF");
+
+        EXPECT_FALSE(Frame::Exists("ITRF"));
+
+        EXPECT_NE(frameSPtr, Frame::ITRF());
+        EXPECT_EQ(Frame::ITRF(), Frame::WithName("ITRF"));
+        EXPECT_EQ(Frame::TIRF(), Frame::ITRF()->accessParent());
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame, WithName)
@@ -1,7 +1,11 @@
 /// Apache License 2.0
 
+#include <atomic>
+#include <thread>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
@@ -13,6 +17,7 @@
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Static.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
 
@@ -20,7 +25,9 @@
 
 using ostk::core::container::Array;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
+using ostk::core::type::Uint64;
 
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
 using ostk::mathematics::geometry::d3::transformation::rotation::RotationVector;
@@ -32,6 +39,7 @@ using ostk::physics::coordinate::frame::Provider;
 using ostk::physics::coordinate::frame::provider::Static;
 using ostk::physics::coordinate::Transform;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Angle;
@@ -73,6 +81,10 @@ class OpenSpaceToolkit_Physics_Coordinate_Frame_Manager : public ::testing::Test
         {
             Frame::Destruct("TestFrame3");
         }
+        if (Frame::Exists("TestFrame4"))
+        {
+            Frame::Destruct("TestFrame4");
+        }
     }
 
     Manager* manager_;
@@ -390,3 +402,201 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, AccessCachedTransform_
         EXPECT_FALSE(cachedMiss2.isDefined());
     }
 }
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, AccessCachedTransform_Concurrent)
+{
+    {
+        const Shared<const Frame> gcrfSPtr = Frame::GCRF();
+        const Shared<const Frame> itrfSPtr = Frame::ITRF();
+
+        Array<Instant> instants = Array<Instant>::Empty();
+        Array<Transform> forwardTransforms = Array<Transform>::Empty();
+        Array<Transform> reverseTransforms = Array<Transform>::Empty();
+
+        for (int index = 0; index < 64; ++index)
+        {
+            const Instant instant = Instant::J2000() + Duration::Minutes(index);
+
+            instants.add(instant);
+            forwardTransforms.add(gcrfSPtr->getTransformTo(itrfSPtr, instant));
+            reverseTransforms.add(itrfSPtr->getTransformTo(gcrfSPtr, instant));
+        }
+
+        std::atomic<bool> isConsistent {true};
+
+        Array<std::thread> threads = Array<std::thread>::Empty();
+
+        for (int threadIndex = 0; threadIndex < 8; ++threadIndex)
+        {
+            threads.add(std::thread(
+                [&]()
+                {
+                    for (int iteration = 0; iteration < 16; ++iteration)
+                    {
+                        for (Size index = 0; index < instants.getSize(); ++index)
+                        {
+                            const Transform forward = gcrfSPtr->getTransformTo(itrfSPtr, instants[index]);
+                            const Transform reverse = itrfSPtr->getTransformTo(gcrfSPtr, instants[index]);
+
+                            if ((forward != forwardTransforms[index]) || (reverse != reverseTransforms[index]))
+                            {
+                                isConsistent = false;
+                            }
+                        }
+                    }
+                }
+            ));
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_TRUE(isConsistent);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, ClearCachedTransforms)
+{
+    {
+        const Shared<const Frame> frameSPtr1 = Frame::Construct("TestFrame1", true, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> frameSPtr2 = Frame::Construct("TestFrame2", true, Frame::GCRF(), providerSPtr_);
+        const Instant instant = Instant::J2000();
+
+        const Transform transform = Transform::Passive(
+            instant, Vector3d(1.0, 0.0, 0.0), Vector3d::Zero(), Quaternion::Unit(), Vector3d::Zero()
+        );
+
+        manager_->addCachedTransform(frameSPtr1, frameSPtr2, instant, transform);
+
+        // Populates the thread-local cache
+
+        EXPECT_TRUE(manager_->accessCachedTransform(frameSPtr1, frameSPtr2, instant).isDefined());
+        EXPECT_TRUE(manager_->accessCachedTransform(frameSPtr1, frameSPtr2, instant).isDefined());
+
+        manager_->clearCachedTransforms();
+
+        EXPECT_FALSE(manager_->accessCachedTransform(frameSPtr1, frameSPtr2, instant).isDefined());
+        EXPECT_FALSE(manager_->accessCachedTransform(frameSPtr2, frameSPtr1, instant).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, AddCachedTransform_Generation)
+{
+    {
+        const Shared<const Frame> frameSPtr1 = Frame::Construct("TestFrame1", true, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> frameSPtr2 = Frame::Construct("TestFrame2", true, Frame::GCRF(), providerSPtr_);
+        const Instant instant = Instant::J2000();
+
+        const Transform transform = Transform::Passive(
+            instant, Vector3d(1.0, 0.0, 0.0), Vector3d::Zero(), Quaternion::Unit(), Vector3d::Zero()
+        );
+
+        // Transform computed before an invalidation of the cache
+
+        const Uint64 generation = manager_->getTransformCacheGeneration();
+
+        manager_->clearCachedTransforms();
+
+        EXPECT_NE(generation, manager_->getTransformCacheGeneration());
+
+        manager_->addCachedTransform(frameSPtr1, frameSPtr2, instant, transform, generation);
+
+        EXPECT_FALSE(manager_->accessCachedTransform(frameSPtr1, frameSPtr2, instant).isDefined());
+        EXPECT_FALSE(manager_->accessCachedTransform(frameSPtr2, frameSPtr1, instant).isDefined());
+
+        // Transform computed at the current generation
+
+        manager_->addCachedTransform(
+            frameSPtr1, frameSPtr2, instant, transform, manager_->getTransformCacheGeneration()
+        );
+
+        EXPECT_TRUE(manager_->accessCachedTransform(frameSPtr1, frameSPtr2, instant).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, AccessTransformPlan)
+{
+    {
+        const Shared<const Frame> frameSPtr1 = Frame::Construct("TestFrame1", true, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> frameSPtr2 = Frame::Construct("TestFrame2", true, frameSPtr1, providerSPtr_);
+
+        // Plan is not computed until a transform is requested
+
+        EXPECT_EQ(nullptr, manager_->accessTransformPlan(frameSPtr2, Frame::GCRF()));
+
+        EXPECT_NO_THROW(frameSPtr2->getTransformTo(Frame::GCRF(), Instant::J2000()));
+
+        const Shared<const Manager::TransformPlan> planSPtr =
+            manager_->accessTransformPlan(frameSPtr2, Frame::GCRF());
+
+        ASSERT_NE(nullptr, planSPtr);
+
+        EXPECT_EQ(2, planSPtr->originProviders.getSize());
+        EXPECT_EQ(0, planSPtr->destinationProviders.getSize());
+
+        // Reverse plan is stored as well
+
+        const Shared<const Manager::TransformPlan> reversePlanSPtr =
+            manager_->accessTransformPlan(Frame::GCRF(), frameSPtr2);
+
+        ASSERT_NE(nullptr, reversePlanSPtr);
+
+        EXPECT_EQ(0, reversePlanSPtr->originProviders.getSize());
+        EXPECT_EQ(2, reversePlanSPtr->destinationProviders.getSize());
+    }
+
+    {
+        const Shared<const Frame> frameSPtr1 = Frame::Construct("TestFrame3", true, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_NO_THROW(frameSPtr1->getTransformTo(Frame::ITRF(), Instant::J2000()));
+
+        EXPECT_NE(nullptr, manager_->accessTransformPlan(frameSPtr1, Frame::ITRF()));
+
+        manager_->removeFrameWithName("TestFrame3");
+
+        EXPECT_EQ(nullptr, manager_->accessTransformPlan(frameSPtr1, Frame::ITRF()));
+        EXPECT_EQ(nullptr, manager_->accessTransformPlan(Frame::ITRF(), frameSPtr1));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Manager, AddTransformPlan)
+{
+    {
+        const Shared<const Frame> frameSPtr1 = Frame::Construct("TestFrame1", true, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> frameSPtr2 = Frame::Construct("TestFrame2", true, Frame::GCRF(), providerSPtr_);
+
+        const Manager::TransformPlan plan = {{providerSPtr_}, {providerSPtr_, providerSPtr_}};
+
+        manager_->addTransformPlan(frameSPtr1, frameSPtr2, std::make_shared<const Manager::TransformPlan>(plan));
+
+        const Shared<const Manager::TransformPlan> planSPtr = manager_->accessTransformPlan(frameSPtr1, frameSPtr2);
+        const Shared<const Manager::TransformPlan> reversePlanSPtr =
+            manager_->accessTransformPlan(frameSPtr2, frameSPtr1);
+
+        ASSERT_NE(nullptr, planSPtr);
+        ASSERT_NE(nullptr, reversePlanSPtr);
+
+        EXPECT_EQ(1, planSPtr->originProviders.getSize());
+        EXPECT_EQ(2, planSPtr->destinationProviders.getSize());
+
+        EXPECT_EQ(2, reversePlanSPtr->originProviders.getSize());
+        EXPECT_EQ(1, reversePlanSPtr->destinationProviders.getSize());
+
+        // Plans are kept when other frames are registered
+
+        Frame::Construct("TestFrame4", true, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_EQ(planSPtr, manager_->accessTransformPlan(frameSPtr1, frameSPtr2));
+        EXPECT_EQ(reversePlanSPtr, manager_->accessTransformPlan(frameSPtr2, frameSPtr1));
+    }
+
+    {
+        const Shared<const Frame> frameSPtr1 = Frame::Construct("TestFrame3", true, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_THROW(
+            manager_->addTransformPlan(frameSPtr1, Frame::GCRF(), nullptr), ostk::core::error::runtime::Undefined
+        );
+    }
+}
@@ -0,0 +1,96 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Unique.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/CIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Unique;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::frame::provider::CIRF;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF, GetMode)
+{
+    {
+        EXPECT_EQ(CIRF::Mode::Series, CIRF().getMode());
+        EXPECT_EQ(CIRF::Mode::Table, CIRF(CIRF::Mode::Table).getMode());
+    }
+
+    {
+        const Unique<CIRF> clonePtr(CIRF(CIRF::Mode::Table).clone());
+
+        EXPECT_EQ(CIRF::Mode::Table, clonePtr->getMode());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF, GetTransformAt)
+{
+    {
+        const CIRF seriesProvider = {CIRF::Mode::Series};
+        const CIRF tableProvider = {CIRF::Mode::Table};
+
+        // Includes grid nodes (midnight and noon TT) and instants before MJD 0
+
+        const Array<Instant> instants = {
+            Instant::J2000(),
+            Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::TT),
+            Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC),
+            Instant::DateTime(DateTime(2023, 6, 15, 7, 31, 12, 345), Scale::UTC),
+            Instant::DateTime(DateTime(1850, 3, 1, 19, 0, 0), Scale::TT),
+        };
+
+        for (const auto& instant : instants)
+        {
+            for (const Duration& offset : {Duration::Zero(), Duration::Hours(5.5), Duration::Days(17.3)})
+            {
+                const Transform seriesTransform = seriesProvider.getTransformAt(instant + offset);
+                const Transform tableTransform = tableProvider.getTransformAt(instant + offset);
+
+                EXPECT_EQ(seriesTransform.getInstant(), tableTransform.getInstant());
+
+                for (const Vector3d& axis : {Vector3d::UnitX(), Vector3d::UnitY(), Vector3d::UnitZ()})
+                {
+                    const Vector3d seriesAxis = seriesTransform.accessOrientation() * axis;
+                    const Vector3d tableAxis = tableTransform.accessOrientation() * axis;
+
+                    EXPECT_GT(1e-12, (tableAxis - seriesAxis).norm()) << (instant + offset).toString();
+                }
+            }
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            CIRF(CIRF::Mode::Table).getTransformAt(Instant::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_CIRF, PrecomputeTable)
+{
+    {
+        const Instant startInstant = Instant::DateTime(DateTime(2024, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_NO_THROW(CIRF::PrecomputeTable(Interval::Closed(startInstant, startInstant + Duration::Days(100.0))));
+    }
+
+    {
+        EXPECT_THROW(CIRF::PrecomputeTable(Interval::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
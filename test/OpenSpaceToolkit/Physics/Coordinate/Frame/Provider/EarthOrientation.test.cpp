@@ -0,0 +1,159 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Unique.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/CIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/EarthOrientation.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/ITRF.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/TIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Unique;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::frame::provider::CIRF;
+using ostk::physics::coordinate::frame::provider::EarthOrientation;
+using ostk::physics::coordinate::frame::provider::ITRF;
+using ostk::physics::coordinate::frame::provider::TIRF;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientation, GetCirfMode)
+{
+    {
+        EXPECT_EQ(CIRF::Mode::Series, EarthOrientation().getCirfMode());
+        EXPECT_EQ(CIRF::Mode::Table, EarthOrientation(CIRF::Mode::Table).getCirfMode());
+    }
+
+    {
+        const Unique<EarthOrientation> clonePtr(EarthOrientation(CIRF::Mode::Table).clone());
+
+        EXPECT_EQ(CIRF::Mode::Table, clonePtr->getCirfMode());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientation, GetTransformAt)
+{
+    {
+        const Array<Instant> instants = {
+            Instant::J2000(),
+            Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+            Instant::DateTime(DateTime(2020, 6, 15, 7, 31, 12, 345), Scale::UTC),
+            Instant::DateTime(DateTime(2021, 12, 31, 23, 59, 59), Scale::UTC),
+        };
+
+        for (const CIRF::Mode& mode : {CIRF::Mode::Series, CIRF::Mode::Table})
+        {
+            const EarthOrientation earthOrientation = {mode};
+
+            const ITRF itrf;
+            const TIRF tirf;
+            const CIRF cirf = {mode};
+
+            for (const auto& instant : instants)
+            {
+                for (const Duration& offset : {Duration::Zero(), Duration::Hours(5.5), Duration::Days(17.3)})
+                {
+                    const Instant queryInstant = instant + offset;
+
+                    const Transform referenceTransform = itrf.getTransformAt(queryInstant) *
+                                                         tirf.getTransformAt(queryInstant) *
+                                                         cirf.getTransformAt(queryInstant);
+                    const Transform transform = earthOrientation.getTransformAt(queryInstant);
+
+                    EXPECT_EQ(queryInstant, transform.getInstant());
+
+                    for (const Vector3d& axis : {Vector3d::UnitX(), Vector3d::UnitY(), Vector3d::UnitZ()})
+                    {
+                        const Vector3d rotatedAxis = transform.accessOrientation() * axis;
+                        const Vector3d referenceRotatedAxis = referenceTransform.accessOrientation() * axis;
+
+                        EXPECT_GT(1e-14, (rotatedAxis - referenceRotatedAxis).norm()) << queryInstant.toString();
+                    }
+
+                    EXPECT_GT(1e-18, (transform.getAngularVelocity() - referenceTransform.getAngularVelocity()).norm())
+                        << queryInstant.toString();
+
+                    EXPECT_EQ(referenceTransform.getTranslation(), transform.getTranslation());
+                    EXPECT_EQ(referenceTransform.getVelocity(), transform.getVelocity());
+                }
+            }
+        }
+    }
+
+    {
+        EXPECT_THROW(EarthOrientation().getTransformAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_EarthOrientation, GetTransformsAt)
+{
+    const Array<Instant> instants = {
+        Instant::J2000(),
+        Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+        Instant::DateTime(DateTime(2020, 6, 15, 7, 31, 12, 345), Scale::UTC),
+        Instant::DateTime(DateTime(2020, 6, 15, 13, 1, 42, 678), Scale::UTC),
+        Instant::DateTime(DateTime(2021, 12, 31, 23, 59, 59), Scale::UTC),
+    };
+
+    {
+        for (const CIRF::Mode& mode : {CIRF::Mode::Series, CIRF::Mode::Table})
+        {
+            const EarthOrientation earthOrientation = {mode};
+            const CIRF cirf = {mode};
+
+            const Array<Transform> earthOrientationTransforms = earthOrientation.getTransformsAt(instants);
+            const Array<Transform> cirfTransforms = cirf.getTransformsAt(instants);
+
+            ASSERT_EQ(instants.getSize(), earthOrientationTransforms.getSize());
+            ASSERT_EQ(instants.getSize(), cirfTransforms.getSize());
+
+            for (std::size_t index = 0; index < instants.getSize(); ++index)
+            {
+                EXPECT_EQ(earthOrientation.getTransformAt(instants[index]), earthOrientationTransforms[index]);
+                EXPECT_EQ(cirf.getTransformAt(instants[index]), cirfTransforms[index]);
+            }
+        }
+    }
+
+    {
+        const ITRF itrf;
+        const TIRF tirf;
+
+        const Array<Transform> itrfTransforms = itrf.getTransformsAt(instants);
+        const Array<Transform> tirfTransforms = tirf.getTransformsAt(instants);
+
+        ASSERT_EQ(instants.getSize(), itrfTransforms.getSize());
+        ASSERT_EQ(instants.getSize(), tirfTransforms.getSize());
+
+        for (std::size_t index = 0; index < instants.getSize(); ++index)
+        {
+            EXPECT_EQ(itrf.getTransformAt(instants[index]), itrfTransforms[index]);
+            EXPECT_EQ(tirf.getTransformAt(instants[index]), tirfTransforms[index]);
+        }
+    }
+
+    {
+        EXPECT_TRUE(EarthOrientation().getTransformsAt(Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        const Array<Instant> undefinedInstants = {Instant::J2000(), Instant::Undefined()};
+
+        EXPECT_THROW(EarthOrientation().getTransformsAt(undefinedInstants), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(CIRF().getTransformsAt(undefinedInstants), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(TIRF().getTransformsAt(undefinedInstants), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(ITRF().getTransformsAt(undefinedInstants), ostk::core::error::runtime::Undefined);
+    }
+}
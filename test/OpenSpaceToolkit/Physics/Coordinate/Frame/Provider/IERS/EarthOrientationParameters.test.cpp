@@ -0,0 +1,58 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/EarthOrientationParameters.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+
+using ostk::mathematics::object::Vector2d;
+
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EarthOrientationParameters, IsDefined)
+{
+    {
+        const EarthOrientationParameters eop = {
+            EarthOrientationParameters::Source::Finals2000A,
+            {0.1, 0.2},
+            0.3,
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined()
+        };
+
+        EXPECT_TRUE(eop.isDefined());
+    }
+
+    {
+        EXPECT_FALSE(EarthOrientationParameters::Undefined().isDefined());
+
+        const EarthOrientationParameters eop = {
+            EarthOrientationParameters::Source::Undefined, {0.1, 0.2}, 0.3, 0.4, 0.5, 0.6
+        };
+
+        EXPECT_FALSE(eop.isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_EarthOrientationParameters, StringFromSource)
+{
+    {
+        EXPECT_EQ(
+            "Undefined", EarthOrientationParameters::StringFromSource(EarthOrientationParameters::Source::Undefined)
+        );
+        EXPECT_EQ(
+            "Bulletin A Observation",
+            EarthOrientationParameters::StringFromSource(EarthOrientationParameters::Source::BulletinAObservation)
+        );
+        EXPECT_EQ(
+            "Bulletin A Prediction",
+            EarthOrientationParameters::StringFromSource(EarthOrientationParameters::Source::BulletinAPrediction)
+        );
+        EXPECT_EQ(
+            "Finals 2000A",
+            EarthOrientationParameters::StringFromSource(EarthOrientationParameters::Source::Finals2000A)
+        );
+    }
+}
@@ -1,5 +1,14 @@
 /// Apache License 2.0
 
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
@@ -10,6 +19,8 @@
 #include <OpenSpaceToolkit/IO/URL.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Manifest.hpp>
 
 #include <Global.test.hpp>
 
@@ -19,7 +30,9 @@ using ostk::core::container::Tuple;
 using ostk::core::filesystem::Directory;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Shared;
 using ostk::core::type::String;
 
 using ostk::io::URL;
@@ -27,13 +40,18 @@ using ostk::io::URL;
 using ostk::mathematics::object::Vector2d;
 
 using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
 using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
 using ostk::physics::coordinate::frame::provider::iers::Manager;
+using ostk::physics::coordinate::frame::provider::iers::Snapshot;
 using ostk::physics::time::DateTime;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 
+using ostk::physics::data::Manifest;
+using ManifestManager = ostk::physics::data::Manager;
+
 class OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager : public ::testing::Test
 {
    protected:
@@ -248,6 +266,154 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetFinal
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetSnapshot)
+{
+    {
+        manager_.reset();
+        manager_.loadBulletinA(bulletinA_);
+        manager_.loadFinals2000A(finals2000A_);
+
+        const Shared<const Snapshot> snapshotSPtr = manager_.getSnapshot();
+
+        ASSERT_NE(nullptr, snapshotSPtr);
+        EXPECT_TRUE(snapshotSPtr->hasBulletinA());
+        EXPECT_TRUE(snapshotSPtr->hasFinals2000A());
+
+        // Reads outside of the manager mutex share the published snapshot
+
+        EXPECT_EQ(snapshotSPtr, manager_.getSnapshot());
+
+        const Instant instant = Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_EQ(manager_.getPolarMotionAt(instant), snapshotSPtr->getPolarMotionAt(instant));
+        EXPECT_EQ(manager_.getUt1MinusUtcAt(instant), snapshotSPtr->getUt1MinusUtcAt(instant));
+        EXPECT_EQ(manager_.getLodAt(instant), snapshotSPtr->getLodAt(instant));
+
+        // Loading a bulletin publishes a new snapshot, pinned snapshots are left untouched
+
+        manager_.loadBulletinA(bulletinA_);
+
+        EXPECT_NE(snapshotSPtr, manager_.getSnapshot());
+
+        manager_.reset();
+
+        EXPECT_TRUE(snapshotSPtr->hasBulletinA());
+        EXPECT_TRUE(snapshotSPtr->hasFinals2000A());
+        EXPECT_EQ(snapshotSPtr->getUt1MinusUtcAt(instant), finals2000A_.getUt1MinusUtcAt(instant));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetSnapshot_OneBulletin)
+{
+    // A missing bulletin is searched for once: the snapshot records the attempt and is then returned without the
+    // manager mutex
+
+    {
+        manager_.reset();
+        manager_.setMode(Manager::Mode::Manual);
+
+        Directory emptyDirectory = Directory::Path(
+            Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/bulletin-A/Temp")
+        );
+        manager_.setLocalRepository(emptyDirectory);
+
+        manager_.loadBulletinA(bulletinA_);
+
+        const Shared<const Snapshot> snapshotSPtr = manager_.getSnapshot();
+
+        EXPECT_TRUE(snapshotSPtr->hasBulletinA());
+        EXPECT_FALSE(snapshotSPtr->hasFinals2000A());
+        EXPECT_TRUE(snapshotSPtr->isBulletinAResolved());
+        EXPECT_TRUE(snapshotSPtr->isFinals2000AResolved());
+
+        EXPECT_EQ(snapshotSPtr, manager_.getSnapshot());
+
+        const Instant instant = bulletinA_.accessObservationInterval().accessStart();
+
+        EXPECT_EQ(snapshotSPtr->getPolarMotionAt(instant), manager_.getPolarMotionAt(instant));
+        EXPECT_EQ(snapshotSPtr, manager_.getSnapshot());
+
+        manager_.setMode(Manager::Mode::Automatic);
+        manager_.setLocalRepository(localRepositoryDirectory);
+        emptyDirectory.remove();
+    }
+
+    // Polar motion and UT1 - UTC covered by Bulletin A do not need Finals 2000A
+
+    {
+        manager_.reset();
+        manager_.setMode(Manager::Mode::Manual);
+
+        Directory emptyDirectory = Directory::Path(
+            Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/bulletin-A/Temp")
+        );
+        manager_.setLocalRepository(emptyDirectory);
+
+        manager_.loadBulletinA(bulletinA_);
+
+        const Instant coveredInstant = bulletinA_.accessObservationInterval().accessStart();
+        const BulletinA::Observation observation = bulletinA_.getObservationAt(coveredInstant);
+
+        EXPECT_EQ(Vector2d(observation.x, observation.y), manager_.getPolarMotionAt(coveredInstant));
+        EXPECT_EQ(observation.ut1MinusUtc, manager_.getUt1MinusUtcAt(coveredInstant));
+
+        const Instant uncoveredInstant = Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_THROW(manager_.getPolarMotionAt(uncoveredInstant), ostk::core::error::RuntimeError);
+
+        manager_.setMode(Manager::Mode::Automatic);
+        manager_.setLocalRepository(localRepositoryDirectory);
+        emptyDirectory.remove();
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetEopAt)
+{
+    {
+        manager_.reset();
+        manager_.loadBulletinA(bulletinA_);
+        manager_.loadFinals2000A(finals2000A_);
+
+        const Array<Instant> instants = {
+            Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC),
+            Instant::DateTime(DateTime(2000, 1, 1, 12, 34, 56), Scale::UTC),
+            bulletinA_.accessObservationInterval().accessStart() + Duration::Hours(5.0),
+            bulletinA_.accessPredictionInterval().accessStart() + Duration::Hours(5.0),
+        };
+
+        const Array<EarthOrientationParameters> earthOrientationParameters = manager_.getEopAt(instants);
+
+        ASSERT_EQ(instants.getSize(), earthOrientationParameters.getSize());
+
+        for (Index index = 0; index < instants.getSize(); ++index)
+        {
+            const Instant& instant = instants[index];
+            const EarthOrientationParameters eop = manager_.getEopAt(instant);
+
+            EXPECT_TRUE(eop.isDefined());
+
+            EXPECT_EQ(manager_.getPolarMotionAt(instant), eop.polarMotion);
+            EXPECT_EQ(manager_.getUt1MinusUtcAt(instant), eop.ut1MinusUtc);
+
+            EXPECT_EQ(eop.source, earthOrientationParameters[index].source);
+            EXPECT_EQ(eop.polarMotion, earthOrientationParameters[index].polarMotion);
+            EXPECT_EQ(eop.ut1MinusUtc, earthOrientationParameters[index].ut1MinusUtc);
+        }
+
+        EXPECT_EQ(EarthOrientationParameters::Source::Finals2000A, earthOrientationParameters[0].source);
+        EXPECT_EQ(manager_.getLodAt(instants[0]), earthOrientationParameters[0].lod);
+        EXPECT_EQ(finals2000A_.getDataAt(instants[1]).dx_A, earthOrientationParameters[1].dx);
+        EXPECT_EQ(finals2000A_.getDataAt(instants[1]).dy_A, earthOrientationParameters[1].dy);
+
+        EXPECT_EQ(EarthOrientationParameters::Source::BulletinAObservation, earthOrientationParameters[2].source);
+        EXPECT_EQ(EarthOrientationParameters::Source::BulletinAPrediction, earthOrientationParameters[3].source);
+    }
+
+    {
+        EXPECT_THROW(manager_.getEopAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, GetPolarMotionAt_Past)
 {
     {
@@ -490,6 +656,219 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, FetchLat
     }
 }
 
+class TestManager : public Manager
+{
+    // Create a manager whose fetches copy local bulletins, so that refreshes can be tested without a remote
+   public:
+    MOCK_METHOD(File, fetchLatestBulletinA_, (), (const, override));
+    MOCK_METHOD(File, fetchLatestFinals2000A_, (), (const, override));
+};
+
+class OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager_Refresh
+    : public OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager
+{
+   protected:
+    void SetUp() override
+    {
+        OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager::SetUp();
+
+        ManifestManager& manifestManager = ManifestManager::Get();
+
+        manifestManagerMode_ = manifestManager.getMode();
+        manifestManagerRemoteUrl_ = manifestManager.getRemoteUrl();
+
+        repositoryPath_ =
+            std::filesystem::temp_directory_path() / ("ostk-test-iers-refresh-" + std::to_string(::getpid()));
+
+        std::filesystem::remove_all(repositoryPath_);
+        std::filesystem::create_directories(repositoryPath_);
+
+        testManager_.setMode(Manager::Mode::Automatic);
+        testManager_.setLocalRepository(Directory::Path(Path::Parse((repositoryPath_ / "iers").string())));
+
+        this->loadManifestWithLastUpdate("2020-01-01T00:00:00.000000");
+    }
+
+    void TearDown() override
+    {
+        testManager_.stopBackgroundRefresh();
+
+        ManifestManager& manifestManager = ManifestManager::Get();
+
+        manifestManager.reset();
+        manifestManager.setMode(manifestManagerMode_);
+        manifestManager.setRemoteUrl(manifestManagerRemoteUrl_);
+
+        std::filesystem::remove_all(repositoryPath_);
+
+        OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager::TearDown();
+    }
+
+    // Load a manifest in which bulletins were last updated on the remote at the given timestamp. The manifest does
+    // not need to be refreshed, so that the manifest manager does not fetch either.
+
+    void loadManifestWithLastUpdate(const String& aLastUpdateTimestamp) const
+    {
+        const std::filesystem::path manifestPath = repositoryPath_ / "manifest.json";
+
+        {
+            std::ofstream manifestStream {manifestPath};
+
+            manifestStream << String::Format(
+                R"({{
+    "manifest": {{
+        "path": "",
+        "filenames": "manifest.json",
+        "last_update": "2020-01-01T00:00:00.000000",
+        "next_update_check": "2100-01-01T00:00:00.000000",
+        "check_frequency": "6 hours"
+    }},
+    "bulletin-A": {{
+        "path": "coordinate/frame/providers/iers/bulletin-A",
+        "filenames": "ser7.dat",
+        "last_update": "{}",
+        "next_update_check": "2100-01-01T00:00:00.000000",
+        "check_frequency": "1 day"
+    }},
+    "finals-2000A": {{
+        "path": "coordinate/frame/providers/iers/finals-2000A",
+        "filenames": "finals2000A.data",
+        "last_update": "{}",
+        "next_update_check": "2100-01-01T00:00:00.000000",
+        "check_frequency": "1 day"
+    }}
+}})",
+                aLastUpdateTimestamp,
+                aLastUpdateTimestamp
+            );
+        }
+
+        ManifestManager& manifestManager = ManifestManager::Get();
+
+        manifestManager.reset();
+        manifestManager.setMode(ManifestManager::Mode::Manual);
+        manifestManager.loadManifest(Manifest::Load(File::Path(Path::Parse(manifestPath.string()))));
+    }
+
+    // Copy a bulletin into a directory of the local repository, as fetching it from the remote would
+
+    static File StageFile(const File& aFile, const Directory& aDirectory, const String& aFileName)
+    {
+        const std::filesystem::path destinationPath =
+            std::filesystem::path(std::string(aDirectory.getPath().toString())) / std::string(aFileName);
+
+        std::filesystem::copy_file(
+            std::string(aFile.getPath().toString()),
+            destinationPath,
+            std::filesystem::copy_options::overwrite_existing
+        );
+
+        return File::Path(Path::Parse(destinationPath.string()));
+    }
+
+    testing::StrictMock<TestManager> testManager_;
+
+    std::filesystem::path repositoryPath_;
+
+    ManifestManager::Mode manifestManagerMode_ = ManifestManager::Mode::Automatic;
+    URL manifestManagerRemoteUrl_ = URL::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager_Refresh, Refresh)
+{
+    const auto fetchBulletinA = [this]() -> File
+    {
+        return StageFile(bulletinAFile_, testManager_.getBulletinADirectory(), "ser7.dat");
+    };
+
+    const auto fetchFinals2000A = [this]() -> File
+    {
+        return StageFile(finals2000AFile_, testManager_.getFinals2000ADirectory(), "finals2000A.data");
+    };
+
+    const std::filesystem::path localBulletinAPath = repositoryPath_ / "iers/bulletin-A/ser7.dat";
+    const std::filesystem::path localFinals2000APath = repositoryPath_ / "iers/finals-2000A/finals2000A.data";
+
+    // Nothing loaded and no local files: bulletins are fetched and published
+
+    {
+        EXPECT_CALL(testManager_, fetchLatestBulletinA_()).WillOnce(testing::Invoke(fetchBulletinA));
+        EXPECT_CALL(testManager_, fetchLatestFinals2000A_()).WillOnce(testing::Invoke(fetchFinals2000A));
+
+        EXPECT_NO_THROW(testManager_.refresh());
+
+        testing::Mock::VerifyAndClearExpectations(&testManager_);
+
+        EXPECT_TRUE(std::filesystem::exists(localBulletinAPath));
+        EXPECT_TRUE(std::filesystem::exists(localFinals2000APath));
+
+        const Shared<const Snapshot> snapshotSPtr = testManager_.getSnapshot();
+
+        EXPECT_TRUE(snapshotSPtr->hasBulletinA());
+        EXPECT_TRUE(snapshotSPtr->hasFinals2000A());
+
+        EXPECT_EQ(bulletinA_.getObservationInterval(), snapshotSPtr->accessBulletinA()->getObservationInterval());
+        EXPECT_EQ(finals2000A_.getInterval(), snapshotSPtr->accessFinals2000A()->getInterval());
+    }
+
+    // Loaded bulletins are newer than the remote: nothing is fetched, the snapshot is kept
+
+    {
+        const Shared<const Snapshot> snapshotSPtr = testManager_.getSnapshot();
+
+        EXPECT_NO_THROW(testManager_.refresh());
+
+        EXPECT_EQ(snapshotSPtr, testManager_.getSnapshot());
+    }
+
+    // The remote is newer than loaded bulletins and local files: bulletins are fetched again and a new snapshot is
+    // published
+
+    {
+        this->loadManifestWithLastUpdate("2099-01-01T00:00:00.000000");
+
+        const Shared<const Snapshot> snapshotSPtr = testManager_.getSnapshot();
+
+        EXPECT_CALL(testManager_, fetchLatestBulletinA_()).WillOnce(testing::Invoke(fetchBulletinA));
+        EXPECT_CALL(testManager_, fetchLatestFinals2000A_()).WillOnce(testing::Invoke(fetchFinals2000A));
+
+        EXPECT_NO_THROW(testManager_.refresh());
+
+        testing::Mock::VerifyAndClearExpectations(&testManager_);
+
+        EXPECT_NE(snapshotSPtr, testManager_.getSnapshot());
+
+        this->loadManifestWithLastUpdate("2020-01-01T00:00:00.000000");
+    }
+
+    // Background refresh
+
+    {
+        testManager_.startBackgroundRefresh(Duration::Minutes(1.0));
+
+        EXPECT_TRUE(testManager_.isBackgroundRefreshActive());
+
+        testManager_.stopBackgroundRefresh();
+
+        EXPECT_FALSE(testManager_.isBackgroundRefreshActive());
+    }
+
+    // Manual mode does not refresh
+
+    {
+        testManager_.reset();
+        testManager_.setMode(Manager::Mode::Manual);
+
+        std::filesystem::remove(localBulletinAPath);
+        std::filesystem::remove(localFinals2000APath);
+
+        EXPECT_NO_THROW(testManager_.refresh());
+
+        EXPECT_FALSE(std::filesystem::exists(localBulletinAPath));
+        EXPECT_FALSE(std::filesystem::exists(localFinals2000APath));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Manager, Reset)
 {
     {
@@ -0,0 +1,242 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Snapshot.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::object::Vector2d;
+
+using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::EarthOrientationParameters;
+using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
+using ostk::physics::coordinate::frame::provider::iers::Snapshot;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+class OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot : public ::testing::Test
+{
+   protected:
+    const Shared<const BulletinA> bulletinASPtr_ = std::make_shared<const BulletinA>(BulletinA::Load(File::Path(
+        Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/bulletin-A/ser7.dat")
+    )));
+
+    const Shared<const Finals2000A> finals2000ASPtr_ = std::make_shared<const Finals2000A>(Finals2000A::Load(
+        File::Path(Path::Parse(
+            "/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/finals-2000A/finals2000A.data"
+        ))
+    ));
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot, IsDefined)
+{
+    {
+        EXPECT_TRUE(Snapshot(bulletinASPtr_, finals2000ASPtr_).isDefined());
+        EXPECT_TRUE(Snapshot(bulletinASPtr_, nullptr).isDefined());
+        EXPECT_TRUE(Snapshot(nullptr, finals2000ASPtr_).isDefined());
+    }
+
+    {
+        EXPECT_FALSE(Snapshot(nullptr, nullptr).isDefined());
+        EXPECT_FALSE(Snapshot::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot, HasBulletins)
+{
+    {
+        const Snapshot snapshot = {bulletinASPtr_, nullptr};
+
+        EXPECT_TRUE(snapshot.hasBulletinA());
+        EXPECT_FALSE(snapshot.hasFinals2000A());
+        EXPECT_EQ(bulletinASPtr_, snapshot.accessBulletinA());
+        EXPECT_EQ(nullptr, snapshot.accessFinals2000A());
+    }
+
+    {
+        const Snapshot snapshot = {nullptr, finals2000ASPtr_};
+
+        EXPECT_FALSE(snapshot.hasBulletinA());
+        EXPECT_TRUE(snapshot.hasFinals2000A());
+        EXPECT_EQ(nullptr, snapshot.accessBulletinA());
+        EXPECT_EQ(finals2000ASPtr_, snapshot.accessFinals2000A());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot, IsResolved)
+{
+    {
+        const Snapshot snapshot = {bulletinASPtr_, nullptr};
+
+        EXPECT_TRUE(snapshot.isBulletinAResolved());
+        EXPECT_FALSE(snapshot.isFinals2000AResolved());
+    }
+
+    {
+        const Snapshot snapshot = {bulletinASPtr_, nullptr, false, true};
+
+        EXPECT_TRUE(snapshot.isBulletinAResolved());
+        EXPECT_TRUE(snapshot.isFinals2000AResolved());
+        EXPECT_FALSE(snapshot.hasFinals2000A());
+    }
+
+    {
+        EXPECT_FALSE(Snapshot::Undefined().isBulletinAResolved());
+        EXPECT_FALSE(Snapshot::Undefined().isFinals2000AResolved());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot, IsCoveredByBulletinA)
+{
+    {
+        const Snapshot snapshot = {bulletinASPtr_, nullptr};
+
+        EXPECT_TRUE(snapshot.isCoveredByBulletinA(bulletinASPtr_->accessObservationInterval().accessStart()));
+        EXPECT_TRUE(snapshot.isCoveredByBulletinA(bulletinASPtr_->accessPredictionInterval().accessEnd()));
+        EXPECT_FALSE(snapshot.isCoveredByBulletinA(Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC)));
+    }
+
+    {
+        EXPECT_FALSE(Snapshot(nullptr, finals2000ASPtr_).isCoveredByBulletinA(Instant::J2000()));
+    }
+
+    {
+        EXPECT_THROW(
+            Snapshot(bulletinASPtr_, nullptr).isCoveredByBulletinA(Instant::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot, GetEarthOrientationParametersAt)
+{
+    {
+        const Snapshot snapshot = {bulletinASPtr_, finals2000ASPtr_};
+
+        // Covered by Bulletin A observations
+
+        const Instant instant = bulletinASPtr_->accessObservationInterval().accessStart();
+
+        const BulletinA::Observation observation = bulletinASPtr_->getObservationAt(instant);
+
+        EXPECT_EQ(Vector2d(observation.x, observation.y), snapshot.getPolarMotionAt(instant));
+        EXPECT_EQ(observation.ut1MinusUtc, snapshot.getUt1MinusUtcAt(instant));
+    }
+
+    {
+        const Snapshot snapshot = {nullptr, finals2000ASPtr_};
+
+        // Only covered by Finals 2000A
+
+        const Instant instant = Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_EQ(finals2000ASPtr_->getPolarMotionAt(instant), snapshot.getPolarMotionAt(instant));
+        EXPECT_EQ(finals2000ASPtr_->getUt1MinusUtcAt(instant), snapshot.getUt1MinusUtcAt(instant));
+        EXPECT_EQ(finals2000ASPtr_->getLodAt(instant), snapshot.getLodAt(instant));
+    }
+
+    {
+        const Snapshot snapshot = {bulletinASPtr_, nullptr};
+
+        EXPECT_THROW(snapshot.getLodAt(Instant::J2000()), ostk::core::error::RuntimeError);
+    }
+
+    {
+        const Snapshot snapshot = Snapshot::Undefined();
+
+        EXPECT_THROW(snapshot.getPolarMotionAt(Instant::J2000()), ostk::core::error::RuntimeError);
+        EXPECT_THROW(snapshot.getUt1MinusUtcAt(Instant::J2000()), ostk::core::error::RuntimeError);
+        EXPECT_THROW(snapshot.getLodAt(Instant::J2000()), ostk::core::error::RuntimeError);
+
+        EXPECT_THROW(snapshot.getPolarMotionAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_IERS_Snapshot, GetEopAt)
+{
+    {
+        const Snapshot snapshot = {bulletinASPtr_, finals2000ASPtr_};
+
+        const Instant instant = bulletinASPtr_->accessObservationInterval().accessStart();
+
+        const EarthOrientationParameters eop = snapshot.getEopAt(instant);
+
+        EXPECT_TRUE(eop.isDefined());
+        EXPECT_EQ(EarthOrientationParameters::Source::BulletinAObservation, eop.source);
+        EXPECT_EQ(snapshot.getPolarMotionAt(instant), eop.polarMotion);
+        EXPECT_EQ(snapshot.getUt1MinusUtcAt(instant), eop.ut1MinusUtc);
+        EXPECT_EQ(snapshot.getLodAt(instant), eop.lod);
+    }
+
+    {
+        const Snapshot snapshot = {bulletinASPtr_, finals2000ASPtr_};
+
+        const Instant instant = bulletinASPtr_->accessPredictionInterval().accessStart();
+
+        const EarthOrientationParameters eop = snapshot.getEopAt(instant);
+
+        EXPECT_EQ(EarthOrientationParameters::Source::BulletinAPrediction, eop.source);
+        EXPECT_EQ(snapshot.getPolarMotionAt(instant), eop.polarMotion);
+        EXPECT_EQ(snapshot.getUt1MinusUtcAt(instant), eop.ut1MinusUtc);
+    }
+
+    {
+        const Snapshot snapshot = {nullptr, finals2000ASPtr_};
+
+        const Instant instant = Instant::DateTime(DateTime(2000, 1, 1, 6, 0, 0), Scale::UTC);
+
+        const EarthOrientationParameters eop = snapshot.getEopAt(instant);
+        const Finals2000A::Data data = finals2000ASPtr_->getDataAt(instant);
+
+        EXPECT_EQ(EarthOrientationParameters::Source::Finals2000A, eop.source);
+        EXPECT_EQ(Vector2d(data.x_A, data.y_A), eop.polarMotion);
+        EXPECT_EQ(data.ut1MinusUtc_A, eop.ut1MinusUtc);
+        EXPECT_EQ(data.lod_A, eop.lod);
+        EXPECT_EQ(data.dx_A, eop.dx);
+        EXPECT_EQ(data.dy_A, eop.dy);
+    }
+
+    {
+        const Snapshot snapshot = {bulletinASPtr_, nullptr};
+
+        const Instant instant = bulletinASPtr_->accessObservationInterval().accessStart();
+
+        const EarthOrientationParameters eop = snapshot.getEopAt(instant);
+
+        EXPECT_TRUE(eop.isDefined());
+        EXPECT_FALSE(eop.lod.isDefined());
+        EXPECT_FALSE(eop.dx.isDefined());
+        EXPECT_FALSE(eop.dy.isDefined());
+    }
+
+    {
+        const Snapshot snapshot = {bulletinASPtr_, finals2000ASPtr_};
+
+        const Array<Instant> instants = {
+            Instant::DateTime(DateTime(2000, 1, 1, 0, 0, 0), Scale::UTC),
+            bulletinASPtr_->accessObservationInterval().accessStart(),
+        };
+
+        const Array<EarthOrientationParameters> earthOrientationParameters = snapshot.getEopAt(instants);
+
+        ASSERT_EQ(2, earthOrientationParameters.getSize());
+        EXPECT_EQ(EarthOrientationParameters::Source::Finals2000A, earthOrientationParameters[0].source);
+        EXPECT_EQ(EarthOrientationParameters::Source::BulletinAObservation, earthOrientationParameters[1].source);
+    }
+
+    {
+        EXPECT_THROW(Snapshot::Undefined().getEopAt(Instant::J2000()), ostk::core::error::RuntimeError);
+        EXPECT_THROW(Snapshot::Undefined().getEopAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
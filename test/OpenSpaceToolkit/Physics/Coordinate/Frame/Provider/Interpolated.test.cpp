@@ -0,0 +1,146 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/CIRF.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Interpolated.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::frame::Provider;
+using ostk::physics::coordinate::frame::provider::CIRF;
+using ostk::physics::coordinate::frame::provider::Interpolated;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+
+class OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_Interpolated : public ::testing::Test
+{
+   protected:
+    const Shared<const Provider> providerSPtr_ = std::make_shared<CIRF>();
+
+    const Instant startInstant_ = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+    const Interval interval_ = Interval::Closed(startInstant_, startInstant_ + Duration::Days(1.0));
+
+    const Angle angularTolerance_ = Angle::Arcseconds(1e-6);
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_Interpolated, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Interpolated(providerSPtr_, interval_, angularTolerance_));
+    }
+
+    {
+        EXPECT_THROW(Interpolated(nullptr, interval_, angularTolerance_), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            Interpolated(providerSPtr_, Interval::Undefined(), angularTolerance_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Interpolated(providerSPtr_, interval_, Angle::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(
+            Interpolated(providerSPtr_, Interval::Closed(startInstant_, startInstant_), angularTolerance_)
+        );
+        EXPECT_ANY_THROW(Interpolated(providerSPtr_, interval_, Angle::Zero()));
+        EXPECT_ANY_THROW(
+            Interpolated(providerSPtr_, interval_, angularTolerance_, Duration::Minutes(1.0), Duration::Hours(1.0))
+        );
+        EXPECT_ANY_THROW(
+            Interpolated(providerSPtr_, interval_, angularTolerance_, Duration::Hours(1.0), Duration::Zero())
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_Interpolated, IsDefined)
+{
+    {
+        EXPECT_TRUE(Interpolated(providerSPtr_, interval_, angularTolerance_).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_Interpolated, Getters)
+{
+    {
+        const Interpolated interpolated = {providerSPtr_, interval_, angularTolerance_};
+
+        EXPECT_EQ(providerSPtr_, interpolated.accessProvider());
+        EXPECT_EQ(interval_, interpolated.getInterval());
+        EXPECT_EQ(angularTolerance_, interpolated.getAngularTolerance());
+
+        EXPECT_GE(angularTolerance_.inRadians(), interpolated.getMaximumAngularError().inRadians());
+
+        EXPECT_LE(25, interpolated.getNodeCount());
+    }
+
+    {
+        const Interpolated coarse = {providerSPtr_, interval_, Angle::Arcseconds(1e-3)};
+        const Interpolated fine = {providerSPtr_, interval_, Angle::Arcseconds(1e-7)};
+
+        EXPECT_LE(coarse.getNodeCount(), fine.getNodeCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_Interpolated, GetTransformAt)
+{
+    {
+        const Interpolated interpolated = {providerSPtr_, interval_, angularTolerance_};
+
+        for (Instant instant = interval_.accessStart(); instant <= interval_.accessEnd();
+             instant += Duration::Seconds(97.0))
+        {
+            const Transform referenceTransform = providerSPtr_->getTransformAt(instant);
+            const Transform transform = interpolated.getTransformAt(instant);
+
+            EXPECT_EQ(instant, transform.getInstant());
+
+            for (const Vector3d& axis : {Vector3d::UnitX(), Vector3d::UnitY(), Vector3d::UnitZ()})
+            {
+                const Vector3d referenceAxis = referenceTransform.accessOrientation() * axis;
+                const Vector3d interpolatedAxis = transform.accessOrientation() * axis;
+
+                EXPECT_GE(angularTolerance_.inRadians(), (interpolatedAxis - referenceAxis).norm())
+                    << instant.toString();
+            }
+
+            EXPECT_GT(1e-6, (transform.getTranslation() - referenceTransform.getTranslation()).norm());
+            EXPECT_GT(1e-9, (transform.getVelocity() - referenceTransform.getVelocity()).norm());
+            EXPECT_GT(1e-12, (transform.getAngularVelocity() - referenceTransform.getAngularVelocity()).norm());
+        }
+    }
+
+    {
+        const Interpolated interpolated = {providerSPtr_, interval_, angularTolerance_};
+
+        const Instant instant = interval_.accessEnd() + Duration::Days(1.0);
+
+        EXPECT_EQ(providerSPtr_->getTransformAt(instant), interpolated.getTransformAt(instant));
+    }
+
+    {
+        const Interpolated interpolated = {providerSPtr_, interval_, angularTolerance_};
+
+        EXPECT_THROW(interpolated.getTransformAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
@@ -25,6 +25,18 @@ using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_J2000, IsTimeInvariant)
+{
+    {
+        EXPECT_TRUE(J2000(Theory::IAU_2000A).isTimeInvariant());
+        EXPECT_TRUE(J2000(Theory::IAU_2006).isTimeInvariant());
+    }
+
+    {
+        EXPECT_THROW(J2000(Theory::IAU_2000B).getTransformAt(Instant::J2000()), ostk::core::error::runtime::Wrong);
+    }
+}
+
 TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_J2000, GetTransformAt)
 {
     // IAU 2000A
@@ -31,10 +31,29 @@ using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::frame::provider::MOD;
 using ostk::physics::coordinate::frame::Transform;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Angle;
 
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_MOD, IsTimeInvariant)
+{
+    {
+        EXPECT_TRUE(MOD(Instant::J2000()).isTimeInvariant());
+    }
+
+    {
+        const MOD provider = {Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC)};
+
+        const Instant instant = Instant::DateTime(DateTime(2021, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_EQ(
+            provider.getTransformAt(instant).getOrientation(),
+            provider.getTransformAt(instant + Duration::Days(100.0)).getOrientation()
+        );
+    }
+}
+
 TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_MOD, GetTransformAt)
 {
     {
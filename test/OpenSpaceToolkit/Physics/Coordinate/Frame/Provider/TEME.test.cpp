@@ -117,3 +117,32 @@ TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_TEME, GetTransformAt)
         }
     }
 }
+
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_TEME, GetTransformsAt)
+{
+    {
+        const TEME temeFrameProvider;
+
+        const Array<Instant> instants = {
+            Instant::J2000(),
+            Instant::DateTime(DateTime(2018, 1, 1, 0, 0, 0), Scale::UTC),
+            Instant::DateTime(DateTime(2020, 6, 15, 7, 31, 12, 345), Scale::UTC),
+            Instant::DateTime(DateTime(2021, 12, 31, 23, 59, 59), Scale::UTC),
+        };
+
+        const Array<Transform> transforms = temeFrameProvider.getTransformsAt(instants);
+
+        ASSERT_EQ(instants.getSize(), transforms.getSize());
+
+        for (std::size_t index = 0; index < instants.getSize(); ++index)
+        {
+            EXPECT_EQ(temeFrameProvider.getTransformAt(instants[index]), transforms[index]);
+        }
+    }
+
+    {
+        const Array<Instant> undefinedInstants = {Instant::J2000(), Instant::Undefined()};
+
+        EXPECT_THROW(TEME().getTransformsAt(undefinedInstants), ostk::core::error::runtime::Undefined);
+    }
+}
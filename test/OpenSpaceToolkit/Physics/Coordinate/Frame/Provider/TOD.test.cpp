@@ -35,11 +35,30 @@ using ostk::physics::coordinate::frame::provider::TOD;
 using ostk::physics::coordinate::frame::Transform;
 using ostk::physics::environment::object::celestial::Earth;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Angle;
 using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
 
+TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_TOD, IsTimeInvariant)
+{
+    {
+        EXPECT_TRUE(TOD(Instant::J2000(), Theory::IAU_2006).isTimeInvariant());
+    }
+
+    {
+        const TOD provider = {Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC), Theory::IAU_2000A};
+
+        const Instant instant = Instant::DateTime(DateTime(2021, 1, 1, 0, 0, 0), Scale::UTC);
+
+        EXPECT_EQ(
+            provider.getTransformAt(instant).getOrientation(),
+            provider.getTransformAt(instant + Duration::Days(100.0)).getOrientation()
+        );
+    }
+}
+
 TEST(OpenSpaceToolkit_Physics_Coordinate_Frame_Provider_TOD, GetTransformAt)
 {
     {
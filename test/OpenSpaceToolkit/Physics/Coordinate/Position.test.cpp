@@ -10,6 +10,7 @@
 
 using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 
 using ostk::mathematics::object::Vector3d;
 
@@ -234,6 +235,51 @@ TEST_F(OpenSpaceToolkit_Physics_Coordinate_Position, InFrame)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_Position, InFrame_Array)
+{
+    using ostk::core::container::Array;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+
+    const Array<Instant> instants = {
+        Instant::J2000(), Instant::J2000() + Duration::Minutes(1.0), Instant::J2000() + Duration::Hours(1.0)
+    };
+
+    const Array<Position> positions_GCRF = {
+        {{7000e3, 1000e3, 500e3}, Position::Unit::Meter, Frame::GCRF()},
+        {{6000e3, -2000e3, 100e3}, Position::Unit::Meter, Frame::GCRF()},
+        {{-7000e3, 0.0, 3000e3}, Position::Unit::Meter, Frame::GCRF()},
+    };
+
+    {
+        const Array<Position> positions_ITRF = Position::InFrame(positions_GCRF, Frame::ITRF(), instants);
+
+        ASSERT_EQ(positions_GCRF.getSize(), positions_ITRF.getSize());
+
+        for (Size index = 0; index < positions_GCRF.getSize(); ++index)
+        {
+            const Position referencePosition_ITRF = positions_GCRF[index].inFrame(Frame::ITRF(), instants[index]);
+
+            EXPECT_TRUE(positions_ITRF[index].getCoordinates().isNear(referencePosition_ITRF.getCoordinates(), 1e-6))
+                << positions_ITRF[index];
+            EXPECT_EQ(Position::Unit::Meter, positions_ITRF[index].getUnit());
+            EXPECT_EQ(Frame::ITRF(), positions_ITRF[index].accessFrame());
+        }
+    }
+
+    {
+        EXPECT_TRUE(Position::InFrame(Array<Position>::Empty(), Frame::ITRF(), Array<Instant>::Empty()).isEmpty());
+    }
+
+    {
+        EXPECT_ANY_THROW(Position::InFrame(positions_GCRF, Frame::Undefined(), instants));
+        EXPECT_ANY_THROW(Position::InFrame(positions_GCRF, Frame::ITRF(), {Instant::J2000()}));
+        EXPECT_ANY_THROW(Position::InFrame({positionGCRF_, positionITRF_}, Frame::ITRF(), {instants[0], instants[1]}));
+        EXPECT_ANY_THROW(Position::InFrame({Position::Undefined()}, Frame::ITRF(), {Instant::J2000()}));
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Coordinate_Position, ToString)
 {
     {
@@ -0,0 +1,228 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::PositionArray;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+class OpenSpaceToolkit_Physics_Coordinate_PositionArray : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        coordinates_.col(0) = Vector3d(7000e3, 1000e3, 500e3);
+        coordinates_.col(1) = Vector3d(6000e3, -2000e3, 100e3);
+        coordinates_.col(2) = Vector3d(-7000e3, 0.0, 3000e3);
+
+        positionArray_ = {coordinates_, PositionArray::Unit::Meter, Frame::GCRF()};
+    }
+
+    PositionArray::Matrix3Xd coordinates_ = PositionArray::Matrix3Xd(3, 3);
+    PositionArray positionArray_ = PositionArray::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, Constructor)
+{
+    {
+        EXPECT_NO_THROW(PositionArray(coordinates_, PositionArray::Unit::Meter, Frame::GCRF()));
+        EXPECT_NO_THROW(PositionArray(PositionArray::Matrix3Xd(3, 0), PositionArray::Unit::Meter, Frame::GCRF()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, EqualToOperator)
+{
+    {
+        EXPECT_TRUE(positionArray_ == positionArray_);
+        EXPECT_TRUE(positionArray_ == PositionArray::View(coordinates_, PositionArray::Unit::Meter, Frame::GCRF()));
+    }
+
+    {
+        EXPECT_FALSE(positionArray_ == PositionArray(coordinates_, PositionArray::Unit::Meter, Frame::ITRF()));
+        EXPECT_FALSE(positionArray_ == PositionArray(coordinates_, PositionArray::Unit::Foot, Frame::GCRF()));
+        EXPECT_FALSE(
+            positionArray_ == PositionArray(coordinates_.leftCols(2), PositionArray::Unit::Meter, Frame::GCRF())
+        );
+        EXPECT_FALSE(positionArray_ == PositionArray::Undefined());
+        EXPECT_FALSE(PositionArray::Undefined() == PositionArray::Undefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, SubscriptOperator)
+{
+    {
+        const Position position = positionArray_[1];
+
+        EXPECT_EQ(Position(coordinates_.col(1), Position::Unit::Meter, Frame::GCRF()), position);
+    }
+
+    {
+        EXPECT_ANY_THROW(positionArray_[3]);
+        EXPECT_ANY_THROW(PositionArray::Undefined()[0]);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, IsDefined)
+{
+    {
+        EXPECT_TRUE(positionArray_.isDefined());
+    }
+
+    {
+        EXPECT_FALSE(PositionArray::Undefined().isDefined());
+        EXPECT_FALSE(PositionArray(coordinates_, PositionArray::Unit::Undefined, Frame::GCRF()).isDefined());
+        EXPECT_FALSE(PositionArray(coordinates_, PositionArray::Unit::Meter, Frame::Undefined()).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, GetSize)
+{
+    {
+        EXPECT_EQ(3, positionArray_.getSize());
+        EXPECT_FALSE(positionArray_.isEmpty());
+    }
+
+    {
+        EXPECT_TRUE(PositionArray::Meters(PositionArray::Matrix3Xd(3, 0), Frame::GCRF()).isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, GetPositions)
+{
+    {
+        const Array<Position> positions = positionArray_.getPositions();
+
+        ASSERT_EQ(3, positions.getSize());
+
+        for (Size index = 0; index < positions.getSize(); ++index)
+        {
+            EXPECT_EQ(positionArray_[index], positions[index]);
+        }
+
+        EXPECT_EQ(positionArray_, PositionArray::FromPositions(positions));
+    }
+
+    {
+        EXPECT_ANY_THROW(PositionArray::Undefined().getPositions());
+        EXPECT_ANY_THROW(PositionArray::FromPositions(Array<Position>::Empty()));
+        EXPECT_ANY_THROW(PositionArray::FromPositions(
+            {Position::Meters({0.0, 0.0, 0.0}, Frame::GCRF()), Position::Meters({0.0, 0.0, 0.0}, Frame::ITRF())}
+        ));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, View)
+{
+    {
+        const PositionArray positionArray =
+            PositionArray::View(coordinates_, PositionArray::Unit::Meter, Frame::GCRF());
+
+        EXPECT_TRUE(positionArray.isView());
+        EXPECT_FALSE(positionArray_.isView());
+
+        EXPECT_EQ(coordinates_.data(), positionArray.accessCoordinates().data());
+
+        const PositionArray positionArrayCopy = positionArray;
+
+        EXPECT_EQ(coordinates_.data(), positionArrayCopy.accessCoordinates().data());
+    }
+
+    {
+        const std::vector<double> buffer = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+
+        const PositionArray positionArray =
+            PositionArray::View(buffer.data(), 2, PositionArray::Unit::Meter, Frame::GCRF());
+
+        EXPECT_EQ(2, positionArray.getSize());
+        EXPECT_EQ(Vector3d(4.0, 5.0, 6.0), positionArray[1].getCoordinates());
+    }
+
+    {
+        EXPECT_ANY_THROW(PositionArray::View(nullptr, 2, PositionArray::Unit::Meter, Frame::GCRF()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, InUnit)
+{
+    {
+        const PositionArray positionArray = positionArray_.inUnit(PositionArray::Unit::Foot);
+
+        EXPECT_EQ(PositionArray::Unit::Foot, positionArray.getUnit());
+
+        for (Size index = 0; index < positionArray.getSize(); ++index)
+        {
+            EXPECT_TRUE(positionArray[index].getCoordinates().isNear(
+                positionArray_[index].inUnit(Position::Unit::Foot).getCoordinates(), 1e-6
+            ));
+        }
+
+        EXPECT_TRUE(positionArray.inMeters().getCoordinates().isApprox(coordinates_, 1e-12));
+    }
+
+    {
+        EXPECT_ANY_THROW(positionArray_.inUnit(PositionArray::Unit::Undefined));
+        EXPECT_ANY_THROW(PositionArray::Undefined().inMeters());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, InFrame)
+{
+    const Array<Instant> instants = {
+        Instant::J2000(), Instant::J2000() + Duration::Minutes(1.0), Instant::J2000() + Duration::Hours(1.0)
+    };
+
+    {
+        const PositionArray positionArray = positionArray_.inFrame(Frame::ITRF(), instants[0]);
+
+        EXPECT_EQ(Frame::ITRF(), positionArray.accessFrame());
+
+        for (Size index = 0; index < positionArray.getSize(); ++index)
+        {
+            EXPECT_TRUE(positionArray[index].getCoordinates().isNear(
+                positionArray_[index].inFrame(Frame::ITRF(), instants[0]).getCoordinates(), 1e-6
+            ));
+        }
+
+        EXPECT_EQ(positionArray, positionArray_.inFrame(Frame::ITRF(), Array<Instant> {instants[0]}));
+    }
+
+    {
+        const PositionArray positionArray = positionArray_.inFrame(Frame::ITRF(), instants);
+
+        EXPECT_EQ(Frame::ITRF(), positionArray.accessFrame());
+
+        for (Size index = 0; index < positionArray.getSize(); ++index)
+        {
+            EXPECT_TRUE(positionArray[index].getCoordinates().isNear(
+                positionArray_[index].inFrame(Frame::ITRF(), instants[index]).getCoordinates(), 1e-6
+            ));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(positionArray_.inFrame(Frame::Undefined(), instants[0]));
+        EXPECT_ANY_THROW(positionArray_.inFrame(Frame::ITRF(), Instant::Undefined()));
+        EXPECT_ANY_THROW(positionArray_.inFrame(Frame::ITRF(), Array<Instant> {instants[0], instants[1]}));
+        EXPECT_ANY_THROW(PositionArray::Undefined().inFrame(Frame::ITRF(), instants[0]));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_PositionArray, Undefined)
+{
+    {
+        EXPECT_NO_THROW(PositionArray::Undefined());
+        EXPECT_FALSE(PositionArray::Undefined().isDefined());
+    }
+}
@@ -0,0 +1,144 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/VelocityArray.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::PositionArray;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::coordinate::VelocityArray;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+class OpenSpaceToolkit_Physics_Coordinate_VelocityArray : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        PositionArray::Matrix3Xd positionCoordinates(3, 3);
+        positionCoordinates.col(0) = Vector3d(7000e3, 1000e3, 500e3);
+        positionCoordinates.col(1) = Vector3d(6000e3, -2000e3, 100e3);
+        positionCoordinates.col(2) = Vector3d(-7000e3, 0.0, 3000e3);
+
+        coordinates_.col(0) = Vector3d(0.0, 7546.0, 0.0);
+        coordinates_.col(1) = Vector3d(1000.0, 6000.0, 3000.0);
+        coordinates_.col(2) = Vector3d(-500.0, -7000.0, 100.0);
+
+        positionArray_ = PositionArray::Meters(positionCoordinates, Frame::GCRF());
+        velocityArray_ = VelocityArray::MetersPerSecond(coordinates_, Frame::GCRF());
+    }
+
+    VelocityArray::Matrix3Xd coordinates_ = VelocityArray::Matrix3Xd(3, 3);
+    PositionArray positionArray_ = PositionArray::Undefined();
+    VelocityArray velocityArray_ = VelocityArray::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_VelocityArray, EqualToOperator)
+{
+    {
+        EXPECT_TRUE(velocityArray_ == velocityArray_);
+        EXPECT_TRUE(
+            velocityArray_ == VelocityArray::View(coordinates_, VelocityArray::Unit::MeterPerSecond, Frame::GCRF())
+        );
+    }
+
+    {
+        EXPECT_FALSE(velocityArray_ == VelocityArray::MetersPerSecond(coordinates_, Frame::ITRF()));
+        EXPECT_FALSE(velocityArray_ == VelocityArray::Undefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_VelocityArray, GetVelocities)
+{
+    {
+        const Array<Velocity> velocities = velocityArray_.getVelocities();
+
+        ASSERT_EQ(3, velocities.getSize());
+
+        EXPECT_EQ(Velocity::MetersPerSecond(coordinates_.col(2), Frame::GCRF()), velocities[2]);
+        EXPECT_EQ(velocityArray_, VelocityArray::FromVelocities(velocities));
+    }
+
+    {
+        EXPECT_ANY_THROW(VelocityArray::Undefined().getVelocities());
+        EXPECT_ANY_THROW(VelocityArray::FromVelocities(Array<Velocity>::Empty()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_VelocityArray, InUnit)
+{
+    {
+        EXPECT_EQ(velocityArray_, velocityArray_.inUnit(VelocityArray::Unit::MeterPerSecond));
+    }
+
+    {
+        EXPECT_ANY_THROW(velocityArray_.inUnit(VelocityArray::Unit::Undefined));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Coordinate_VelocityArray, InFrame)
+{
+    const Array<Instant> instants = {
+        Instant::J2000(), Instant::J2000() + Duration::Minutes(1.0), Instant::J2000() + Duration::Hours(1.0)
+    };
+
+    {
+        const VelocityArray velocityArray = velocityArray_.inFrame(positionArray_, Frame::ITRF(), instants[0]);
+
+        EXPECT_EQ(Frame::ITRF(), velocityArray.accessFrame());
+
+        for (Size index = 0; index < velocityArray.getSize(); ++index)
+        {
+            const Velocity referenceVelocity =
+                velocityArray_[index].inFrame(positionArray_[index], Frame::ITRF(), instants[0]);
+
+            EXPECT_TRUE(velocityArray[index].getCoordinates().isNear(referenceVelocity.getCoordinates(), 1e-9));
+        }
+    }
+
+    {
+        const VelocityArray velocityArray = velocityArray_.inFrame(positionArray_, Frame::ITRF(), instants);
+
+        for (Size index = 0; index < velocityArray.getSize(); ++index)
+        {
+            const Velocity referenceVelocity =
+                velocityArray_[index].inFrame(positionArray_[index], Frame::ITRF(), instants[index]);
+
+            EXPECT_TRUE(velocityArray[index].getCoordinates().isNear(referenceVelocity.getCoordinates(), 1e-9));
+        }
+    }
+
+    {
+        const PositionArray positionArray_ITRF = positionArray_.inFrame(Frame::ITRF(), instants);
+
+        const VelocityArray velocityArray = velocityArray_.inFrame(positionArray_ITRF, Frame::ITRF(), instants);
+
+        for (Size index = 0; index < velocityArray.getSize(); ++index)
+        {
+            const Velocity referenceVelocity =
+                velocityArray_[index].inFrame(positionArray_[index], Frame::ITRF(), instants[index]);
+
+            EXPECT_TRUE(velocityArray[index].getCoordinates().isNear(referenceVelocity.getCoordinates(), 1e-6));
+        }
+    }
+
+    {
+        EXPECT_ANY_THROW(velocityArray_.inFrame(positionArray_, Frame::Undefined(), instants[0]));
+        EXPECT_ANY_THROW(velocityArray_.inFrame(PositionArray::Undefined(), Frame::ITRF(), instants[0]));
+        EXPECT_ANY_THROW(velocityArray_.inFrame(
+            PositionArray::Meters(PositionArray::Matrix3Xd(3, 0), Frame::GCRF()), Frame::ITRF(), instants[0]
+        ));
+        EXPECT_ANY_THROW(
+            velocityArray_.inFrame(positionArray_, Frame::ITRF(), Array<Instant> {instants[0], instants[1]})
+        );
+    }
+}
@@ -0,0 +1,342 @@
+/// Apache License 2.0
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/BulletinA.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/Finals2000A.hpp>
+#include <OpenSpaceToolkit/Physics/Data/Cache.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::filesystem::Directory;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::String;
+using ostk::core::type::Uint32;
+
+using ostk::physics::coordinate::frame::provider::iers::BulletinA;
+using ostk::physics::coordinate::frame::provider::iers::Finals2000A;
+using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
+using ostk::physics::time::Date;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+
+namespace cache = ostk::physics::data::cache;
+
+class OpenSpaceToolkit_Physics_Data_Cache : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        if (directory_.exists())
+        {
+            directory_.remove();
+        }
+
+        directory_.create();
+    }
+
+    void TearDown() override
+    {
+        directory_.remove();
+    }
+
+    // Copy a file into the temporary directory, so that no cache is written next to the test data
+
+    File copy(const File& aFile) const
+    {
+        const File file = File::Path(directory_.getPath() + Path::Parse(aFile.getName()));
+
+        std::ifstream inputStream {aFile.getPath().toString(), std::ios::binary};
+        std::ofstream outputStream {file.getPath().toString(), std::ios::binary | std::ios::trunc};
+
+        outputStream << inputStream.rdbuf();
+
+        return file;
+    }
+
+    void write(const File& aFile, const std::string& aContent) const
+    {
+        std::ofstream outputStream {aFile.getPath().toString(), std::ios::binary | std::ios::trunc};
+
+        outputStream << aContent;
+    }
+
+    const Directory directory_ = Directory::Path(Path::Parse("/tmp/ostk-test-data-cache"));
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Data_Cache, WriterReader)
+{
+    {
+        cache::Writer writer;
+
+        writer.writeSize(3);
+        writer.writeInteger(-42);
+        writer.writeInteger(Integer::Undefined());
+        writer.writeReal(1.5);
+        writer.writeReal(Real::Undefined());
+        writer.writeCharacter('P');
+        writer.writeString("OBS");
+        writer.writeDate(Date(2020, 2, 29));
+        writer.writeDate(Date::Undefined());
+        writer.writeColumn({1.0, 2.0, 3.0});
+
+        cache::Reader reader = {writer.accessBuffer()};
+
+        EXPECT_EQ(3, reader.readSize());
+        EXPECT_EQ(-42, reader.readInteger());
+        EXPECT_FALSE(reader.readInteger().isDefined());
+        EXPECT_EQ(1.5, reader.readReal());
+        EXPECT_FALSE(reader.readReal().isDefined());
+        EXPECT_EQ('P', reader.readCharacter());
+        EXPECT_EQ("OBS", reader.readString());
+        EXPECT_EQ(Date(2020, 2, 29), reader.readDate());
+        EXPECT_FALSE(reader.readDate().isDefined());
+
+        std::vector<double> column;
+
+        reader.readColumn(column);
+
+        EXPECT_EQ(std::vector<double>({1.0, 2.0, 3.0}), column);
+
+        EXPECT_TRUE(reader.isEnd());
+
+        EXPECT_ANY_THROW(reader.readCharacter());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Data_Cache, GetFile)
+{
+    {
+        EXPECT_EQ(
+            "/tmp/ostk-test-data-cache/finals2000A.data.cache",
+            cache::GetFile(File::Path(Path::Parse("/tmp/ostk-test-data-cache/finals2000A.data")))
+                .getPath()
+                .toString()
+        );
+    }
+
+    {
+        EXPECT_ANY_THROW(cache::GetFile(File::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Data_Cache, SaveLoad)
+{
+    const File sourceFile = File::Path(directory_.getPath() + Path::Parse("source.txt"));
+
+    this->write(sourceFile, "source");
+
+    const auto save = [&sourceFile](const Integer& aValue, const Uint32& aContentVersion) -> bool
+    {
+        cache::Writer writer;
+
+        writer.writeInteger(aValue);
+
+        return cache::Save(sourceFile, "Test", aContentVersion, writer);
+    };
+
+    const auto load = [&sourceFile](const Uint32& aContentVersion) -> Integer
+    {
+        Integer value = Integer::Undefined();
+
+        cache::Load(
+            sourceFile,
+            "Test",
+            aContentVersion,
+            [&value](cache::Reader& aReader) -> void
+            {
+                value = aReader.readInteger();
+            }
+        );
+
+        return value;
+    };
+
+    {
+        EXPECT_FALSE(cache::Load(
+            sourceFile,
+            "Test",
+            1,
+            [](cache::Reader&) -> void
+            {
+            }
+        ));
+    }
+
+    {
+        EXPECT_TRUE(save(123, 1));
+
+        EXPECT_TRUE(cache::GetFile(sourceFile).exists());
+
+        EXPECT_EQ(123, load(1));
+    }
+
+    // Content type and version mismatches
+
+    {
+        EXPECT_FALSE(load(2).isDefined());
+
+        EXPECT_FALSE(cache::Load(
+            sourceFile,
+            "Other",
+            1,
+            [](cache::Reader& aReader) -> void
+            {
+                aReader.readInteger();
+            }
+        ));
+    }
+
+    // Partially read payload
+
+    {
+        EXPECT_FALSE(cache::Load(
+            sourceFile,
+            "Test",
+            1,
+            [](cache::Reader&) -> void
+            {
+            }
+        ));
+    }
+
+    // Corrupted payload
+
+    {
+        std::string content;
+
+        {
+            std::ifstream inputStream {cache::GetFile(sourceFile).getPath().toString(), std::ios::binary};
+
+            content.assign(std::istreambuf_iterator<char>(inputStream), std::istreambuf_iterator<char>());
+        }
+
+        content.back() ^= 0x01;
+
+        this->write(cache::GetFile(sourceFile), content);
+
+        EXPECT_FALSE(load(1).isDefined());
+    }
+
+    // Source file modified
+
+    {
+        EXPECT_TRUE(save(456, 1));
+
+        EXPECT_EQ(456, load(1));
+
+        this->write(sourceFile, "modified source");
+
+        EXPECT_FALSE(load(1).isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Data_Cache, Finals2000A)
+{
+    const File file = this->copy(File::Path(
+        Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/finals-2000A/finals2000A.data")
+    ));
+
+    const Finals2000A referenceFinals2000A = Finals2000A::Load(file);
+
+    // First load builds the cache, second load reads it
+
+    for (int loadIndex = 0; loadIndex < 2; ++loadIndex)
+    {
+        const Finals2000A finals2000A = Finals2000A::LoadCached(file);
+
+        EXPECT_TRUE(cache::GetFile(file).exists());
+
+        EXPECT_EQ(referenceFinals2000A.getInterval(), finals2000A.getInterval());
+        EXPECT_EQ(referenceFinals2000A.accessLastModifiedTimestamp(), finals2000A.accessLastModifiedTimestamp());
+
+        const Instant instant = Instant::DateTime(DateTime::Parse("2020-01-01 12:34:56"), Scale::UTC);
+
+        EXPECT_EQ(referenceFinals2000A.getPolarMotionAt(instant), finals2000A.getPolarMotionAt(instant));
+        EXPECT_EQ(referenceFinals2000A.getUt1MinusUtcAt(instant), finals2000A.getUt1MinusUtcAt(instant));
+        EXPECT_EQ(referenceFinals2000A.getLodAt(instant), finals2000A.getLodAt(instant));
+        EXPECT_EQ(referenceFinals2000A.getDataAt(instant).dx_A, finals2000A.getDataAt(instant).dx_A);
+        EXPECT_EQ(
+            referenceFinals2000A.getDataAt(instant).polarMotionflag, finals2000A.getDataAt(instant).polarMotionflag
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Data_Cache, BulletinA)
+{
+    const File file = this->copy(
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/bulletin-A/ser7.dat"))
+    );
+
+    const BulletinA referenceBulletinA = BulletinA::Load(file);
+
+    for (int loadIndex = 0; loadIndex < 2; ++loadIndex)
+    {
+        const BulletinA bulletinA = BulletinA::LoadCached(file);
+
+        EXPECT_TRUE(cache::GetFile(file).exists());
+
+        EXPECT_EQ(referenceBulletinA.getReleaseDate(), bulletinA.getReleaseDate());
+        EXPECT_EQ(referenceBulletinA.getTAIMinusUTC(), bulletinA.getTAIMinusUTC());
+        EXPECT_EQ(referenceBulletinA.getTAIMinusUTCEpoch(), bulletinA.getTAIMinusUTCEpoch());
+        EXPECT_EQ(referenceBulletinA.getObservationInterval(), bulletinA.getObservationInterval());
+        EXPECT_EQ(referenceBulletinA.getPredictionInterval(), bulletinA.getPredictionInterval());
+
+        const Instant observationInstant = referenceBulletinA.getObservationInterval().getStart();
+        const Instant predictionInstant = referenceBulletinA.getPredictionInterval().getEnd();
+
+        EXPECT_EQ(
+            referenceBulletinA.getObservationAt(observationInstant).ut1MinusUtc,
+            bulletinA.getObservationAt(observationInstant).ut1MinusUtc
+        );
+        EXPECT_EQ(
+            referenceBulletinA.getPredictionAt(predictionInstant).ut1MinusUtc,
+            bulletinA.getPredictionAt(predictionInstant).ut1MinusUtc
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Data_Cache, CSSISpaceWeather)
+{
+    const File file = this->copy(File::Path(Path::Parse(
+        "/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather/SW-Last5Years.test.csv"
+    )));
+
+    const CSSISpaceWeather referenceSpaceWeather = CSSISpaceWeather::Load(file);
+
+    for (int loadIndex = 0; loadIndex < 2; ++loadIndex)
+    {
+        const CSSISpaceWeather spaceWeather = CSSISpaceWeather::LoadCached(file);
+
+        EXPECT_TRUE(cache::GetFile(file).exists());
+
+        EXPECT_EQ(referenceSpaceWeather.accessLastObservationDate(), spaceWeather.accessLastObservationDate());
+        EXPECT_EQ(referenceSpaceWeather.accessObservationInterval(), spaceWeather.accessObservationInterval());
+        EXPECT_EQ(referenceSpaceWeather.accessDailyPredictionInterval(), spaceWeather.accessDailyPredictionInterval());
+        EXPECT_EQ(
+            referenceSpaceWeather.accessMonthlyPredictionInterval(), spaceWeather.accessMonthlyPredictionInterval()
+        );
+
+        const Instant instant = referenceSpaceWeather.accessObservationInterval().getStart();
+
+        const CSSISpaceWeather::Reading& referenceReading = referenceSpaceWeather.accessObservationAt(instant);
+        const CSSISpaceWeather::Reading& reading = spaceWeather.accessObservationAt(instant);
+
+        EXPECT_EQ(referenceReading.date, reading.date);
+        EXPECT_EQ(referenceReading.ApAvg, reading.ApAvg);
+        EXPECT_EQ(referenceReading.Cp, reading.Cp);
+        EXPECT_EQ(referenceReading.F107DataType, reading.F107DataType);
+        EXPECT_EQ(referenceReading.F107ObsCenter81, reading.F107ObsCenter81);
+    }
+}
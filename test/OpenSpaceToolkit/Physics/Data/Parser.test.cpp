@@ -0,0 +1,202 @@
+/// Apache License 2.0
+
+#include <string_view>
+
+#include <OpenSpaceToolkit/Physics/Data/Parser.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+
+namespace parser = ostk::physics::data::parser;
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, LineReader)
+{
+    {
+        parser::LineReader lineReader = {"abc\r\n\ndef\nghi"};
+
+        std::string_view line;
+
+        EXPECT_TRUE(lineReader.readLine(line));
+        EXPECT_EQ("abc", line);
+
+        EXPECT_TRUE(lineReader.readLine(line));
+        EXPECT_EQ("", line);
+
+        EXPECT_TRUE(lineReader.readLine(line));
+        EXPECT_EQ("def", line);
+
+        EXPECT_TRUE(lineReader.readLine(line));
+        EXPECT_EQ("ghi", line);
+
+        EXPECT_FALSE(lineReader.readLine(line));
+    }
+
+    {
+        parser::LineReader lineReader = {std::string_view()};
+
+        std::string_view line;
+
+        EXPECT_FALSE(lineReader.readLine(line));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, Trim)
+{
+    {
+        EXPECT_EQ("abc", parser::trim("  abc \t\r"));
+        EXPECT_EQ("a b", parser::trim(" a b "));
+        EXPECT_EQ("", parser::trim("   "));
+        EXPECT_EQ("", parser::trim(""));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, FixedColumn)
+{
+    {
+        const std::string_view line = "92 1 1 48622.00 I  0.182987";
+
+        EXPECT_EQ("92", parser::fixedColumn(line, 1, 2));
+        EXPECT_EQ("48622.00", parser::fixedColumn(line, 8, 15));
+        EXPECT_EQ("I", parser::fixedColumn(line, 17, 17));
+        EXPECT_EQ("0.182987", parser::fixedColumn(line, 18, 27));
+        EXPECT_EQ("0.182987", parser::fixedColumn(line, 18, 40));
+        EXPECT_EQ("", parser::fixedColumn(line, 50, 60));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, SplitDelimited)
+{
+    {
+        std::string_view fields[4];
+
+        EXPECT_EQ(4, parser::splitDelimited("a,,b ,c", ',', fields, 4));
+
+        EXPECT_EQ("a", fields[0]);
+        EXPECT_EQ("", fields[1]);
+        EXPECT_EQ("b ", fields[2]);
+        EXPECT_EQ("c", fields[3]);
+    }
+
+    {
+        std::string_view fields[2];
+
+        EXPECT_EQ(3, parser::splitDelimited("a,b,c", ',', fields, 2));
+
+        EXPECT_EQ("a", fields[0]);
+        EXPECT_EQ("b", fields[1]);
+    }
+
+    {
+        std::string_view fields[2];
+
+        EXPECT_EQ(1, parser::splitDelimited("", ',', fields, 2));
+
+        EXPECT_EQ("", fields[0]);
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, SplitWhitespace)
+{
+    {
+        std::string_view words[4];
+
+        EXPECT_EQ(3, parser::splitWhitespace("  2024  1 \t 15  ", words, 4));
+
+        EXPECT_EQ("2024", words[0]);
+        EXPECT_EQ("1", words[1]);
+        EXPECT_EQ("15", words[2]);
+    }
+
+    {
+        std::string_view words[1];
+
+        EXPECT_EQ(2, parser::splitWhitespace("a b", words, 1));
+
+        EXPECT_EQ("a", words[0]);
+    }
+
+    {
+        std::string_view words[1];
+
+        EXPECT_EQ(0, parser::splitWhitespace("   ", words, 1));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, ParseInteger)
+{
+    {
+        int value = 0;
+
+        EXPECT_TRUE(parser::parseInteger("42", value));
+        EXPECT_EQ(42, value);
+
+        EXPECT_TRUE(parser::parseInteger(" -7 ", value));
+        EXPECT_EQ(-7, value);
+
+        EXPECT_TRUE(parser::parseInteger("+1", value));
+        EXPECT_EQ(1, value);
+    }
+
+    {
+        int value = 0;
+
+        EXPECT_FALSE(parser::parseInteger("", value));
+        EXPECT_FALSE(parser::parseInteger("+", value));
+        EXPECT_FALSE(parser::parseInteger("1.0", value));
+        EXPECT_FALSE(parser::parseInteger("1a", value));
+        EXPECT_FALSE(parser::parseInteger("abc", value));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, ParseReal)
+{
+    {
+        double value = 0.0;
+
+        EXPECT_TRUE(parser::parseReal("0.182987", value));
+        EXPECT_DOUBLE_EQ(0.182987, value);
+
+        EXPECT_TRUE(parser::parseReal("+1.5", value));
+        EXPECT_DOUBLE_EQ(1.5, value);
+
+        EXPECT_TRUE(parser::parseReal(".5", value));
+        EXPECT_DOUBLE_EQ(0.5, value);
+
+        EXPECT_TRUE(parser::parseReal("-.5", value));
+        EXPECT_DOUBLE_EQ(-0.5, value);
+
+        EXPECT_TRUE(parser::parseReal(" 12 ", value));
+        EXPECT_DOUBLE_EQ(12.0, value);
+
+        EXPECT_TRUE(parser::parseReal("1.0E-3", value));
+        EXPECT_DOUBLE_EQ(1.0e-3, value);
+    }
+
+    {
+        double value = 0.0;
+
+        EXPECT_FALSE(parser::parseReal("", value));
+        EXPECT_FALSE(parser::parseReal("1.2.3", value));
+        EXPECT_FALSE(parser::parseReal("OBS", value));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Data_Parser, MappedFile)
+{
+    {
+        const File file = File::Path(Path::Parse(
+            "/app/test/OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/IERS/finals-2000A/finals2000A.data"
+        ));
+
+        const parser::MappedFile mappedFile = {file};
+
+        EXPECT_FALSE(mappedFile.accessContent().empty());
+    }
+
+    {
+        EXPECT_ANY_THROW(parser::MappedFile(File::Undefined()));
+        EXPECT_ANY_THROW(parser::MappedFile(File::Path(Path::Parse("/does/not/exist"))));
+    }
+}
@@ -6,12 +6,14 @@
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Manager.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
 #include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
@@ -24,15 +26,22 @@ using ostk::core::container::Tuple;
 using ostk::core::error::RuntimeError;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
 using ostk::core::type::Real;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::VectorXd;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::PositionArray;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
 using ostk::physics::environment::atmospheric::earth::Manager;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Angle;
@@ -342,6 +351,18 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetType)
             EarthAtmosphericModel(EarthAtmosphericModel::Type::NRLMSISE00).getType()
         );
     }
+    {
+        EXPECT_EQ(
+            EarthAtmosphericModel::Type::NRLMSISE00Grid,
+            EarthAtmosphericModel(EarthAtmosphericModel::Type::NRLMSISE00Grid).getType()
+        );
+    }
+    {
+        EXPECT_EQ(
+            EarthAtmosphericModel::Type::HarrisPriester,
+            EarthAtmosphericModel(EarthAtmosphericModel::Type::HarrisPriester).getType()
+        );
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetInputDataType)
@@ -385,6 +406,10 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, IsDefined)
         EXPECT_TRUE(EarthAtmosphericModel(EarthAtmosphericModel::Type::Exponential).isDefined());
 
         EXPECT_TRUE(EarthAtmosphericModel(EarthAtmosphericModel::Type::NRLMSISE00).isDefined());
+
+        EXPECT_TRUE(EarthAtmosphericModel(EarthAtmosphericModel::Type::NRLMSISE00Grid).isDefined());
+
+        EXPECT_TRUE(EarthAtmosphericModel(EarthAtmosphericModel::Type::HarrisPriester).isDefined());
     }
 }
 
@@ -416,7 +441,12 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensityAt_Posi
              LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)),
              Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC),
              6.7647e-14,
-             1e-15}
+             1e-15},
+            {EarthAtmosphericModel::Type::HarrisPriester,
+             LLA(Angle::Degrees(0.0), Angle::Degrees(30.0), Length::Kilometers(400.0)),
+             Instant::DateTime(DateTime::Parse("2021-03-20 12:00:00"), Scale::UTC),
+             7.492e-12,
+             1e-16}
         };
 
         for (const auto& testCase : testCases)
@@ -443,6 +473,43 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensityAt_Posi
             );
         }
     }
+
+    // The gridded NRLMSISE00 model is within 1% of the NRLMSISE00 model, in grid cell interiors
+
+    {
+        const EarthAtmosphericModel nrlmsise00Model = {EarthAtmosphericModel::Type::NRLMSISE00};
+        const EarthAtmosphericModel nrlmsise00GridModel = {EarthAtmosphericModel::Type::NRLMSISE00Grid};
+
+        const Array<LLA> llas = {
+            LLA(Angle::Degrees(5.0), Angle::Degrees(3.0), Length::Kilometers(502.5)),
+            LLA(Angle::Degrees(-42.3), Angle::Degrees(-71.7), Length::Kilometers(407.1)),
+        };
+
+        const Array<Instant> instants = {
+            Instant::DateTime(DateTime::Parse("2021-01-01 00:07:00"), Scale::UTC),
+            Instant::DateTime(DateTime::Parse("2021-01-01 02:41:00"), Scale::UTC),
+        };
+
+        for (const LLA& lla : llas)
+        {
+            const Position position = {
+                lla.toCartesian(
+                    EarthGravitationalModel::EGM2008.equatorialRadius_, EarthGravitationalModel::EGM2008.flattening_
+                ),
+                Position::Unit::Meter,
+                Frame::ITRF()
+            };
+
+            for (const Instant& instant : instants)
+            {
+                const Real referenceDensity = nrlmsise00Model.getDensityAt(position, instant);
+
+                EXPECT_NEAR(
+                    referenceDensity, nrlmsise00GridModel.getDensityAt(position, instant), 0.01 * referenceDensity
+                );
+            }
+        }
+    }
 }
 
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensityAt_LLA)
@@ -648,3 +715,159 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensityAt_Sola
         }
     }
 }
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensitiesAt)
+{
+    const Array<EarthAtmosphericModel> earthAtmosphericModels = {
+        {EarthAtmosphericModel::Type::Exponential},
+        {EarthAtmosphericModel::Type::NRLMSISE00},
+        {EarthAtmosphericModel::Type::NRLMSISE00,
+         EarthAtmosphericModel::InputDataType::ConstantFluxAndGeoMag,
+         150.0,
+         150.0,
+         3.0,
+         Frame::ITRF()},
+        {EarthAtmosphericModel::Type::NRLMSISE00,
+         EarthAtmosphericModel::InputDataType::CSSISpaceWeatherFile,
+         Real::Undefined(),
+         Real::Undefined(),
+         Real::Undefined(),
+         Frame::ITRF(),
+         EarthGravitationalModel::WGS84.equatorialRadius_,
+         EarthGravitationalModel::WGS84.flattening_,
+         std::make_shared<Sun>(Sun::Default())},
+    };
+
+    const Instant startInstant = Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC);
+
+    Array<Position> positions = Array<Position>::Empty();
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Index index = 0; index < 50; ++index)
+    {
+        const LLA lla = {
+            Angle::Degrees(-80.0 + 3.3 * index),
+            Angle::Degrees(-175.0 + 7.1 * index),
+            Length::Kilometers(200.0 + 9.0 * index),
+        };
+
+        const Instant instant = startInstant + Duration::Minutes(17.0 * index);
+
+        const Position positionITRF = Position::Meters(
+            lla.toCartesian(
+                EarthGravitationalModel::WGS84.equatorialRadius_, EarthGravitationalModel::WGS84.flattening_
+            ),
+            Frame::ITRF()
+        );
+
+        positions.add(positionITRF.inFrame(Frame::GCRF(), instant));
+        instants.add(instant);
+    }
+
+    const PositionArray positionArray = PositionArray::FromPositions(positions);
+
+    for (const auto& earthAtmosphericModel : earthAtmosphericModels)
+    {
+        // Single instant
+
+        {
+            const VectorXd densities = earthAtmosphericModel.getDensitiesAt(positionArray, startInstant);
+
+            ASSERT_EQ(positions.getSize(), static_cast<Size>(densities.size()));
+
+            for (Index index = 0; index < positions.getSize(); ++index)
+            {
+                const Real referenceDensity = earthAtmosphericModel.getDensityAt(positions[index], startInstant);
+
+                EXPECT_NEAR(referenceDensity, densities(index), 1e-10 * referenceDensity);
+            }
+        }
+
+        // Trajectory
+
+        {
+            const VectorXd densities = earthAtmosphericModel.getDensitiesAt(positionArray, instants, 2);
+
+            ASSERT_EQ(positions.getSize(), static_cast<Size>(densities.size()));
+
+            for (Index index = 0; index < positions.getSize(); ++index)
+            {
+                const Real referenceDensity = earthAtmosphericModel.getDensityAt(positions[index], instants[index]);
+
+                EXPECT_NEAR(referenceDensity, densities(index), 1e-10 * referenceDensity);
+            }
+        }
+
+        {
+            EXPECT_ANY_THROW(earthAtmosphericModel.getDensitiesAt(PositionArray::Undefined(), startInstant));
+            EXPECT_ANY_THROW(earthAtmosphericModel.getDensitiesAt(positionArray, Array<Instant>::Empty()));
+            EXPECT_ANY_THROW(
+                earthAtmosphericModel.getDensitiesAt(positionArray, Array<Instant> {startInstant, startInstant})
+            );
+            EXPECT_ANY_THROW(earthAtmosphericModel.getDensitiesAt(positionArray, instants, 0));
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth, GetDensityAndGradientAt)
+{
+    const Array<EarthAtmosphericModel> earthAtmosphericModels = {
+        {EarthAtmosphericModel::Type::Exponential},
+        {EarthAtmosphericModel::Type::NRLMSISE00},
+        {EarthAtmosphericModel::Type::HarrisPriester},
+    };
+
+    const Instant instant = Instant::DateTime(DateTime::Parse("2021-01-01 00:00:00"), Scale::UTC);
+
+    const LLA lla = {Angle::Degrees(35.0), Angle::Degrees(-120.0), Length::Kilometers(450.0)};
+
+    const Position positionITRF = Position::Meters(
+        lla.toCartesian(EarthGravitationalModel::WGS84.equatorialRadius_, EarthGravitationalModel::WGS84.flattening_),
+        Frame::ITRF()
+    );
+
+    // The gradient is expressed in the frame of the position
+
+    const Position positionGCRF = positionITRF.inFrame(Frame::GCRF(), instant);
+
+    const double step = 10.0;  // [m]
+
+    for (const auto& earthAtmosphericModel : earthAtmosphericModels)
+    {
+        {
+            const auto [density, gradient] = earthAtmosphericModel.getDensityAndGradientAt(positionGCRF, instant);
+
+            EXPECT_NEAR(earthAtmosphericModel.getDensityAt(positionGCRF, instant), density, 1e-10 * density);
+
+            const double gradientNorm = gradient.norm();
+
+            EXPECT_GT(gradientNorm, 0.0);
+
+            for (Index axis = 0; axis < 3; ++axis)
+            {
+                Vector3d offset = Vector3d::Zero();
+                offset(axis) = step;
+
+                const Real forwardDensity = earthAtmosphericModel.getDensityAt(
+                    Position::Meters(positionGCRF.getCoordinates() + offset, Frame::GCRF()), instant
+                );
+                const Real backwardDensity = earthAtmosphericModel.getDensityAt(
+                    Position::Meters(positionGCRF.getCoordinates() - offset, Frame::GCRF()), instant
+                );
+
+                const double referenceGradient = (forwardDensity - backwardDensity) / (2.0 * step);
+
+                EXPECT_NEAR(referenceGradient, gradient(axis), 1e-3 * gradientNorm);
+            }
+
+            // Density decreases with altitude
+
+            EXPECT_LT(gradient.dot(positionGCRF.getCoordinates().normalized()), 0.0);
+        }
+
+        {
+            EXPECT_ANY_THROW(earthAtmosphericModel.getDensityAndGradientAt(Position::Undefined(), instant));
+            EXPECT_ANY_THROW(earthAtmosphericModel.getDensityAndGradientAt(positionGCRF, Instant::Undefined()));
+        }
+    }
+}
@@ -1,11 +1,18 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <functional>
+
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
 
 #include <Global.test.hpp>
 
+using ostk::core::container::Array;
 using ostk::core::filesystem::File;
 using ostk::core::filesystem::Path;
+using ostk::core::type::Integer;
+using ostk::core::type::Size;
+using ostk::core::type::String;
 
 using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
 using ostk::physics::time::Date;
@@ -14,6 +21,7 @@ using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
+using ostk::physics::time::Time;
 
 class OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather : public ::testing::Test
 {
@@ -109,6 +117,20 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather,
         EXPECT_EQ(CSSISpaceWeather_.accessLastObservationDate(), observation.date);
     }
 
+    {
+        // each observed day is served by its own observation
+        for (const String& dateString : {"2018-01-01", "2018-01-02", "2018-01-03", "2023-06-18", "2023-06-19"})
+        {
+            const Date date = Date::Parse(dateString, Date::Format::Standard);
+
+            EXPECT_EQ(
+                date,
+                CSSISpaceWeather_.accessObservationAt(Instant::DateTime(DateTime(date, Time(18, 0, 0)), Scale::UTC))
+                    .date
+            );
+        }
+    }
+
     {
         // calling Undefined Space Weather
         EXPECT_THROW(
@@ -193,6 +215,21 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather,
         EXPECT_EQ(Date::Parse("2023-08-03", Date::Format::Standard), prediction.date);
     }
 
+    {
+        // each predicted day is served by its own prediction
+        for (const String& dateString : {"2023-06-20", "2023-06-21", "2023-08-02", "2023-08-03"})
+        {
+            const Date date = Date::Parse(dateString, Date::Format::Standard);
+
+            const CSSISpaceWeather::Reading& prediction =
+                CSSISpaceWeather_.accessDailyPredictionAt(Instant::DateTime(DateTime(date, Time(18, 0, 0)), Scale::UTC)
+                );
+
+            EXPECT_EQ(date, prediction.date);
+            EXPECT_EQ("PRD", prediction.F107DataType);
+        }
+    }
+
     {
         // calling Undefined Space Weather
         EXPECT_THROW(
@@ -485,6 +522,337 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather,
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, AccessLastReadingWithDefined)
+{
+    const File file =
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/"
+                               "CSSISpaceWeather/SW-Last5Years_missing_data.test.csv"));
+    this->CSSISpaceWeather_ = CSSISpaceWeather::Load(file);
+
+    {
+        EXPECT_THROW(
+            CSSISpaceWeather::Undefined().accessLastReadingWithDefined(
+                CSSISpaceWeather::Field::F107Obs, Instant::DateTime(DateTime::Parse("2023-06-29 00:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            CSSISpaceWeather_.accessLastReadingWithDefined(CSSISpaceWeather::Field::F107Obs, Instant::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            CSSISpaceWeather_.accessLastReadingWithDefined(
+                CSSISpaceWeather::Field::F107Obs, Instant::DateTime(DateTime::Parse("2000-01-01 00:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        const CSSISpaceWeather::Reading lastGoodReading = CSSISpaceWeather_.accessLastReadingWithDefined(
+            CSSISpaceWeather::Field::Ap3Hour, Instant::DateTime(DateTime::Parse("2023-12-01 00:00:00"), Scale::UTC)
+        );
+
+        // The last reading with Ap defined is the final daily reading
+        EXPECT_EQ(Date::Parse("2023-08-03", Date::Format::Standard), lastGoodReading.date);
+    }
+
+    {
+        const CSSISpaceWeather::Reading lastGoodReading = CSSISpaceWeather_.accessLastReadingWithDefined(
+            CSSISpaceWeather::Field::F107Obs, Instant::DateTime(DateTime::Parse("2018-01-03 00:00:00"), Scale::UTC)
+        );
+
+        // The last reading with F107Obs defined is two observations ago
+        EXPECT_EQ(Date::Parse("2018-01-01", Date::Format::Standard), lastGoodReading.date);
+    }
+
+    // Consistent with `accessLastReadingWhere`
+
+    {
+        const Array<std::pair<CSSISpaceWeather::Field, std::function<bool(const CSSISpaceWeather::Reading&)>>>
+            fieldPredicates = {
+                {CSSISpaceWeather::Field::Kp3Hour,
+                 [](const CSSISpaceWeather::Reading& aReading) -> bool
+                 {
+                     return aReading.Kp1.isDefined() && aReading.Kp2.isDefined() && aReading.Kp3.isDefined() &&
+                            aReading.Kp4.isDefined() && aReading.Kp5.isDefined() && aReading.Kp6.isDefined() &&
+                            aReading.Kp7.isDefined() && aReading.Kp8.isDefined();
+                 }},
+                {CSSISpaceWeather::Field::Ap3Hour,
+                 [](const CSSISpaceWeather::Reading& aReading) -> bool
+                 {
+                     return aReading.Ap1.isDefined() && aReading.Ap2.isDefined() && aReading.Ap3.isDefined() &&
+                            aReading.Ap4.isDefined() && aReading.Ap5.isDefined() && aReading.Ap6.isDefined() &&
+                            aReading.Ap7.isDefined() && aReading.Ap8.isDefined();
+                 }},
+                {CSSISpaceWeather::Field::ApDaily,
+                 [](const CSSISpaceWeather::Reading& aReading) -> bool
+                 {
+                     return aReading.ApAvg.isDefined();
+                 }},
+                {CSSISpaceWeather::Field::F107Obs,
+                 [](const CSSISpaceWeather::Reading& aReading) -> bool
+                 {
+                     return aReading.F107Obs.isDefined();
+                 }},
+                {CSSISpaceWeather::Field::F107ObsCenter81,
+                 [](const CSSISpaceWeather::Reading& aReading) -> bool
+                 {
+                     return aReading.F107ObsCenter81.isDefined();
+                 }},
+            };
+
+        const Instant startInstant = Instant::DateTime(DateTime::Parse("2023-06-19 12:00:00"), Scale::UTC);
+
+        for (const auto& [field, predicate] : fieldPredicates)
+        {
+            for (Instant instant = startInstant; instant < startInstant + Duration::Days(200.0);
+                 instant += Duration::Days(1.0))
+            {
+                // Data gaps cannot be extrapolated across
+
+                try
+                {
+                    const Date date = CSSISpaceWeather_.accessLastReadingWhere(predicate, instant).date;
+
+                    EXPECT_EQ(date, CSSISpaceWeather_.accessLastReadingWithDefined(field, instant).date)
+                        << instant.toString();
+                }
+                catch (const ostk::core::error::RuntimeError&)
+                {
+                    EXPECT_THROW(
+                        CSSISpaceWeather_.accessLastReadingWithDefined(field, instant), ostk::core::error::RuntimeError
+                    ) << instant.toString();
+                }
+            }
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, GetNRLMSISE00InputAt)
+{
+    {
+        EXPECT_THROW(
+            CSSISpaceWeather::Undefined().getNRLMSISE00InputAt(
+                Instant::DateTime(DateTime::Parse("2023-06-29 00:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_THROW(
+            CSSISpaceWeather_.getNRLMSISE00InputAt(Instant::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    // Out of range, including the first 57 hours of observations
+
+    {
+        EXPECT_THROW(
+            CSSISpaceWeather_.getNRLMSISE00InputAt(
+                Instant::DateTime(DateTime::Parse("2010-01-01 00:00:00"), Scale::UTC)
+            ),
+            ostk::core::error::RuntimeError
+        );
+
+        EXPECT_THROW(
+            CSSISpaceWeather_.getNRLMSISE00InputAt(
+                CSSISpaceWeather_.accessObservationInterval().accessStart() + Duration::Hours(56.0)
+            ),
+            ostk::core::error::RuntimeError
+        );
+
+        EXPECT_NO_THROW(CSSISpaceWeather_.getNRLMSISE00InputAt(
+            CSSISpaceWeather_.accessObservationInterval().accessStart() + Duration::Hours(57.0)
+        ));
+
+        EXPECT_THROW(
+            CSSISpaceWeather_.getNRLMSISE00InputAt(
+                CSSISpaceWeather_.accessMonthlyPredictionInterval().accessEnd() + Duration::Days(1.0)
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+
+    // Precomputed inputs match the per-day readings, extrapolated with `accessLastReadingWhere`
+
+    const Array<String> fileNames = {"SW-Last5Years.test.csv", "SW-Last5Years_missing_data.test.csv"};
+
+    for (const auto& fileName : fileNames)
+    {
+        const CSSISpaceWeather spaceWeather = CSSISpaceWeather::Load(File::Path(
+            Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather/" + fileName)
+        ));
+
+        const auto resolve = [&spaceWeather](
+                                 const Instant& anInstant,
+                                 const std::function<bool(const CSSISpaceWeather::Reading&)>& aPredicate
+                             ) -> const CSSISpaceWeather::Reading&
+        {
+            const CSSISpaceWeather::Reading& reading = spaceWeather.accessReadingAt(anInstant);
+
+            return aPredicate(reading) ? reading : spaceWeather.accessLastReadingWhere(aPredicate, anInstant);
+        };
+
+        const auto ap3HourIndicesOf = [](const CSSISpaceWeather::Reading& aReading) -> Array<Integer>
+        {
+            return {
+                aReading.Ap1,
+                aReading.Ap2,
+                aReading.Ap3,
+                aReading.Ap4,
+                aReading.Ap5,
+                aReading.Ap6,
+                aReading.Ap7,
+                aReading.Ap8,
+            };
+        };
+
+        // Reference inputs, stacking the 3-hour Ap indices of the days spanning from 57 hours before the instant
+
+        const auto referenceInputAt = [&resolve, &ap3HourIndicesOf](const Instant& anInstant
+                                      ) -> CSSISpaceWeather::NRLMSISE00Input
+        {
+            const Instant firstInstant = anInstant - Duration::Hours(57.0);
+
+            Array<Instant> dayInstants = {
+                firstInstant, anInstant - Duration::Hours(33.0), anInstant - Duration::Hours(9.0)
+            };
+
+            if (dayInstants.accessLast().getDateTime(Scale::UTC).getDate() !=
+                anInstant.getDateTime(Scale::UTC).getDate())
+            {
+                dayInstants.add(anInstant);
+            }
+
+            Array<double> apIndices = Array<double>::Empty();
+
+            for (const Instant& dayInstant : dayInstants)
+            {
+                const Array<Integer> dayApIndices = ap3HourIndicesOf(resolve(
+                    dayInstant,
+                    [&ap3HourIndicesOf](const CSSISpaceWeather::Reading& aReading) -> bool
+                    {
+                        const Array<Integer> readingApIndices = ap3HourIndicesOf(aReading);
+
+                        return std::all_of(
+                            readingApIndices.begin(),
+                            readingApIndices.end(),
+                            [](const Integer& anAp)
+                            {
+                                return anAp.isDefined();
+                            }
+                        );
+                    }
+                ));
+
+                for (const Integer& apIndex : dayApIndices)
+                {
+                    apIndices.add(static_cast<double>(apIndex));
+                }
+            }
+
+            const Size firstSlotIndex = firstInstant.getDateTime(Scale::UTC).getTime().getHour() / 3;
+
+            const auto averageOf = [&apIndices](const Size aSlotIndex) -> double
+            {
+                double sum = 0.0;
+
+                for (Size slotIndex = aSlotIndex; slotIndex < aSlotIndex + 8; ++slotIndex)
+                {
+                    sum += apIndices[slotIndex];
+                }
+
+                return sum / 8.0;
+            };
+
+            const double apDaily = static_cast<double>(resolve(
+                                                           anInstant,
+                                                           [](const CSSISpaceWeather::Reading& aReading) -> bool
+                                                           {
+                                                               return aReading.ApAvg.isDefined();
+                                                           }
+            )
+                                                           .ApAvg);
+
+            const double f107 = resolve(
+                                    anInstant - Duration::Days(1.0),
+                                    [](const CSSISpaceWeather::Reading& aReading) -> bool
+                                    {
+                                        return aReading.F107Obs.isDefined();
+                                    }
+            )
+                                    .F107Obs;
+
+            const double f107Average = resolve(
+                                           anInstant,
+                                           [](const CSSISpaceWeather::Reading& aReading) -> bool
+                                           {
+                                               return aReading.F107ObsCenter81.isDefined();
+                                           }
+            )
+                                           .F107ObsCenter81;
+
+            return {
+                {
+                    apDaily,
+                    apIndices[firstSlotIndex + 19],
+                    apIndices[firstSlotIndex + 18],
+                    apIndices[firstSlotIndex + 17],
+                    apIndices[firstSlotIndex + 16],
+                    averageOf(firstSlotIndex + 8),
+                    averageOf(firstSlotIndex),
+                },
+                f107,
+                f107Average,
+            };
+        };
+
+        const Instant startInstant = spaceWeather.accessObservationInterval().accessStart() + Duration::Hours(57.0);
+        const Instant endInstant = spaceWeather.accessMonthlyPredictionInterval().accessEnd();
+
+        for (Instant instant = startInstant; instant < endInstant; instant += Duration::Hours(7.0))
+        {
+            CSSISpaceWeather::NRLMSISE00Input referenceInput;
+
+            try
+            {
+                referenceInput = referenceInputAt(instant);
+            }
+            catch (const ostk::core::error::RuntimeError&)
+            {
+                // Reference cannot be extrapolated (data gaps, or the search skipping the last daily prediction)
+                continue;
+            }
+
+            const CSSISpaceWeather::NRLMSISE00Input input = spaceWeather.getNRLMSISE00InputAt(instant);
+
+            for (Size index = 0; index < 7; ++index)
+            {
+                EXPECT_EQ(referenceInput.ap[index], input.ap[index]) << instant.toString(Scale::UTC) << " " << index;
+            }
+
+            EXPECT_EQ(referenceInput.f107, input.f107) << instant.toString(Scale::UTC);
+            EXPECT_EQ(referenceInput.f107Average, input.f107Average) << instant.toString(Scale::UTC);
+        }
+    }
+
+    // Missing days cannot be extrapolated across
+
+    {
+        const CSSISpaceWeather spaceWeather = CSSISpaceWeather::Load(File::Path(Path::Parse(
+            "/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather/"
+            "SW-Last5Years_missing_data.test.csv"
+        )));
+
+        EXPECT_THROW(
+            spaceWeather.getNRLMSISE00InputAt(Instant::DateTime(DateTime::Parse("2020-01-01 12:00:00"), Scale::UTC)),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_CSSISpaceWeather, Load)
 {
     {
@@ -0,0 +1,194 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Unique.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/HarrisPriester.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Integer;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Unique;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::atmospheric::earth::HarrisPriester;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, Constructor)
+{
+    {
+        EXPECT_NO_THROW(HarrisPriester());
+    }
+
+    {
+        EXPECT_NO_THROW(HarrisPriester(
+            2,
+            Frame::ITRF(),
+            EarthGravitationalModel::WGS84.equatorialRadius_,
+            EarthGravitationalModel::WGS84.flattening_,
+            std::make_shared<Celestial>(Sun::Default())
+        ));
+    }
+
+    {
+        EXPECT_ANY_THROW(HarrisPriester(Integer::Undefined()));
+        EXPECT_ANY_THROW(HarrisPriester(1));
+        EXPECT_ANY_THROW(HarrisPriester(7));
+        EXPECT_ANY_THROW(HarrisPriester(4, nullptr));
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, Clone)
+{
+    {
+        const HarrisPriester harrisPriester = {6};
+
+        const Unique<HarrisPriester> harrisPriesterUPtr(harrisPriester.clone());
+
+        EXPECT_EQ(6, harrisPriesterUPtr->getCosinePower());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, IsDefined)
+{
+    {
+        const HarrisPriester harrisPriester = {};
+
+        EXPECT_TRUE(harrisPriester.isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, GetCosinePower)
+{
+    {
+        EXPECT_EQ(4, HarrisPriester().getCosinePower());
+        EXPECT_EQ(2, HarrisPriester(2).getCosinePower());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_HarrisPriester, GetDensityAt)
+{
+    // Close to the March equinox, at 12:00 UTC, the mean Sun is over the prime meridian and the declination is close to
+    // zero: the bulge apex is at (0 deg, 30 deg) and the antapex at (0 deg, -150 deg)
+
+    const Instant instant = Instant::DateTime(DateTime::Parse("2021-03-20 12:00:00"), Scale::UTC);
+
+    {
+        const HarrisPriester harrisPriester = {};
+
+        // Apex, maximum density
+
+        EXPECT_NEAR(
+            7.492e-12,
+            harrisPriester.getDensityAt(
+                LLA(Angle::Degrees(0.0), Angle::Degrees(30.0), Length::Kilometers(400.0)), instant
+            ),
+            1e-16
+        );
+
+        // Antapex, minimum density
+
+        EXPECT_NEAR(
+            2.249e-12,
+            harrisPriester.getDensityAt(
+                LLA(Angle::Degrees(0.0), Angle::Degrees(-150.0), Length::Kilometers(400.0)), instant
+            ),
+            1e-18
+        );
+
+        // Exponential interpolation between tabulated altitudes
+
+        EXPECT_NEAR(
+            1.871882e-12,
+            harrisPriester.getDensityAt(
+                LLA(Angle::Degrees(0.0), Angle::Degrees(-150.0), Length::Kilometers(410.0)), instant
+            ),
+            1e-17
+        );
+
+        // Table bounds
+
+        EXPECT_NEAR(
+            4.974e-07,
+            harrisPriester.getDensityAt(
+                LLA(Angle::Degrees(45.0), Angle::Degrees(10.0), Length::Kilometers(100.0)), instant
+            ),
+            1e-12
+        );
+
+        const Real density = harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(45.0), Angle::Degrees(10.0), Length::Kilometers(1000.0)), instant
+        );
+
+        EXPECT_LT(1.150e-15, density);
+        EXPECT_GT(1.810e-14, density);
+    }
+
+    // 90 deg from the apex, the bulge weight is 0.5^(n / 2)
+
+    {
+        const LLA lla = LLA(Angle::Degrees(0.0), Angle::Degrees(120.0), Length::Kilometers(400.0));
+
+        EXPECT_NEAR(2.249e-12 + (7.492e-12 - 2.249e-12) * 0.5, HarrisPriester(2).getDensityAt(lla, instant), 1e-18);
+        EXPECT_NEAR(
+            2.249e-12 + (7.492e-12 - 2.249e-12) * 0.125, HarrisPriester(6).getDensityAt(lla, instant), 1e-18
+        );
+    }
+
+    // With the Sun ephemeris
+
+    {
+        const HarrisPriester harrisPriester = {
+            4,
+            Frame::ITRF(),
+            EarthGravitationalModel::WGS84.equatorialRadius_,
+            EarthGravitationalModel::WGS84.flattening_,
+            std::make_shared<Celestial>(Sun::Default()),
+        };
+
+        const Real apexDensity = harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(30.0), Length::Kilometers(400.0)), instant
+        );
+        const Real antapexDensity = harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(-150.0), Length::Kilometers(400.0)), instant
+        );
+
+        EXPECT_NEAR(7.492e-12, apexDensity, 1e-14);
+        EXPECT_NEAR(2.249e-12, antapexDensity, 1e-14);
+    }
+
+    {
+        const HarrisPriester harrisPriester = {};
+
+        EXPECT_ANY_THROW(harrisPriester.getDensityAt(LLA::Undefined(), instant));
+        EXPECT_ANY_THROW(harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(400.0)), Instant::Undefined()
+        ));
+        EXPECT_ANY_THROW(harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(99.0)), instant
+        ));
+        EXPECT_ANY_THROW(harrisPriester.getDensityAt(
+            LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(1001.0)), instant
+        ));
+    }
+}
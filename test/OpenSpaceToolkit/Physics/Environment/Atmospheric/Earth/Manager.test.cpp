@@ -1,5 +1,10 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/Container/Tuple.hpp>
@@ -393,6 +398,92 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetF107So
     }
 }
 
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetNRLMSISE00InputAt)
+{
+    {
+        const Array<String> referenceDateTimes = {
+            "2018-01-05 12:34:56",  // observation
+            "2023-06-18 00:00:00",
+            "2023-08-02 22:59:59",  // daily prediction
+            "2023-10-01 12:34:56",  // monthly prediction
+            "2028-09-01 12:34:56",
+        };
+
+        for (const auto& referenceDateTime : referenceDateTimes)
+        {
+            const Instant instant = Instant::DateTime(DateTime::Parse(referenceDateTime), Scale::UTC);
+
+            const CSSISpaceWeather::NRLMSISE00Input input = manager_.getNRLMSISE00InputAt(instant);
+
+            const Array<Integer> apIndices = manager_.getAp3HourSolarIndicesAt(instant);
+            const int slotIndex = instant.getDateTime(Scale::UTC).getTime().getHour() / 3;
+
+            EXPECT_EQ(Real(manager_.getApDailyIndexAt(instant)), input.ap[0]);
+            EXPECT_EQ(Real(apIndices[slotIndex]), input.ap[1]);
+            EXPECT_EQ(manager_.getF107SolarFluxAt(instant - Duration::Days(1)), input.f107);
+            EXPECT_EQ(manager_.getF107SolarFlux81DayAvgAt(instant), input.f107Average);
+        }
+    }
+
+    {
+        manager_.setMode(Manager::Mode::Manual);
+
+        EXPECT_THROW(manager_.getNRLMSISE00InputAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            manager_.getNRLMSISE00InputAt(Instant::DateTime(DateTime::Parse("2010-01-01 00:00:00"), Scale::UTC)),
+            ostk::core::error::RuntimeError
+        );
+
+        manager_.setMode(Manager::Mode::Automatic);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, GetNRLMSISE00InputAtConcurrently)
+{
+    // Queries read the published space weather without the manager mutex, while it is being reloaded
+
+    {
+        const Instant instant = Instant::DateTime(DateTime::Parse("2023-06-18 12:34:56"), Scale::UTC);
+
+        const CSSISpaceWeather::NRLMSISE00Input referenceInput = spaceWeather_.getNRLMSISE00InputAt(instant);
+
+        std::atomic<int> mismatchCount = {0};
+
+        Array<std::thread> threads = Array<std::thread>::Empty();
+
+        for (int threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+            threads.add(std::thread(
+                [this, &instant, &referenceInput, &mismatchCount]()
+                {
+                    for (int iteration = 0; iteration < 1000; ++iteration)
+                    {
+                        const CSSISpaceWeather::NRLMSISE00Input input = manager_.getNRLMSISE00InputAt(instant);
+
+                        if ((!std::equal(std::begin(input.ap), std::end(input.ap), std::begin(referenceInput.ap))) ||
+                            (input.f107 != referenceInput.f107) || (input.f107Average != referenceInput.f107Average))
+                        {
+                            ++mismatchCount;
+                        }
+                    }
+                }
+            ));
+        }
+
+        for (int iteration = 0; iteration < 10; ++iteration)
+        {
+            manager_.loadCSSISpaceWeather(spaceWeather_);
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatchCount.load());
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_Manager, LoadCSSISpaceWeather)
 {
     {
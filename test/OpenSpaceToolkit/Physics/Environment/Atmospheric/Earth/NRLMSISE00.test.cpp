@@ -1,5 +1,11 @@
 /// Apache License 2.0
 
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Table.hpp>
 #include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
@@ -12,6 +18,7 @@
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/PositionArray.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Manager.hpp>
@@ -38,14 +45,18 @@ using ostk::core::type::Size;
 using ostk::core::type::String;
 using ostk::core::type::Unique;
 
+using ostk::mathematics::object::VectorXd;
+
 using ostk::physics::coordinate::Frame;
 using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::PositionArray;
 using ostk::physics::coordinate::spherical::LLA;
 using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
 using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
 using ostk::physics::environment::object::Celestial;
 using ostk::physics::environment::object::celestial::Sun;
 using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
 using ostk::physics::time::Scale;
 using ostk::physics::unit::Angle;
@@ -996,3 +1007,464 @@ TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDen
         }
     }
 }
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDensityAtConcurrently)
+{
+    /*
+     * Densities evaluated from multiple threads match the sequential evaluation bit for bit.
+     */
+    const Array<NRLMSISE00> models = {
+        NRLMSISE00(NRLMSISE00::InputDataType::CSSISpaceWeatherFile),
+        NRLMSISE00(NRLMSISE00::InputDataType::ConstantFluxAndGeoMag, 200.0, 205.0, 3.0),
+    };
+
+    const Instant startInstant = Instant::DateTime(DateTime(2023, 6, 22, 0, 0, 0), Scale::UTC);
+
+    Array<LLA> llas = Array<LLA>::Empty();
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Index i = 0; i < 400; ++i)
+    {
+        llas.add(LLA(
+            Angle::Degrees(-80.0 + 0.4 * Real::Integer(i)),
+            Angle::Degrees(-180.0 + 0.9 * Real::Integer(i)),
+            Length::Kilometers(100.0 + 2.0 * Real::Integer(i))
+        ));
+        instants.add(startInstant + ostk::physics::time::Duration::Minutes(37.0 * Real::Integer(i)));
+    }
+
+    for (const NRLMSISE00& model : models)
+    {
+        std::vector<double> referenceDensities(llas.getSize());
+
+        for (Index i = 0; i < llas.getSize(); ++i)
+        {
+            referenceDensities[i] = model.getDensityAt(llas[i], instants[i]);
+        }
+
+        std::vector<double> densities(llas.getSize());
+
+        const Size threadCount = 4;
+
+        std::vector<std::thread> threads;
+
+        for (Index threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]()
+                {
+                    for (Index i = threadIndex; i < llas.getSize(); i += threadCount)
+                    {
+                        densities[i] = model.getDensityAt(llas[i], instants[i]);
+                    }
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (Index i = 0; i < llas.getSize(); ++i)
+        {
+            EXPECT_EQ(referenceDensities[i], densities[i]) << i;
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDensityAtSerialKernelReference)
+{
+    /*
+     * The NRLMSISE-00 C library is built with its working state thread-local (see thirdparty/nrlmsise-00). Before the
+     * patch is applied, the development image records the densities of the serial kernel at the Orekit reference
+     * inputs, in hexadecimal floating point (see RecordReferenceDensities.c). The patched library reproduces them bit
+     * for bit, on a fresh thread, sequentially and from several threads at once, in reverse order.
+     */
+    const File referenceDataFile =
+        File::Path(Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00/"
+                               "OreKitNRLMSISEInputsAndDensity.csv"));
+
+    const Table referenceData = Table::Load(referenceDataFile, Table::Format::CSV, true);
+
+    std::vector<double> serialKernelDensities;
+
+    {
+        std::ifstream serialKernelDensityStream {"/usr/local/share/NRLMSISE-00/SerialKernelDensities.csv"};
+
+        ASSERT_TRUE(serialKernelDensityStream.is_open());
+
+        std::string line;
+
+        std::getline(serialKernelDensityStream, line);  // Header
+
+        while (std::getline(serialKernelDensityStream, line))
+        {
+            serialKernelDensities.push_back(std::strtod(line.substr(line.find(',') + 1).c_str(), nullptr));
+        }
+    }
+
+    const Size pointCount = referenceData.getRowCount();
+
+    ASSERT_EQ(pointCount, serialKernelDensities.size());
+
+    std::vector<NRLMSISE00Public::ap_array> apArrays;
+    std::vector<NRLMSISE00Public::nrlmsise_input> inputs;
+
+    for (Index i = 0; i < pointCount; ++i)
+    {
+        apArrays.push_back({{
+            referenceData(i, "AP1").accessReal(),
+            referenceData(i, "AP2").accessReal(),
+            referenceData(i, "AP3").accessReal(),
+            referenceData(i, "AP4").accessReal(),
+            referenceData(i, "AP5").accessReal(),
+            referenceData(i, "AP6").accessReal(),
+            referenceData(i, "AP7").accessReal(),
+        }});
+
+        inputs.push_back({
+            2022,
+            referenceData(i, "DOY").accessInteger(),
+            referenceData(i, "SEC").accessReal(),
+            referenceData(i, "ALT").accessReal(),
+            referenceData(i, "LAT").accessReal(),
+            referenceData(i, "LON").accessReal(),
+            referenceData(i, "LST").accessReal(),
+            referenceData(i, "AVG_FLUX").accessReal(),
+            referenceData(i, "DAILY_FLUX").accessReal(),
+            referenceData(i, "AP1").accessReal(),
+            nullptr,
+        });
+    }
+
+    for (Index i = 0; i < pointCount; ++i)
+    {
+        inputs[i].ap_a = &apArrays[i];
+    }
+
+    // First evaluation on a fresh thread, every 50 points
+
+    for (Index i = 0; i < pointCount; i += 50)
+    {
+        double density = 0.0;
+
+        std::thread thread(
+            [&, i]()
+            {
+                NRLMSISE00Public::nrlmsise_input input = inputs[i];
+                density = NRLMSISE00Public::GetDensityAt(input);
+            }
+        );
+
+        thread.join();
+
+        EXPECT_EQ(serialKernelDensities[i], density) << i;
+    }
+
+    // Sequential evaluation
+
+    for (Index i = 0; i < pointCount; ++i)
+    {
+        NRLMSISE00Public::nrlmsise_input input = inputs[i];
+
+        EXPECT_EQ(serialKernelDensities[i], NRLMSISE00Public::GetDensityAt(input)) << i;
+    }
+
+    // Concurrent evaluation, in reverse order
+
+    std::vector<double> concurrentDensities(pointCount);
+
+    {
+        const Size threadCount = 8;
+
+        std::vector<std::thread> threads;
+
+        for (Index threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]()
+                {
+                    for (Index j = threadIndex; j < pointCount; j += threadCount)
+                    {
+                        const Index i = pointCount - 1 - j;
+
+                        NRLMSISE00Public::nrlmsise_input input = inputs[i];
+                        concurrentDensities[i] = NRLMSISE00Public::GetDensityAt(input);
+                    }
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    for (Index i = 0; i < pointCount; ++i)
+    {
+        EXPECT_EQ(serialKernelDensities[i], concurrentDensities[i]) << i;
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDensitiesAt)
+{
+    const Array<LLA> llas = {
+        LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(500.0)),
+        LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(350.0)),
+        LLA(Angle::Degrees(-60.0), Angle::Degrees(120.0), Length::Kilometers(120.0)),
+        LLA(Angle::Degrees(89.0), Angle::Degrees(-179.0), Length::Kilometers(800.0)),
+    };
+
+    const Instant instant = Instant::DateTime(DateTime::Parse("2021-01-01 05:30:00"), Scale::UTC);
+
+    PositionArray::Matrix3Xd coordinates(3, llas.getSize());
+
+    for (Index index = 0; index < llas.getSize(); ++index)
+    {
+        coordinates.col(index) = llas[index].toCartesian(
+            EarthGravitationalModel::WGS84.equatorialRadius_, EarthGravitationalModel::WGS84.flattening_
+        );
+    }
+
+    const PositionArray positionArray = PositionArray::Meters(coordinates, Frame::ITRF());
+
+    {
+        const Array<NRLMSISE00> nrlmsises = {
+            {NRLMSISE00::InputDataType::CSSISpaceWeatherFile},
+            {NRLMSISE00::InputDataType::ConstantFluxAndGeoMag, 150.0, 150.0, 3.0},
+        };
+
+        for (const NRLMSISE00& nrlmsise : nrlmsises)
+        {
+            const VectorXd densities = nrlmsise.getDensitiesAt(positionArray, instant);
+
+            ASSERT_EQ(llas.getSize(), static_cast<Size>(densities.size()));
+
+            for (Index index = 0; index < llas.getSize(); ++index)
+            {
+                const Real referenceDensity = nrlmsise.getDensityAt(llas[index], instant);
+
+                EXPECT_NEAR(referenceDensity, densities(index), 1e-10 * referenceDensity);
+            }
+        }
+    }
+
+    {
+        const NRLMSISE00 nrlmsise = {};
+
+        const PositionArray emptyPositionArray = PositionArray::Meters(PositionArray::Matrix3Xd(3, 0), Frame::ITRF());
+
+        EXPECT_EQ(0, nrlmsise.getDensitiesAt(emptyPositionArray, instant).size());
+
+        EXPECT_ANY_THROW(nrlmsise.getDensitiesAt(PositionArray::Undefined(), instant));
+        EXPECT_ANY_THROW(nrlmsise.getDensitiesAt(positionArray, Instant::Undefined()));
+        EXPECT_ANY_THROW(nrlmsise.getDensitiesAt(positionArray, Array<Instant>::Empty()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDensitiesAtConcurrently)
+{
+    /*
+     * A batch split across threads gives the same densities, bit for bit, as the same batch evaluated sequentially,
+     * and as the same positions evaluated in slices.
+     */
+    const Size positionCount = 5000;
+    const Size sliceSize = 100;
+
+    const Instant startInstant = Instant::DateTime(DateTime(2023, 6, 22, 0, 0, 0), Scale::UTC);
+
+    PositionArray::Matrix3Xd coordinates(3, positionCount);
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Index index = 0; index < positionCount; ++index)
+    {
+        coordinates.col(index) =
+            LLA(Angle::Degrees(-80.0 + 0.032 * Real::Integer(index)),
+                Angle::Degrees(-180.0 + 0.072 * Real::Integer(index)),
+                Length::Kilometers(100.0 + 0.16 * Real::Integer(index)))
+                .toCartesian(
+                    EarthGravitationalModel::WGS84.equatorialRadius_, EarthGravitationalModel::WGS84.flattening_
+                );
+
+        instants.add(startInstant + Duration::Seconds(10.0 * Real::Integer(index / 10)));
+    }
+
+    const PositionArray positionArray = PositionArray::Meters(coordinates, Frame::ITRF());
+
+    {
+        const Array<NRLMSISE00> nrlmsises = {
+            {NRLMSISE00::InputDataType::CSSISpaceWeatherFile},
+            {NRLMSISE00::InputDataType::ConstantFluxAndGeoMag, 150.0, 150.0, 3.0},
+        };
+
+        for (const NRLMSISE00& nrlmsise : nrlmsises)
+        {
+            for (const Array<Instant>& batchInstants : {Array<Instant> {startInstant}, instants})
+            {
+                const VectorXd densities = nrlmsise.getDensitiesAt(positionArray, batchInstants, 4);
+
+                ASSERT_EQ(positionCount, static_cast<Size>(densities.size()));
+
+                const VectorXd sequentialDensities = nrlmsise.getDensitiesAt(positionArray, batchInstants);
+
+                for (Index index = 0; index < positionCount; ++index)
+                {
+                    EXPECT_EQ(sequentialDensities(index), densities(index)) << index;
+                }
+
+                for (Index sliceIndex = 0; sliceIndex < positionCount; sliceIndex += sliceSize)
+                {
+                    const PositionArray slicePositionArray =
+                        PositionArray::Meters(coordinates.middleCols(sliceIndex, sliceSize), Frame::ITRF());
+
+                    Array<Instant> sliceInstants = Array<Instant>::Empty();
+
+                    for (Index index = 0; index < ((batchInstants.getSize() == 1) ? 1 : sliceSize); ++index)
+                    {
+                        sliceInstants.add(batchInstants[(batchInstants.getSize() == 1) ? 0 : sliceIndex + index]);
+                    }
+
+                    const VectorXd sliceDensities = nrlmsise.getDensitiesAt(slicePositionArray, sliceInstants);
+
+                    for (Index index = 0; index < sliceSize; ++index)
+                    {
+                        EXPECT_EQ(sliceDensities(index), densities(sliceIndex + index)) << sliceIndex + index;
+                    }
+                }
+            }
+        }
+    }
+
+    {
+        Array<Instant> undefinedInstants = instants;
+        undefinedInstants[positionCount - 1] = Instant::Undefined();
+
+        EXPECT_ANY_THROW(NRLMSISE00().getDensitiesAt(positionArray, undefinedInstants, 4));
+    }
+
+    {
+        EXPECT_ANY_THROW(NRLMSISE00().getDensitiesAt(positionArray, instants, 0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00, GetDensityAtMemoizedSunPosition)
+{
+    const Shared<Celestial> sun = std::make_shared<Celestial>(Sun::Default());
+
+    const LLA lla = LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(350.0));
+
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Index index = 0; index < 12; ++index)
+    {
+        instants.add(
+            Instant::DateTime(DateTime::Parse("2021-01-01 05:30:00"), Scale::UTC) + Duration::Minutes(7.0 * index)
+        );
+    }
+
+    {
+        const NRLMSISE00 nrlmsise = {
+            NRLMSISE00::InputDataType::CSSISpaceWeatherFile,
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Frame::ITRF(),
+            EarthGravitationalModel::WGS84.equatorialRadius_,
+            EarthGravitationalModel::WGS84.flattening_,
+            sun,
+        };
+
+        // More instants than memoized Sun positions, visited twice, so that both hits and evictions are exercised
+
+        for (Index pass = 0; pass < 2; ++pass)
+        {
+            for (const Instant& instant : instants)
+            {
+                const NRLMSISE00 referenceNRLMSISE00 = {
+                    NRLMSISE00::InputDataType::CSSISpaceWeatherFile,
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Real::Undefined(),
+                    Frame::ITRF(),
+                    EarthGravitationalModel::WGS84.equatorialRadius_,
+                    EarthGravitationalModel::WGS84.flattening_,
+                    sun,
+                };
+
+                const Real referenceDensity = referenceNRLMSISE00.getDensityAt(lla, instant);
+
+                EXPECT_EQ(referenceDensity, nrlmsise.getDensityAt(lla, instant));
+                EXPECT_EQ(referenceDensity, nrlmsise.getDensityAt(lla, instant));
+            }
+        }
+
+        const NRLMSISE00 copiedNRLMSISE00 = nrlmsise;
+
+        EXPECT_EQ(
+            nrlmsise.getDensityAt(lla, instants.accessLast()), copiedNRLMSISE00.getDensityAt(lla, instants.accessLast())
+        );
+
+        // Sun positions are memoized per thread: concurrent evaluations match the sequential ones
+
+        std::vector<double> concurrentDensities(instants.getSize());
+        std::vector<std::thread> threads;
+
+        for (Index threadIndex = 0; threadIndex < 2; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]()
+                {
+                    for (Index index = threadIndex; index < instants.getSize(); index += 2)
+                    {
+                        concurrentDensities[index] = nrlmsise.getDensityAt(lla, instants[index]);
+                    }
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (Index index = 0; index < instants.getSize(); ++index)
+        {
+            EXPECT_EQ(nrlmsise.getDensityAt(lla, instants[index]), concurrentDensities[index]) << index;
+        }
+    }
+
+    // Models sharing a thread do not share their memoized Sun positions
+
+    {
+        const NRLMSISE00 itrfNRLMSISE00 = {
+            NRLMSISE00::InputDataType::CSSISpaceWeatherFile,
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Frame::ITRF(),
+            EarthGravitationalModel::WGS84.equatorialRadius_,
+            EarthGravitationalModel::WGS84.flattening_,
+            sun,
+        };
+
+        const NRLMSISE00 gcrfNRLMSISE00 = {
+            NRLMSISE00::InputDataType::CSSISpaceWeatherFile,
+            Real::Undefined(),
+            Real::Undefined(),
+            Real::Undefined(),
+            Frame::GCRF(),
+            EarthGravitationalModel::WGS84.equatorialRadius_,
+            EarthGravitationalModel::WGS84.flattening_,
+            sun,
+        };
+
+        const Instant instant = instants.accessFirst();
+
+        const Real itrfDensity = itrfNRLMSISE00.getDensityAt(lla, instant);
+
+        EXPECT_NE(itrfDensity, gcrfNRLMSISE00.getDensityAt(lla, instant));
+        EXPECT_EQ(itrfDensity, itrfNRLMSISE00.getDensityAt(lla, instant));
+    }
+}
@@ -0,0 +1,451 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/Unique.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Spherical/LLA.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/CSSISpaceWeather.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/Manager.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00Grid.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Sun.hpp>
+#include <OpenSpaceToolkit/Physics/Time/DateTime.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Scale.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Derived/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::Unique;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::spherical::LLA;
+using ostk::physics::environment::atmospheric::earth::CSSISpaceWeather;
+using ostk::physics::environment::atmospheric::earth::Manager;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00;
+using ostk::physics::environment::atmospheric::earth::NRLMSISE00Grid;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::environment::object::celestial::Sun;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+using EarthGravitationalModel = ostk::physics::environment::gravitational::Earth;
+
+class OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const File file = File::Path(
+            Path::Parse("/app/test/OpenSpaceToolkit/Physics/Environment/Atmospheric/Earth/NRLMSISE00/SW-Last5Years.csv")
+        );
+        const CSSISpaceWeather spaceWeather = CSSISpaceWeather::Load(file);
+
+        manager_.loadCSSISpaceWeather(spaceWeather);
+    }
+
+    // Coarse grid, to keep bucket builds cheap
+
+    NRLMSISE00Grid buildCoarseGrid(const NRLMSISE00& aNRLMSISE00Model, const Size& aCapacity = 64) const
+    {
+        return {
+            aNRLMSISE00Model,
+            Length::Kilometers(300.0),
+            Length::Kilometers(600.0),
+            Length::Kilometers(50.0),
+            Angle::Degrees(30.0),
+            Duration::Hours(3.0),
+            Duration::Hours(3.0),
+            aCapacity,
+        };
+    }
+
+    Manager& manager_ = Manager::Get();
+
+    const Instant instant_ = Instant::DateTime(DateTime::Parse("2021-01-01 04:30:00"), Scale::UTC);
+};
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid, Constructor)
+{
+    {
+        EXPECT_NO_THROW(NRLMSISE00Grid grid = {});
+    }
+
+    {
+        EXPECT_NO_THROW(NRLMSISE00Grid grid(
+            NRLMSISE00(NRLMSISE00::InputDataType::ConstantFluxAndGeoMag, 150.0, 150.0, 3.0),
+            Length::Kilometers(200.0),
+            Length::Kilometers(700.0),
+            Length::Kilometers(7.0),
+            Angle::Degrees(7.0),
+            Duration::Minutes(50.0),
+            Duration::Hours(1.0),
+            4
+        ));
+    }
+
+    {
+        const NRLMSISE00 nrlmsise = {};
+
+        EXPECT_ANY_THROW(NRLMSISE00Grid(nrlmsise, Length::Undefined()));
+        EXPECT_ANY_THROW(NRLMSISE00Grid(nrlmsise, Length::Kilometers(-1.0)));
+        EXPECT_ANY_THROW(NRLMSISE00Grid(nrlmsise, Length::Kilometers(500.0), Length::Kilometers(400.0)));
+        EXPECT_ANY_THROW(
+            NRLMSISE00Grid(nrlmsise, Length::Kilometers(100.0), Length::Kilometers(1000.0), Length::Kilometers(0.0))
+        );
+        EXPECT_ANY_THROW(NRLMSISE00Grid(
+            nrlmsise,
+            Length::Kilometers(100.0),
+            Length::Kilometers(1000.0),
+            Length::Kilometers(5.0),
+            Angle::Degrees(0.0)
+        ));
+        EXPECT_ANY_THROW(NRLMSISE00Grid(
+            nrlmsise,
+            Length::Kilometers(100.0),
+            Length::Kilometers(1000.0),
+            Length::Kilometers(5.0),
+            Angle::Degrees(10.0),
+            Duration::Zero()
+        ));
+        EXPECT_ANY_THROW(NRLMSISE00Grid(
+            nrlmsise,
+            Length::Kilometers(100.0),
+            Length::Kilometers(1000.0),
+            Length::Kilometers(5.0),
+            Angle::Degrees(10.0),
+            Duration::Hours(1.0),
+            Duration::Hours(5.0)
+        ));
+        EXPECT_ANY_THROW(NRLMSISE00Grid(
+            nrlmsise,
+            Length::Kilometers(100.0),
+            Length::Kilometers(1000.0),
+            Length::Kilometers(5.0),
+            Angle::Degrees(10.0),
+            Duration::Hours(1.0),
+            Duration::Hours(3.0),
+            0
+        ));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid, Clone)
+{
+    {
+        const NRLMSISE00Grid grid = buildCoarseGrid({});
+
+        grid.getDensityAt(LLA(Angle::Degrees(0.0), Angle::Degrees(0.0), Length::Kilometers(400.0)), instant_);
+
+        const Unique<NRLMSISE00Grid> gridUPtr(grid.clone());
+
+        EXPECT_TRUE(gridUPtr->isDefined());
+        EXPECT_EQ(1, gridUPtr->getCachedBucketCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid, IsDefined)
+{
+    {
+        const NRLMSISE00Grid grid = {};
+
+        EXPECT_TRUE(grid.isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid, GetDensityAt)
+{
+    // Positions inside grid cells, away from the 5 km altitude and 10 deg latitude nodes
+
+    const Array<LLA> llas = {
+        LLA(Angle::Degrees(5.0), Angle::Degrees(3.0), Length::Kilometers(502.5)),
+        LLA(Angle::Degrees(35.076832), Angle::Degrees(-92.546296), Length::Kilometers(352.5)),
+        LLA(Angle::Degrees(-65.0), Angle::Degrees(120.0), Length::Kilometers(172.5)),
+        LLA(Angle::Degrees(85.0), Angle::Degrees(-179.0), Length::Kilometers(797.5)),
+        LLA(Angle::Degrees(-12.0), Angle::Degrees(179.9), Length::Kilometers(612.3)),
+    };
+
+    // Instants over the whole bucket, including its first and last quarters
+
+    const Array<Instant> instants = {
+        instant_,
+        instant_ + Duration::Minutes(1.0),
+        instant_ + Duration::Minutes(70.0),
+        instant_ - Duration::Minutes(80.0),
+    };
+
+    {
+        const Array<NRLMSISE00> nrlmsises = {
+            {NRLMSISE00::InputDataType::CSSISpaceWeatherFile},
+            {NRLMSISE00::InputDataType::ConstantFluxAndGeoMag, 150.0, 150.0, 3.0},
+            {NRLMSISE00::InputDataType::CSSISpaceWeatherFile,
+             Real::Undefined(),
+             Real::Undefined(),
+             Real::Undefined(),
+             Frame::ITRF(),
+             EarthGravitationalModel::WGS84.equatorialRadius_,
+             EarthGravitationalModel::WGS84.flattening_,
+             std::make_shared<Celestial>(Sun::Default())},
+        };
+
+        for (const NRLMSISE00& nrlmsise : nrlmsises)
+        {
+            const NRLMSISE00Grid grid = {nrlmsise};
+
+            for (const Instant& instant : instants)
+            {
+                for (const LLA& lla : llas)
+                {
+                    const Real referenceDensity = nrlmsise.getDensityAt(lla, instant);
+
+                    EXPECT_NEAR(referenceDensity, grid.getDensityAt(lla, instant), 0.01 * referenceDensity);
+                }
+            }
+
+            EXPECT_EQ(1, grid.getCachedBucketCount());
+        }
+    }
+
+    // Around local solar midnight, stencils span both ends of the day: densities are as accurate as elsewhere, and
+    // continuous across midnight (the mean Sun is at 112.5 deg longitude at 04:30 UTC)
+
+    {
+        const NRLMSISE00 nrlmsise = {};
+        const NRLMSISE00Grid grid = {nrlmsise};
+
+        const Array<double> localSolarTimes = {-0.9, -0.5, -0.1, -0.001, 0.001, 0.1, 0.5, 0.9};  // [h]
+
+        for (const double& localSolarTime : localSolarTimes)
+        {
+            const LLA lla = LLA(
+                Angle::Degrees(35.0), Angle::Degrees(-67.5 + 15.0 * localSolarTime), Length::Kilometers(452.5)
+            );
+
+            const Real referenceDensity = nrlmsise.getDensityAt(lla, instant_);
+
+            EXPECT_NEAR(referenceDensity, grid.getDensityAt(lla, instant_), 0.01 * referenceDensity) << localSolarTime;
+        }
+
+        const LLA beforeMidnightLLA =
+            LLA(Angle::Degrees(35.0), Angle::Degrees(-67.5 - 0.015), Length::Kilometers(452.5));
+        const LLA afterMidnightLLA =
+            LLA(Angle::Degrees(35.0), Angle::Degrees(-67.5 + 0.015), Length::Kilometers(452.5));
+
+        const Real beforeMidnightDensity = grid.getDensityAt(beforeMidnightLLA, instant_);
+
+        EXPECT_NEAR(beforeMidnightDensity, grid.getDensityAt(afterMidnightLLA, instant_), 1e-4 * beforeMidnightDensity);
+    }
+
+    // Out of the gridded altitude range, densities are forwarded to the NRLMSISE00 model
+
+    {
+        const NRLMSISE00 nrlmsise = {};
+        const NRLMSISE00Grid grid = buildCoarseGrid(nrlmsise);
+
+        const LLA lowLLA = LLA(Angle::Degrees(10.0), Angle::Degrees(20.0), Length::Kilometers(150.0));
+        const LLA highLLA = LLA(Angle::Degrees(10.0), Angle::Degrees(20.0), Length::Kilometers(900.0));
+
+        EXPECT_EQ(nrlmsise.getDensityAt(lowLLA, instant_), grid.getDensityAt(lowLLA, instant_));
+        EXPECT_EQ(nrlmsise.getDensityAt(highLLA, instant_), grid.getDensityAt(highLLA, instant_));
+
+        EXPECT_EQ(0, grid.getCachedBucketCount());
+    }
+
+    {
+        const NRLMSISE00Grid grid = buildCoarseGrid({});
+
+        EXPECT_ANY_THROW(grid.getDensityAt(LLA::Undefined(), instant_));
+        EXPECT_ANY_THROW(grid.getDensityAt(llas[0], Instant::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid, GetDensityAtLazyEvaluation)
+{
+    // Ground track of a 500 km, 51.6 deg inclination circular orbit, sampled every 10 s over a revolution, within the
+    // 03:00 - 06:00 UTC bucket
+
+    const Instant startInstant = Instant::DateTime(DateTime::Parse("2021-01-01 03:00:00"), Scale::UTC);
+
+    const double inclination = 51.6 * M_PI / 180.0;
+    const double orbitalPeriod = 5677.0;            // [s]
+    const double earthRotationRate = 7.2921159e-5;  // [rad/s]
+
+    Array<LLA> llas = Array<LLA>::Empty();
+    Array<Instant> instants = Array<Instant>::Empty();
+
+    for (Index index = 0; index < 568; ++index)
+    {
+        const double elapsedTime = 10.0 * index;
+        const double argumentOfLatitude = 2.0 * M_PI * elapsedTime / orbitalPeriod;
+
+        const double latitude = std::asin(std::sin(inclination) * std::sin(argumentOfLatitude));
+        const double longitude =
+            std::atan2(std::cos(inclination) * std::sin(argumentOfLatitude), std::cos(argumentOfLatitude)) -
+            earthRotationRate * elapsedTime;
+
+        llas.add(LLA(
+            Angle::Radians(latitude), Angle::Radians(std::remainder(longitude, 2.0 * M_PI)), Length::Kilometers(500.0)
+        ));
+        instants.add(startInstant + Duration::Seconds(elapsedTime));
+    }
+
+    const NRLMSISE00 nrlmsise = {};
+
+    // 2 grids of 181 altitudes, 19 latitudes and 24 local solar times
+
+    const Size gridNodeCount = 2 * 181 * 19 * 24;
+
+    {
+        const NRLMSISE00Grid grid = {nrlmsise};
+
+        std::vector<double> densities(llas.getSize());
+
+        for (Index index = 0; index < llas.getSize(); ++index)
+        {
+            densities[index] = grid.getDensityAt(llas[index], instants[index]);
+
+            const Real referenceDensity = nrlmsise.getDensityAt(llas[index], instants[index]);
+
+            EXPECT_NEAR(referenceDensity, densities[index], 0.01 * referenceDensity) << index;
+        }
+
+        // Only the nodes around the ground track are evaluated
+
+        EXPECT_EQ(1, grid.getCachedBucketCount());
+        EXPECT_LT(0, grid.getEvaluatedNodeCount());
+        EXPECT_GT(gridNodeCount / 20, grid.getEvaluatedNodeCount());
+
+        // Evaluating all the nodes does not change the densities
+
+        grid.computeMaximumRelativeErrorAt(startInstant);
+
+        EXPECT_EQ(gridNodeCount, grid.getEvaluatedNodeCount());
+
+        for (Index index = 0; index < llas.getSize(); ++index)
+        {
+            EXPECT_EQ(densities[index], grid.getDensityAt(llas[index], instants[index])) << index;
+        }
+
+        // Nodes evaluated concurrently match the sequentially evaluated ones
+
+        const NRLMSISE00Grid concurrentGrid = {nrlmsise};
+
+        std::vector<double> concurrentDensities(llas.getSize());
+
+        const Size threadCount = 4;
+
+        std::vector<std::thread> threads;
+
+        for (Index threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads.emplace_back(
+                [&, threadIndex]()
+                {
+                    for (Index index = threadIndex; index < llas.getSize(); index += threadCount)
+                    {
+                        concurrentDensities[index] = concurrentGrid.getDensityAt(llas[index], instants[index]);
+                    }
+                }
+            );
+        }
+
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (Index index = 0; index < llas.getSize(); ++index)
+        {
+            EXPECT_EQ(densities[index], concurrentDensities[index]) << index;
+        }
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid, ComputeMaximumRelativeErrorAt)
+{
+    {
+        const NRLMSISE00Grid grid = {
+            NRLMSISE00(),
+            Length::Kilometers(300.0),
+            Length::Kilometers(600.0),
+            Length::Kilometers(5.0),
+        };
+
+        const Real maximumRelativeError = grid.computeMaximumRelativeErrorAt(instant_);
+
+        EXPECT_LT(0.0, maximumRelativeError);
+        EXPECT_GT(0.01, maximumRelativeError);
+    }
+
+    {
+        const NRLMSISE00Grid grid = buildCoarseGrid({});
+
+        EXPECT_ANY_THROW(grid.computeMaximumRelativeErrorAt(Instant::Undefined()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Environment_Atmospheric_Earth_NRLMSISE00Grid, Cache)
+{
+    const LLA lla = LLA(Angle::Degrees(10.0), Angle::Degrees(20.0), Length::Kilometers(400.0));
+
+    {
+        NRLMSISE00Grid grid = buildCoarseGrid({}, 2);
+
+        EXPECT_EQ(0, grid.getCachedBucketCount());
+
+        const Real density = grid.getDensityAt(lla, instant_);
+
+        EXPECT_EQ(1, grid.getCachedBucketCount());
+
+        // Same bucket, as buckets are aligned on 3 hour marks
+
+        grid.getDensityAt(lla, instant_ - Duration::Hours(1.0));
+
+        EXPECT_EQ(1, grid.getCachedBucketCount());
+
+        grid.getDensityAt(lla, instant_ + Duration::Hours(3.0));
+
+        EXPECT_EQ(2, grid.getCachedBucketCount());
+
+        // The least recently used bucket is evicted
+
+        grid.getDensityAt(lla, instant_);
+        grid.getDensityAt(lla, instant_ + Duration::Hours(6.0));
+
+        EXPECT_EQ(2, grid.getCachedBucketCount());
+
+        EXPECT_EQ(density, grid.getDensityAt(lla, instant_));
+
+        EXPECT_EQ(2, grid.getCachedBucketCount());
+
+        grid.clearCache();
+
+        EXPECT_EQ(0, grid.getCachedBucketCount());
+
+        EXPECT_EQ(density, grid.getDensityAt(lla, instant_));
+    }
+}
@@ -1,5 +1,10 @@
 // test/OpenSpaceToolkit/Physics/Manager.test.cpp
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include <OpenSpaceToolkit/Core/FileSystem/Directory.hpp>
@@ -34,6 +39,31 @@ class ManagerMock : public Manager
           ) {};
 };
 
+class RefreshingManagerMock : public ManagerMock
+{
+   public:
+    using ManagerMock::ManagerMock;
+
+    ~RefreshingManagerMock() override
+    {
+        this->stopBackgroundRefresh();
+    }
+
+    std::atomic<int> refreshCount {0};
+    std::atomic<bool> isRefreshFailing {false};
+
+   protected:
+    void refresh_() override
+    {
+        refreshCount++;
+
+        if (isRefreshFailing)
+        {
+            throw std::runtime_error("Refresh failure.");
+        }
+    }
+};
+
 class OpenSpaceToolkit_Physics_Manager : public ::testing::Test
 {
    protected:
@@ -148,3 +178,102 @@ TEST_F(OpenSpaceToolkit_Physics_Manager, ClearLocalRepository)
     EXPECT_TRUE(localRepository.exists());
     EXPECT_TRUE(localRepository.isEmpty());
 }
+
+TEST_F(OpenSpaceToolkit_Physics_Manager, Refresh)
+{
+    {
+        ManagerMock manager(modeEnvVar_, localRepository_, localRepositoryEnvVar_, localPath_, lockTimeoutEnvVar_);
+
+        EXPECT_NO_THROW(manager.refresh());
+    }
+
+    {
+        RefreshingManagerMock manager(
+            modeEnvVar_, localRepository_, localRepositoryEnvVar_, localPath_, lockTimeoutEnvVar_
+        );
+
+        manager.refresh();
+
+        EXPECT_EQ(1, manager.refreshCount);
+
+        manager.isRefreshFailing = true;
+
+        EXPECT_ANY_THROW(manager.refresh());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Physics_Manager, BackgroundRefresh)
+{
+    const auto waitForRefreshCount = [](const RefreshingManagerMock& aManager, const int aRefreshCount) -> bool
+    {
+        const std::chrono::steady_clock::time_point timeout =
+            std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+        while (aManager.refreshCount < aRefreshCount)
+        {
+            if (std::chrono::steady_clock::now() > timeout)
+            {
+                return false;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return true;
+    };
+
+    {
+        RefreshingManagerMock manager(
+            modeEnvVar_, localRepository_, localRepositoryEnvVar_, localPath_, lockTimeoutEnvVar_
+        );
+
+        EXPECT_FALSE(manager.isBackgroundRefreshActive());
+
+        manager.startBackgroundRefresh(Duration::Milliseconds(1.0));
+
+        EXPECT_TRUE(manager.isBackgroundRefreshActive());
+
+        EXPECT_TRUE(waitForRefreshCount(manager, 3));
+
+        manager.stopBackgroundRefresh();
+
+        EXPECT_FALSE(manager.isBackgroundRefreshActive());
+
+        const int refreshCount = manager.refreshCount;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        EXPECT_EQ(refreshCount, manager.refreshCount);
+    }
+
+    // Refresh is attempted once immediately, and failures do not stop background refresh
+
+    {
+        RefreshingManagerMock manager(
+            modeEnvVar_, localRepository_, localRepositoryEnvVar_, localPath_, lockTimeoutEnvVar_
+        );
+
+        manager.startBackgroundRefresh(Duration::Hours(1.0));
+
+        EXPECT_TRUE(waitForRefreshCount(manager, 1));
+
+        manager.isRefreshFailing = true;
+
+        manager.startBackgroundRefresh(Duration::Milliseconds(1.0));
+
+        EXPECT_TRUE(waitForRefreshCount(manager, 4));
+
+        EXPECT_TRUE(manager.isBackgroundRefreshActive());
+    }
+
+    {
+        RefreshingManagerMock manager(
+            modeEnvVar_, localRepository_, localRepositoryEnvVar_, localPath_, lockTimeoutEnvVar_
+        );
+
+        EXPECT_ANY_THROW(manager.startBackgroundRefresh(Duration::Undefined()));
+        EXPECT_ANY_THROW(manager.startBackgroundRefresh(Duration::Zero()));
+
+        EXPECT_NO_THROW(manager.stopBackgroundRefresh());
+    }
+}
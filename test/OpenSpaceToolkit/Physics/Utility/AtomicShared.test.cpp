@@ -0,0 +1,97 @@
+/// Apache License 2.0
+
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Physics/Utility/AtomicShared.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+
+using ostk::physics::utilities::AtomicShared;
+
+TEST(OpenSpaceToolkit_Physics_Utility_AtomicShared, Constructor)
+{
+    {
+        const AtomicShared<const int> atomicShared;
+
+        EXPECT_EQ(nullptr, atomicShared.load());
+    }
+
+    {
+        const Shared<const int> valueSPtr = std::make_shared<const int>(1);
+
+        const AtomicShared<const int> atomicShared = {valueSPtr};
+
+        EXPECT_EQ(valueSPtr, atomicShared.load());
+    }
+}
+
+TEST(OpenSpaceToolkit_Physics_Utility_AtomicShared, Store)
+{
+    {
+        AtomicShared<const int> atomicShared = {std::make_shared<const int>(1)};
+
+        const Shared<const int> previousValueSPtr = atomicShared.load();
+
+        atomicShared.store(std::make_shared<const int>(2));
+
+        EXPECT_EQ(1, *previousValueSPtr);
+        EXPECT_EQ(2, *atomicShared.load());
+
+        atomicShared.store(nullptr);
+
+        EXPECT_EQ(nullptr, atomicShared.load());
+    }
+
+    {
+        // Values loaded while another thread publishes new ones stay valid
+
+        AtomicShared<const int> atomicShared = {std::make_shared<const int>(0)};
+
+        std::thread writer(
+            [&atomicShared]()
+            {
+                for (Index index = 1; index <= 10000; ++index)
+                {
+                    atomicShared.store(std::make_shared<const int>(static_cast<int>(index)));
+                }
+            }
+        );
+
+        std::vector<std::thread> readers;
+
+        for (Index readerIndex = 0; readerIndex < 4; ++readerIndex)
+        {
+            readers.emplace_back(
+                [&atomicShared]()
+                {
+                    int previousValue = 0;
+
+                    for (Index index = 0; index < 10000; ++index)
+                    {
+                        const Shared<const int> valueSPtr = atomicShared.load();
+
+                        ASSERT_NE(nullptr, valueSPtr);
+                        EXPECT_LE(previousValue, *valueSPtr);
+
+                        previousValue = *valueSPtr;
+                    }
+                }
+            );
+        }
+
+        writer.join();
+
+        for (std::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        EXPECT_EQ(10000, *atomicShared.load());
+    }
+}
@@ -0,0 +1,86 @@
+/* Apache License 2.0 */
+
+/*
+ * Record NRLMSISE-00 reference densities, bit for bit, at the inputs of an Orekit NRLMSISE-00 input and density file.
+ *
+ * Built against the unpatched library, to record the output of the serial kernel before its working state is made
+ * thread-local. The densities are written in hexadecimal floating point, one line per input line, with the same model
+ * switches as NRLMSISE00::GetDensityAt.
+ *
+ * Usage: RecordReferenceDensities < OreKitNRLMSISEInputsAndDensity.csv > NRLMSISE00SerialKernelDensities.csv
+ */
+
+#include <stdio.h>
+
+#include "nrlmsise-00.h"
+
+int main(void)
+{
+    char line[1024];
+
+    /* Skip the header */
+
+    if (fgets(line, sizeof(line), stdin) == NULL)
+    {
+        fprintf(stderr, "Missing header.\n");
+        return 1;
+    }
+
+    struct nrlmsise_flags flags;
+
+    for (int i = 0; i < 24; i++)
+    {
+        flags.switches[i] = 1;
+    }
+
+    printf("ROW,DENSITY\n");
+
+    int row = 0;
+
+    while (fgets(line, sizeof(line), stdin) != NULL)
+    {
+        struct ap_array apArray;
+        struct nrlmsise_input input;
+        struct nrlmsise_output output;
+
+        /* DATE,DOY,SEC,LAT,LON,ALT,LST,AVG_FLUX,DAILY_FLUX,AP1,AP2,AP3,AP4,AP5,AP6,AP7,DENSITY */
+
+        const int fieldCount = sscanf(
+            line,
+            "%*[^,],%d,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf",
+            &input.doy,
+            &input.sec,
+            &input.g_lat,
+            &input.g_long,
+            &input.alt,
+            &input.lst,
+            &input.f107A,
+            &input.f107,
+            &apArray.a[0],
+            &apArray.a[1],
+            &apArray.a[2],
+            &apArray.a[3],
+            &apArray.a[4],
+            &apArray.a[5],
+            &apArray.a[6]
+        );
+
+        if (fieldCount != 15)
+        {
+            fprintf(stderr, "Cannot parse row [%d].\n", row);
+            return 1;
+        }
+
+        input.year = 2022;
+        input.ap = apArray.a[0];
+        input.ap_a = &apArray;
+
+        gtd7d(&input, &flags, &output);
+
+        printf("%d,%a\n", row, output.d[5]);
+
+        row++;
+    }
+
+    return 0;
+}